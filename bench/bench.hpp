@@ -0,0 +1,34 @@
+#ifndef GOINTERPRETER_BENCH_BENCH_HPP
+#define GOINTERPRETER_BENCH_BENCH_HPP
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Runs `body` `iterations` times and prints the average time per iteration.
+ */
+template<typename F>
+double benchmark(const std::string& name, long iterations, F body)
+{
+    // warm up
+    for (long i = 0; i < iterations / 10; ++i) {
+        body(i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+        body(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << ns << " ns/op" << std::endl;
+
+    return ns;
+}
+
+#endif // GOINTERPRETER_BENCH_BENCH_HPP
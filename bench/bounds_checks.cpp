@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long iterations = 100000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source, long& removedBoundsChecks)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        removedBoundsChecks = optimizer.getRemovedBoundsChecks();
+        return optimizer.getProgram();
+    }
+
+    // Program summing and rewriting an array `iterations / 16` times, after `declaration`
+    std::string loop(const std::string& declaration)
+    {
+        return
+            "func main() {\n"
+            "    var a [16]int = [16]int{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}\n"
+            "    var i, j, s int = 0, 0, 0\n"
+            "    " + declaration + "\n"
+            "    for j = 0; j < " + std::to_string(iterations / 16) + "; j++ {\n"
+            "        for i = 0; i < 16; i++ {\n"
+            "            s += a[i]\n"
+            "            a[i] = s % 7\n"
+            "        }\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time per inner iteration with the accesses proven in range, and with the address of `i` taken
+    void compare(const std::string& name)
+    {
+        auto source = loop("var p *int = &s");
+        auto unprovable = loop("var p *int = &i");
+
+        long removed, unprovableRemoved;
+        auto program = compile(source, removed);
+        auto unprovableProgram = compile(unprovable, unprovableRemoved);
+
+        if (program == nullptr || unprovableProgram == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto run = [](AST::Node *program) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        };
+
+        auto ns = benchmark("Proven, 100k iterations", 10, [&](long) { run(program); });
+        auto unprovableNs = benchmark("`&i` taken, 100k iterations", 10, [&](long) { run(unprovableProgram); });
+
+        std::cout << name << ": " << ns / iterations << " ns with " << removed << " checks removed, "
+                  << unprovableNs / iterations << " ns with " << unprovableRemoved << " removed" << std::endl;
+    }
+
+}
+
+// A read and a write of `a[i]` in a counted loop over a [16]int. Once
+// the optimizer drops both bounds checks, once it keeps them because a
+// pointer to `i` could move it out of range.
+int main()
+{
+    compare("Array loop");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    long allocations = 0;
+
+}
+
+void *operator new(size_t size)
+{
+    ++allocations;
+    if (auto memory = std::malloc(size)) return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+namespace {
+
+    const long iterations = 100000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program looping `iterations` times over `statement`
+    std::string loop(const std::string& statement)
+    {
+        return
+            "func f(a int, b int) int {\n"
+            "    return a\n"
+            "}\n"
+            "func main() {\n"
+            "    var i, x int = 0, 0\n"
+            "    for i = 0; i < " + std::to_string(iterations) + "; i = i + 1 {\n"
+            "        " + statement + "\n"
+            "    }\n"
+            "}\n";
+    }
+
+}
+
+// Call overhead of a two argument function returning one of them, the
+// same loop assigning the argument directly is the baseline subtracted.
+int main()
+{
+    auto bare = loop("x = i");
+    auto calling = loop("x = f(i, x)");
+
+    auto bareProgram = compile(bare);
+    auto callingProgram = compile(calling);
+
+    if (bareProgram == nullptr || callingProgram == nullptr) return 1;
+
+    long bareAllocations = 0;
+    long callingAllocations = 0;
+
+    auto bareNs = benchmark("Loop, 100k iterations", 10, [&](long) {
+        Interpreter interpreter{};
+        auto before = allocations;
+        bareProgram->accept(&interpreter);
+        bareAllocations = allocations - before;
+    });
+
+    auto callingNs = benchmark("Loop calling f, 100k iterations", 10, [&](long) {
+        Interpreter interpreter{};
+        auto before = allocations;
+        callingProgram->accept(&interpreter);
+        callingAllocations = allocations - before;
+    });
+
+    std::cout << "Call overhead: " << (callingNs - bareNs) / iterations << " ns, "
+              << static_cast<double>(callingAllocations - bareAllocations) / iterations << " allocations" << std::endl;
+
+    return 0;
+}
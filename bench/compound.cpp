@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long iterations = 100000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program looping `iterations` times over `statement`, after `declaration`
+    std::string loop(const std::string& declaration, const std::string& statement)
+    {
+        return
+            "type P struct {\n"
+            "    x int\n"
+            "    y int\n"
+            "}\n"
+            "func main() {\n"
+            "    var i int = 0\n"
+            "    " + declaration + "\n"
+            "    for i = 0; i < " + std::to_string(iterations) + "; i = i + 1 {\n"
+            "        " + statement + "\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time per iteration of `statement`, and of the same update written out as an assignment
+    void compare(const std::string& name, const std::string& declaration, const std::string& statement, const std::string& assignment)
+    {
+        auto source = loop(declaration, statement);
+        auto writtenOut = loop(declaration, assignment);
+
+        auto program = compile(source);
+        auto writtenOutProgram = compile(writtenOut);
+
+        if (program == nullptr || writtenOutProgram == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto run = [](AST::Node *program) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        };
+
+        auto ns = benchmark("`" + statement + "`, 100k iterations", 10, [&](long) { run(program); });
+        auto writtenOutNs = benchmark("`" + assignment + "`, 100k iterations", 10, [&](long) { run(writtenOutProgram); });
+
+        std::cout << name << ": " << ns / iterations << " ns in place, " << writtenOutNs / iterations << " ns written out" << std::endl;
+    }
+
+}
+
+// Compound assignments and ++ on a field, a nested array element and a map
+// entry, each against the assignment it abbreviates, which computes the
+// target's address twice.
+int main()
+{
+    compare("Field", "var p P = P{x: 0, y: 0}", "p.y += i", "p.y = p.y + i");
+    compare("Nested element", "var b [3][3]int = [3][3]int{[3]int{0, 0, 0}, [3]int{0, 0, 0}, [3]int{0, 0, 0}}", "b[1][2] += i", "b[1][2] = b[1][2] + i");
+    compare("Map entry", "var m map[int]int = map[int]int{}", "m[5]++", "m[5] = m[5] + 1");
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long comparisons = 10000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program running `body` `comparisons` times, after declaring `a` and `b`, two equal [64]int, and `m`
+    std::string loop(const std::string& declaration, const std::string& body)
+    {
+        std::string literal;
+        for (long i = 0; i < 64; ++i) literal += (i == 0 ? "" : ", ") + std::to_string(i * 7);
+
+        return
+            "type Key struct {\n"
+            "    name string\n"
+            "    at [4]int\n"
+            "}\n"
+            "func main() {\n"
+            "    var a [64]int = [64]int{" + literal + "}\n"
+            "    var b [64]int = [64]int{" + literal + "}\n"
+            "    var m map[Key]int = map[Key]int{}\n"
+            "    var k Key = Key{name: \"key\", at: [4]int{1, 2, 3, 4}}\n"
+            "    m[k] = 1\n"
+            "    var i, n int = 0, 0\n"
+            "    " + declaration + "\n"
+            "    for i = 0; i < " + std::to_string(comparisons) + "; i++ {\n"
+            "        " + body + "\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time per iteration of `body`
+    void measure(const std::string& name, const std::string& declaration, const std::string& body)
+    {
+        auto source = loop(declaration, body);
+        auto program = compile(source);
+
+        if (program == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto ns = benchmark(name + ", 10k iterations", 10, [&](long) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        });
+
+        std::cout << name << ": " << ns / comparisons << " ns per iteration" << std::endl;
+    }
+
+}
+
+// `==` on two [64]int built apart, on two sharing their elements after a
+// copy, and a lookup in a map keyed by a struct holding an array.
+int main()
+{
+    measure("[64]int built apart", "", "if (a == b) {\n            n++\n        }");
+    measure("[64]int copied", "b = a", "if (a == b) {\n            n++\n        }");
+    measure("Struct key lookup", "", "n += m[k]");
+
+    return 0;
+}
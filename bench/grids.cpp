@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long size = 64;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program running `body` for every cell `g.cells[y][x]` of a `size` by `size` grid
+    std::string loop(const std::string& body)
+    {
+        auto length = std::to_string(size);
+
+        return
+            "type Grid struct {\n"
+            "    cells [" + length + "][" + length + "]int\n"
+            "}\n"
+            "func main() {\n"
+            "    var g Grid\n"
+            "    var x, y, s int = 0, 0, 0\n"
+            "    for y = 0; y < " + length + "; y++ {\n"
+            "        for x = 0; x < " + length + "; x++ {\n"
+            "            " + body + "\n"
+            "        }\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time per cell of `body`, zero value and loop included
+    void measure(const std::string& name, const std::string& body)
+    {
+        auto source = loop(body);
+        auto program = compile(source);
+
+        if (program == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto ns = benchmark(name + ", " + std::to_string(size * size) + " cells", 20, [&](long) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        });
+
+        std::cout << name << ": " << ns / (size * size) << " ns per cell" << std::endl;
+    }
+
+}
+
+// Reads and writes of the cells of a [64][64]int, a grid stored row-major
+// in one buffer whose reads are one fused access, and an empty loop.
+int main()
+{
+    measure("Empty loop", "s++");
+    measure("Read", "s += g.cells[y][x]");
+    measure("Write", "g.cells[y][x] = x + y");
+
+    return 0;
+}
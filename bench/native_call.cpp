@@ -0,0 +1,46 @@
+#include <map>
+
+#include "bench.hpp"
+#include "natives/natives.hpp"
+
+// Native-call overhead: generated thunk against the hand written
+// `FunctionValue` lambda that dynamic_casts its arguments.
+int main()
+{
+    const long iterations = 10000000;
+
+    Natives::registerNative<long(long, long)>("benchAdd", [](long lhs, long rhs) {
+        return lhs + rhs;
+    });
+
+    Natives::Native add{};
+    for (const auto& native : Natives::all()) {
+        if (native.id == "benchAdd") add = native;
+    }
+
+    NativeFunctionValue native{add.thunk, add.function};
+    FunctionValue legacy{{}, [](auto closure, auto arguments) -> Value * {
+        auto lhs = dynamic_cast<IntValue *>(arguments[0]->getValue());
+        auto rhs = dynamic_cast<IntValue *>(arguments[1]->getValue());
+        return new IntValue{lhs->getInt() + rhs->getInt()};
+    }};
+
+    IntValue lhs{20};
+    IntValue rhs{22};
+    long sink = 0;
+    Value *arguments[] = {&lhs, &rhs};
+
+    benchmark("FunctionValue lambda + dynamic_cast", iterations, [&](long) {
+        auto result = legacy.call({arguments, 2});
+        sink += static_cast<IntValue *>(result)->getInt();
+        delete result;
+    });
+
+    benchmark("NativeFunctionValue thunk", iterations, [&](long) {
+        auto result = native.call({arguments, 2});
+        sink += static_cast<IntValue *>(result)->getInt();
+        delete result;
+    });
+
+    return sink == 0;
+}
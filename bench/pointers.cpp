@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long iterations = 100000;
+    const long nodes = 10000;
+
+    // Parses, validates, escape analyses and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        EscapeAnalysis escapeAnalysis{};
+        tree->accept(&escapeAnalysis);
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Time per iteration of running `source`, whose loop runs `count` times
+    void measure(const std::string& name, std::string source, long count)
+    {
+        auto program = compile(source);
+
+        if (program == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto ns = benchmark(name + ", " + std::to_string(count) + " iterations", 10, [&](long) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        });
+
+        std::cout << name << ": " << ns / count << " ns" << std::endl;
+    }
+
+    // Program calling `function` `iterations` times
+    std::string loop(const std::string& function)
+    {
+        return
+            function +
+            "func main() {\n"
+            "    var i, x int = 0, 0\n"
+            "    for i = 0; i < " + std::to_string(iterations) + "; i = i + 1 {\n"
+            "        x = x + f(i)\n"
+            "    }\n"
+            "}\n";
+    }
+
+}
+
+// Inserts into a binary search tree of `&node{...}` literals, and takes
+// the address of a local that stays in its frame against one that is
+// returned and has to move to the heap.
+int main()
+{
+    measure("Tree insert",
+        "type node struct {\n"
+        "    val int\n"
+        "    left *node\n"
+        "    right *node\n"
+        "}\n"
+        "func insert(t *node, v int) *node {\n"
+        "    if (t == nil) {\n"
+        "        return &node{val: v, left: nil, right: nil}\n"
+        "    }\n"
+        "    if (v < t.val) {\n"
+        "        t.left = insert(t.left, v)\n"
+        "    } else {\n"
+        "        t.right = insert(t.right, v)\n"
+        "    }\n"
+        "    return t\n"
+        "}\n"
+        "func main() {\n"
+        "    var t *node = nil\n"
+        "    var i int = 0\n"
+        "    for i = 0; i < " + std::to_string(nodes) + "; i = i + 1 {\n"
+        "        t = insert(t, (i * 7919) % 10007)\n"
+        "    }\n"
+        "}\n", nodes);
+
+    measure("&x in frame", loop(
+        "func g(i int) int {\n"
+        "    var x int = i\n"
+        "    var p *int = &x\n"
+        "    *p = *p + 1\n"
+        "    return x\n"
+        "}\n"
+        "func f(i int) int {\n"
+        "    return g(i)\n"
+        "}\n"), iterations);
+
+    measure("&x escaping", loop(
+        "func g(i int) *int {\n"
+        "    var x int = i\n"
+        "    var p *int = &x\n"
+        "    *p = *p + 1\n"
+        "    return p\n"
+        "}\n"
+        "func f(i int) int {\n"
+        "    return *g(i)\n"
+        "}\n"), iterations);
+
+    return 0;
+}
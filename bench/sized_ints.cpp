@@ -0,0 +1,77 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    const long bytes = 4096;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program taking the Adler-32 sums, in `sum`, of a slice literal of `bytes` elements of type `element`
+    std::string checksum(const std::string& element, const std::string& sum)
+    {
+        std::string literal;
+        for (long i = 0; i < bytes; ++i) literal += (i == 0 ? "" : ", ") + std::to_string(i * 7 % 256);
+
+        return
+            "func main() {\n"
+            "    var data []" + element + " = []" + element + "{" + literal + "}\n"
+            "    var a, b " + sum + " = 1, 0\n"
+            "    var i int = 0\n"
+            "    for i = 0; i < " + std::to_string(bytes) + "; i++ {\n"
+            "        a = (a + " + sum + "(data[i])) % 65521\n"
+            "        b = (b + a) % 65521\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time per byte of building and summing a slice of `element`
+    void measure(const std::string& name, const std::string& element, const std::string& sum)
+    {
+        auto source = checksum(element, sum);
+        auto program = compile(source);
+
+        if (program == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto ns = benchmark(name + ", " + std::to_string(bytes) + " bytes", 20, [&](long) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        });
+
+        std::cout << name << ": " << ns / bytes << " ns per byte" << std::endl;
+    }
+
+}
+
+// Adler-32 over a []uint8 with uint32 sums, whose elements are packed
+// and read as shared values, against the same loop over a []int.
+int main()
+{
+    measure("[]uint8, uint32 sums", "uint8", "uint32");
+    measure("[]int, int sums", "int", "int");
+
+    return 0;
+}
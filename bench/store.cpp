@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    long allocations = 0;
+
+}
+
+void *operator new(size_t size)
+{
+    ++allocations;
+    if (auto memory = std::malloc(size)) return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+namespace {
+
+    const long iterations = 100000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program looping `iterations` times over `statement`, after `declarations`
+    std::string loop(const std::string& declarations, const std::string& statement)
+    {
+        return
+            "type P struct {\n"
+            "    x int\n"
+            "    y int\n"
+            "}\n"
+            "func main() {\n"
+            "    var i int = 0\n"
+            "    " + declarations + "\n"
+            "    for i = 0; i < " + std::to_string(iterations) + "; i = i + 1 {\n"
+            "        " + statement + "\n"
+            "    }\n"
+            "}\n";
+    }
+
+    // Time and allocations per iteration of the loop, less those of an empty loop body
+    void measure(const std::string& name, AST::Node *program, AST::Node *empty)
+    {
+        long programAllocations = 0;
+        long emptyAllocations = 0;
+
+        auto run = [](AST::Node *program, long& counted) {
+            Interpreter interpreter{};
+            auto before = allocations;
+            program->accept(&interpreter);
+            counted = allocations - before;
+        };
+
+        auto programNs = benchmark(name + ", 100k iterations", 10, [&](long) { run(program, programAllocations); });
+        auto emptyNs = benchmark("Empty loop, 100k iterations", 10, [&](long) { run(empty, emptyAllocations); });
+
+        std::cout << name << " store: " << (programNs - emptyNs) / iterations << " ns, "
+                  << static_cast<double>(programAllocations - emptyAllocations) / iterations << " allocations" << std::endl;
+    }
+
+}
+
+// Cost of the store in `x = i`, `b[1][2] = i` and `p.y = i`. The value
+// stored is read the same way in each, only the left hand side differs.
+int main()
+{
+    auto empty = loop("", "");
+    auto variable = loop("var x int = 0", "x = i");
+    auto element = loop("var b [3][3]int = [3][3]int{[3]int{0, 0, 0}, [3]int{0, 0, 0}, [3]int{0, 0, 0}}", "b[1][2] = i");
+    auto field = loop("var p P = P{x: 0, y: 0}", "p.y = i");
+
+    auto emptyProgram = compile(empty);
+    auto variableProgram = compile(variable);
+    auto elementProgram = compile(element);
+    auto fieldProgram = compile(field);
+
+    if (!emptyProgram || !variableProgram || !elementProgram || !fieldProgram) return 1;
+
+    measure("Variable", variableProgram, emptyProgram);
+    measure("Nested element", elementProgram, emptyProgram);
+    measure("Field", fieldProgram, emptyProgram);
+
+    return 0;
+}
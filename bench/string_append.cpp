@@ -0,0 +1,42 @@
+#include <string>
+
+#include "bench.hpp"
+#include "interpreter/values.hpp"
+
+// `s = s + "x"` until `s` is 10 MB: appends into the spare capacity of
+// the left operand's buffer against std::string as the lower bound. The
+// left operand always ends where the buffer is used up, so the append
+// stays in place without any string being freed; the intermediate strings
+// are deleted only to bound the memory of the run.
+int main()
+{
+    const long size = 10 * 1024 * 1024;
+    long sink = 0;
+
+    StringValue byte{"x", 1};
+
+    benchmark("StringValue::add, 10 MB by 1 byte", 1, [&](long) {
+        auto string = new StringValue{"", 0};
+
+        for (long i = 0; i < size; ++i) {
+            auto appended = static_cast<StringValue *>(string->add(&byte));
+            delete string;
+            string = appended;
+        }
+
+        sink += string->getString().size;
+        delete string;
+    });
+
+    benchmark("std::string::append, 10 MB by 1 byte", 1, [&](long) {
+        std::string string{};
+
+        for (long i = 0; i < size; ++i) {
+            string.append("x", 1);
+        }
+
+        sink += string.size();
+    });
+
+    return sink == 0;
+}
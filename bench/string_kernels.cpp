@@ -0,0 +1,62 @@
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "interpreter/string_kernels.hpp"
+
+// String kernels picked at runtime against their scalar versions, on
+// inputs from 1 KB to 1 MB. Compared strings only differ in the last
+// byte and the needle sits at the end, so every byte is looked at.
+int main()
+{
+    long sink = 0;
+
+    for (long size : {1024L, 64 * 1024L, 1024 * 1024L}) {
+        std::string lhs(size, 'a');
+        std::string rhs(size, 'a');
+        rhs.back() = 'b';
+        std::string same = lhs;
+
+        std::string text(size, 'a');
+        for (long i = 0; i < size; i += 64) text[i] = '\0';
+
+        std::string needle = "aaaaaaab";
+        std::string haystack(size, 'a');
+        haystack.replace(size - needle.size(), needle.size(), needle);
+
+        std::vector<char> destination(size);
+
+        auto iterations = 64 * 1024 * 1024 / size;
+        auto suffix = " " + std::to_string(size / 1024) + " KB";
+
+        benchmark("compare scalar" + suffix, iterations, [&](long) {
+            sink += StringKernels::Scalar::compare(lhs.data(), rhs.data(), size);
+        });
+        benchmark("compare" + suffix, iterations, [&](long) {
+            sink += StringKernels::compare(lhs.data(), rhs.data(), size);
+        });
+
+        benchmark("equal scalar" + suffix, iterations, [&](long) {
+            sink += StringKernels::Scalar::equal(lhs.data(), same.data(), size);
+        });
+        benchmark("equal" + suffix, iterations, [&](long) {
+            sink += StringKernels::equal(lhs.data(), same.data(), size);
+        });
+
+        benchmark("stripNul scalar" + suffix, iterations, [&](long) {
+            sink += StringKernels::Scalar::stripNul(text.data(), size, destination.data());
+        });
+        benchmark("stripNul" + suffix, iterations, [&](long) {
+            sink += StringKernels::stripNul(text.data(), size, destination.data());
+        });
+
+        benchmark("find scalar" + suffix, iterations, [&](long) {
+            sink += StringKernels::Scalar::find(haystack.data(), size, needle.data(), needle.size());
+        });
+        benchmark("find" + suffix, iterations, [&](long) {
+            sink += StringKernels::find(haystack.data(), size, needle.data(), needle.size());
+        });
+    }
+
+    return sink == 0;
+}
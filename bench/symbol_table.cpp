@@ -0,0 +1,57 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+// Validates a generated `main` declaring 10k locals in 100 nested blocks,
+// every local is initialised from its namesake one block further out.
+// Each block declares its locals in one statement, the parser stack is
+// bounded.
+int main()
+{
+    const long depth = 100;
+    const long locals = 100;
+
+    auto name = [](long level, long i) {
+        return "v" + std::to_string(level) + "_" + std::to_string(i);
+    };
+
+    std::string source = "func main() {\n";
+
+    for (long level = 0; level < depth; ++level) {
+        std::string ids;
+        std::string values;
+
+        for (long i = 0; i < locals; ++i) {
+            ids += (i == 0 ? "" : ", ") + name(level, i);
+            values += (i == 0 ? "" : ", ") + (level == 0 ? std::string{"0"} : name(level - 1, i));
+        }
+
+        source += "var " + ids + " int = " + values + "\n";
+        source += "if true {\n";
+    }
+
+    source += "printInt(v0_0)\n";
+
+    for (long level = 0; level < depth; ++level) {
+        source += "}\n";
+    }
+
+    source += "}\n";
+
+    yyin = fmemopen(source.data(), source.size(), "r");
+    yyparse();
+
+    if (tree == nullptr) return 1;
+
+    long errors = 0;
+
+    benchmark("Validator, 10k locals 100 scopes deep", 10, [&](long) {
+        Validator validator{};
+        tree->accept(&validator);
+        errors += validator.getErrors().size();
+    });
+
+    return errors != 0;
+}
@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    // 64 KB of ints
+    const long elements = 8192;
+    const long depth = 1000;
+
+    // Parses, validates and optimizes `source`, the program to interpret
+    AST::Node *compile(std::string& source)
+    {
+        yyrestart(fmemopen(source.data(), source.size(), "r"));
+        yyparse();
+
+        if (tree == nullptr) return nullptr;
+
+        Validator validator{};
+        tree->accept(&validator);
+        if (!validator.getErrors().empty()) return nullptr;
+
+        Optimizer optimizer{};
+        tree->accept(&optimizer);
+        delete tree;
+
+        return optimizer.getProgram();
+    }
+
+    // Program passing an array of `elements` ints down `depth` calls, each running `statement` first.
+    // The array is a zero value in a struct, a literal that long is more than the parser's stack takes.
+    std::string chain(const std::string& statement)
+    {
+        return
+            "type Block struct {\n"
+            "    data [" + std::to_string(elements) + "]int\n"
+            "}\n"
+            "func main() {\n"
+            "    var b Block\n"
+            "    pass(b, " + std::to_string(depth) + ")\n"
+            "}\n"
+            "func pass(b Block, n int) int {\n"
+            "    " + statement + "\n"
+            "    if (n == 0) {\n"
+            "        return b.data[0]\n"
+            "    }\n"
+            "    return pass(b, n - 1) + 1\n"
+            "}\n";
+    }
+
+    // Time per call of the chain, making the array in main included
+    void measure(const std::string& name, const std::string& statement)
+    {
+        auto source = chain(statement);
+        auto program = compile(source);
+
+        if (program == nullptr) {
+            std::cout << name << ": does not compile" << std::endl;
+            return;
+        }
+
+        auto ns = benchmark(name + ", " + std::to_string(depth) + " calls", 20, [&](long) {
+            Interpreter interpreter{};
+            program->accept(&interpreter);
+        });
+
+        std::cout << name << ": " << ns / depth << " ns per call" << std::endl;
+    }
+
+}
+
+// A [8192]int, 64 KB, passed by value down 1000 nested calls. Passing
+// it only shares it, a callee writing to its copy pays for one copy of
+// the array and of the struct around it.
+int main()
+{
+    measure("Passed on", "var i int = n");
+    measure("Written by every callee", "b.data[n % " + std::to_string(elements) + "] = n");
+
+    return 0;
+}
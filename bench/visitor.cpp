@@ -0,0 +1,187 @@
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "bench.hpp"
+#include "main.hpp"
+
+namespace {
+
+    long allocations = 0;
+
+}
+
+void *operator new(size_t size)
+{
+    ++allocations;
+    if (auto memory = std::malloc(size)) return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+namespace {
+
+    /**
+     * Visitor doing nothing but following every callback, loop bodies are
+     * walked `iterations` times. Whatever it allocates is the protocol's.
+     */
+    class Walker : public AST::Visitor
+    {
+    public:
+        explicit Walker(long iterations) : iterations{iterations} {}
+
+        void visitProgram(long size) override {}
+
+        void visitBoolType() override {}
+        void visitIntType() override {}
+        void visitFloat32Type() override {}
+        void visitRuneType() override {}
+        void visitStringType() override {}
+        void visitArrayType(long size) override {}
+        void visitSliceType() override {}
+        void visitStructType(std::vector<Atom> fields) override {}
+        void visitPointerType() override {}
+        void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override {}
+        void visitMapType() override {}
+        void visitCustomType(Atom id) override {}
+
+        void visitBlock(AST::Visits visitStatements) override { visitStatements(); }
+
+        void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override { visitSignature(); visitBody(); }
+        void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override { visitType(); }
+        void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override { visitType(); }
+        void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override {}
+
+        void visitExpressionStatement() override {}
+        void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override { visitLhs(); visitRhs(); }
+        void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override { visitTarget(); visitUpdate(); }
+        void visitIncDecStatement(AST::Visit visitTarget, long delta) override { visitTarget(); }
+        void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override { visitTrue(); visitFalse(); }
+        void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override { visitExpression(); visitClauses(); }
+        void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override { visitExpressions(); visitStatements(); }
+        void visitSwitchDefaultClause(AST::Visits visitStatements) override { visitStatements(); }
+        void visitReturnStatement(long size) override {}
+        void visitBreakStatement() override {}
+        void visitContinueStatement() override {}
+        void visitEmptyStatement() override {}
+
+        void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override
+        {
+            visitInit();
+
+            auto before = allocations;
+            for (long i = 0; i < iterations; ++i) {
+                visitCondition();
+                visitBody();
+                visitPost();
+            }
+            loopAllocations += allocations - before;
+        }
+
+        void visitBoolExpression(bool value) override {}
+        void visitIntExpression(long value) override {}
+        void visitFloat32Expression(float value) override {}
+        void visitRuneExpression(char value) override {}
+        void visitStringExpression(char *value, long length) override {}
+        void visitConstantExpression(long index, AST::Visit visitLiteral) override { visitLiteral(); }
+
+        void visitIdentifierExpression(Atom id) override {}
+        void visitTargetExpression() override {}
+        void visitCompositLiteralExpression(std::vector<Atom> keys) override {}
+        void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override { visitSignature(); visitBody(); }
+        void visitSelectExpression(Atom id, long& fieldIndex) override {}
+        void visitIndexExpression(long& length, bool checked) override {}
+        void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override {}
+        void visitFullSliceExpression(bool lowDeclared) override {}
+        void visitCallExpression(long size, long line, bool tailCall) override {}
+        void visitConversionExpression() override {}
+        void visitNewExpression(AST::Visit visitType) override { visitType(); }
+        void visitUnaryPlusExpression() override {}
+        void visitUnaryNegateExpression() override {}
+        void visitUnaryLogicalNotExpression() override {}
+        void visitUnaryBitwiseNotExpression() override {}
+        void visitUnaryDereferenceExpression() override {}
+        void visitUnaryReferenceExpression(bool& escapes) override {}
+        void visitBinaryLogicalOrExpression() override {}
+        void visitBinaryLogicalAndExpression() override {}
+        void visitBinaryEqualExpression() override {}
+        void visitBinaryNotEqualExpression() override {}
+        void visitBinaryLessThanExpression() override {}
+        void visitBinaryLessThanEqualExpression() override {}
+        void visitBinaryGreaterThanExpression() override {}
+        void visitBinaryGreaterThanEqualExpression() override {}
+        void visitBinaryShiftLeftExpression() override {}
+        void visitBinaryShiftRightExpression() override {}
+        void visitBinaryAddExpression() override {}
+        void visitBinarySubtractExpression() override {}
+        void visitBinaryBitwiseOrExpression() override {}
+        void visitBinaryBitwiseXOrExpression() override {}
+        void visitBinaryBitwiseAndExpression() override {}
+        void visitBinaryMultiplyExpression() override {}
+        void visitBinaryDivideExpression() override {}
+        void visitBinaryModuloExpression() override {}
+
+        void visitIdentifierStore(Atom id) override {}
+        void visitSelectStore(Atom id, long& fieldIndex) override {}
+        void visitIndexStore(long& length, bool checked) override {}
+        void visitDereferenceStore() override {}
+        void visitLiteralStore() override {}
+        void visitValueStore() override {}
+
+        void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override { visitOriginal(); }
+        void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override { visitOriginal(); }
+        void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override { visitOriginal(); }
+        void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override { visitOriginal(); }
+
+        long loopAllocations = 0;
+
+    private:
+        long iterations;
+    };
+
+}
+
+// Walks a loop whose body holds an if/else, a switch and assignments,
+// and reports the heap allocations the visitor protocol makes per
+// iteration of it.
+int main()
+{
+    const long iterations = 100000;
+
+    std::string source =
+        "func main() {\n"
+        "    var i, x int = 0, 0\n"
+        "    for i = 0; i < 10; i = i + 1 {\n"
+        "        if x < 5 {\n"
+        "            x = x + 1\n"
+        "        } else {\n"
+        "            x = x - 1\n"
+        "        }\n"
+        "        switch (x) {\n"
+        "        case 1, 2:\n"
+        "            x = x + 2\n"
+        "        default:\n"
+        "            x = 0\n"
+        "        }\n"
+        "    }\n"
+        "    printInt(x)\n"
+        "}\n";
+
+    yyin = fmemopen(source.data(), source.size(), "r");
+    yyparse();
+
+    if (tree == nullptr) return 1;
+
+    Walker walker{iterations};
+
+    benchmark("Visitor walk, 100k loop iterations", 1, [&](long) {
+        tree->accept(&walker);
+    });
+
+    std::cout << "Allocations per loop iteration: " << static_cast<double>(walker.loopAllocations) / iterations << std::endl;
+
+    return 0;
+}
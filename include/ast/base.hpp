@@ -42,6 +42,10 @@ namespace AST {
     public:
         virtual ~Expression() = default;
         virtual void accept(Visitor *visitor) const override = 0;
+        // Visits the expression as the target of a store, only lvalues have
+        // a store form. Anything else is visited as is, then as a value store,
+        // the validator only accepts stores through a slice, map or pointer it gives.
+        virtual void acceptStore(Visitor *visitor) const;
 
     protected:
         Expression() = default;
@@ -10,12 +10,15 @@ namespace AST {
     class FunctionDeclaration : public TopLevelDeclaration 
     {
     public:
-        FunctionDeclaration(std::string id, Type *signature, Block *body);
+        FunctionDeclaration(Atom id, Type *signature, Block *body);
         virtual ~FunctionDeclaration() override;
         virtual void accept(Visitor *visitor) const override;
 
+        const Type *getSignature() const;
+        const Block *getBody() const;
+
     private:
-        std::string id;
+        Atom id;
         Type *signature;
         Block *body;
     };
@@ -33,36 +36,36 @@ namespace AST {
     class TypeAliasDeclaration : public TypeSpecDeclaration
     {
     public:
-        TypeAliasDeclaration(std::string id, Type *underlyingType);
+        TypeAliasDeclaration(Atom id, Type *underlyingType);
         virtual ~TypeAliasDeclaration() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        std::string id;
+        Atom id;
         Type *underlyingType;
     };
 
     class TypeDefinitionDeclaration : public TypeSpecDeclaration
     {
     public:
-        TypeDefinitionDeclaration(std::string id, Type *underlyingType);
+        TypeDefinitionDeclaration(Atom id, Type *underlyingType);
         virtual ~TypeDefinitionDeclaration() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        std::string id;
+        Atom id;
         Type *underlyingType;
     };
 
     class VariableDeclaration : public Declaration 
     {
     public:
-        VariableDeclaration(std::vector<std::string> ids, Type *type, std::vector<Expression *> expressions);
+        VariableDeclaration(std::vector<Atom> ids, Type *type, std::vector<Expression *> expressions);
         virtual ~VariableDeclaration() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        std::vector<std::string> ids;
+        std::vector<Atom> ids;
         Type *type;
         std::vector<Expression *> expressions;
     };
@@ -9,24 +9,131 @@ namespace AST {
     class IdentifierExpression : public Expression
     {
     public:
-        IdentifierExpression(std::string id);
+        IdentifierExpression(Atom id);
         virtual ~IdentifierExpression() override = default;
         virtual void accept(Visitor *visitor) const override;
+        virtual void acceptStore(Visitor *visitor) const override;
+        Atom getId() const;
 
     private:
-        std::string id;
+        Atom id;
+    };
+
+    /**
+     * Current value of the target of the enclosing compound assignment, the
+     * left operand of its update. The target is not evaluated again.
+     */
+    class TargetExpression : public Expression
+    {
+    public:
+        TargetExpression() = default;
+        virtual ~TargetExpression() override = default;
+        virtual void accept(Visitor *visitor) const override;
+    };
+
+    /**
+     * Literal hoisted into the constant pool by the optimizer, every
+     * occurence of the same literal shares the pool index.
+     */
+    class ConstantExpression : public Expression
+    {
+    public:
+        ConstantExpression(long index, Expression *literal);
+        virtual ~ConstantExpression() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        long index;
+        Expression *literal;
+    };
+
+    /**
+     * Superinstruction for comparing an int variable with a constant, the
+     * comparison it replaces is kept for warm-up and failed type guards.
+     */
+    class CompareLocalExpression : public Expression
+    {
+    public:
+        CompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), Expression *original);
+        virtual ~CompareLocalExpression() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Atom id;
+        long constant;
+        bool (*compare)(long, long);
+        Expression *original;
+        mutable long executions;
+    };
+
+    /**
+     * Access to an element of an array, slice, string or map, the rows an
+     * IndexGridExpression indexes into
+     */
+    class ElementExpression : public Expression
+    {
+    public:
+        // Visits the indexed value and the index, not the access itself
+        virtual void acceptOperands(Visitor *visitor) const = 0;
+        // Length of the indexed array, -1 for other values
+        virtual long getLength() const = 0;
+        virtual bool isChecked() const = 0;
+    };
+
+    /**
+     * Superinstruction for indexing a variable, one node instead of an
+     * identifier and an index expression.
+     */
+    class IndexLocalExpression : public ElementExpression
+    {
+    public:
+        IndexLocalExpression(Atom id, Expression *index, long length = -1, bool checked = true);
+        virtual ~IndexLocalExpression() override;
+        virtual void accept(Visitor *visitor) const override;
+        virtual void acceptOperands(Visitor *visitor) const override;
+        virtual long getLength() const override;
+        virtual bool isChecked() const override;
+        void setChecked(bool checked);
+
+    private:
+        Atom id;
+        Expression *index;
+        mutable long executions;
+        mutable long length;
+        bool checked;
+    };
+
+    /**
+     * Superinstruction for `a[i][j]` on an array of arrays, one access to
+     * the cell of a grid, see ArrayValue. The row access keeps its own
+     * bounds check.
+     */
+    class IndexGridExpression : public Expression
+    {
+    public:
+        IndexGridExpression(ElementExpression *row, Expression *column, long length = -1, bool checked = true);
+        virtual ~IndexGridExpression() override;
+        virtual void accept(Visitor *visitor) const override;
+        void setChecked(bool checked);
+
+    private:
+        ElementExpression *row;
+        Expression *column;
+        mutable long length; // Length of the rows
+        bool checked;
     };
 
     class CompositLiteralExpression : public Expression
     {
     public:
-        CompositLiteralExpression(Type *type, std::vector<std::pair<std::string, Expression *>> elements);
+        CompositLiteralExpression(Type *type, std::vector<std::pair<Atom, Expression *>> elements);
         virtual ~CompositLiteralExpression() override;
         virtual void accept(Visitor *visitor) const override;
+        virtual void acceptStore(Visitor *visitor) const override;
 
     private:
         Type *type;
-        std::vector<std::pair<std::string, Expression *>> elements;
+        std::vector<std::pair<Atom, Expression *>> elements;
     };
 
     class FunctionLiteralExpression : public Expression {
@@ -43,25 +150,34 @@ namespace AST {
     class SelectExpression : public Expression 
     {
     public:
-        SelectExpression(Expression *expression, std::string id);
+        SelectExpression(Expression *expression, Atom id, long fieldIndex = -1);
         virtual ~SelectExpression() override;
         virtual void accept(Visitor *visitor) const override;
+        virtual void acceptStore(Visitor *visitor) const override;
 
     private:
         Expression *expression;
-        std::string id;
+        Atom id;
+        mutable long fieldIndex; // Position in the struct layout, resolved by the validator
     };
 
-    class IndexExpression : public Expression 
+    class IndexExpression : public ElementExpression 
     {
     public:
-        IndexExpression(Expression *expression, Expression *index);
+        IndexExpression(Expression *expression, Expression *index, long length = -1, bool checked = true);
         virtual ~IndexExpression() override;
         virtual void accept(Visitor *visitor) const override;
+        virtual void acceptStore(Visitor *visitor) const override;
+        virtual void acceptOperands(Visitor *visitor) const override;
+        virtual long getLength() const override;
+        virtual bool isChecked() const override;
+        void setChecked(bool checked);
 
     private:
         Expression *expression;
         Expression *index;
+        mutable long length; // Length of the indexed array, resolved by the validator
+        bool checked;        // Cleared when the optimizer proved the index in range
     };
 
     class SimpleSliceExpression : public Expression 
@@ -94,13 +210,18 @@ namespace AST {
     class CallExpression : public Expression 
     {
     public:
-        CallExpression(Expression *expression, std::vector<Expression *> arguments);
+        CallExpression(Expression *expression, std::vector<Expression *> arguments, long line = 0, bool tailCall = false);
         virtual ~CallExpression() override;
         virtual void accept(Visitor *visitor) const override;
 
+        // The call is the only operand of a return statement
+        void markTailCall();
+
     private:
         Expression *expression;
         std::vector<Expression *> arguments;
+        long line;
+        bool tailCall;
     };
 
     class ConversionExpression : public Expression
@@ -115,6 +236,20 @@ namespace AST {
         Expression *expression;
     };
 
+    /**
+     * `new(T)`, a pointer to a fresh zero value of the named type T
+     */
+    class NewExpression : public Expression
+    {
+    public:
+        NewExpression(Type *type);
+        virtual ~NewExpression() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Type *type;
+    };
+
     class UnaryExpression : public Expression
     {
     public:
@@ -127,13 +262,15 @@ namespace AST {
             REFERENCE,
         };
 
-        UnaryExpression(Operation operation, Expression * expression);
+        UnaryExpression(Operation operation, Expression * expression, bool escapes = true);
         virtual ~UnaryExpression() override;
         virtual void accept(Visitor *visitor) const override;
+        virtual void acceptStore(Visitor *visitor) const override;
     
     private:
         Operation operation;
         Expression *expression;
+        mutable bool escapes; // Whether a reference can outlive the frame, cleared by escape analysis
     };
 
     class BinaryExpression : public Expression
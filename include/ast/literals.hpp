@@ -21,12 +21,12 @@ namespace AST {
     class IntExpression : public Expression
     {
     public:
-        IntExpression(int value);
+        IntExpression(long value);
         virtual ~IntExpression() override = default;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        int value;
+        long value;
     };
 
     class Float32Expression : public Expression
@@ -0,0 +1,135 @@
+#ifndef GOINTERPRETER_AST_PRINTER_HPP
+#define GOINTERPRETER_AST_PRINTER_HPP
+
+#include <string>
+#include <vector>
+
+#include "ast/visitor.hpp"
+#include "utils/stack.hpp"
+
+namespace AST {
+
+    /**
+     * Prints a tree back as Go source, used to inspect optimized programs
+     */
+    class Printer : public Visitor
+    {
+    public:
+        Printer();
+        ~Printer();
+
+        std::string getOutput() const;
+
+        // Program
+        void visitProgram(long size) override;
+
+        // Types
+        void visitBoolType() override;
+        void visitIntType() override;
+        void visitFloat32Type() override;
+        void visitRuneType() override;
+        void visitStringType() override;
+        void visitArrayType(long size) override;
+        void visitSliceType() override;
+        void visitStructType(std::vector<Atom> fields) override;
+        void visitPointerType() override;
+        void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
+        void visitMapType() override;
+        void visitCustomType(Atom id) override;
+
+        // Block
+        void visitBlock(Visits visitStatements) override;
+
+        // Declarations
+        void visitFunctionDeclaration(Atom id, Visit visitSignature, Visit visitBody) override;
+        void visitTypeAliasDeclaration(Atom id, Visit visitType) override;
+        void visitTypeDefinitionDeclaration(Atom id, Visit visitType) override;
+        void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
+
+        // Statements
+        void visitExpressionStatement() override;
+        void visitAssignmentStatement(Visits visitLhs, Visits visitRhs) override;
+        void visitCompoundAssignmentStatement(Visit visitTarget, Visit visitUpdate) override;
+        void visitIncDecStatement(Visit visitTarget, long delta) override;
+        void visitIfStatement(Visit visitTrue, Visit visitFalse) override;
+        void visitSwitchStatement(Visit visitExpression, Visits visitClauses, const SwitchTable *table) override;
+        void visitSwitchExpressionClause(Visits visitExpressions, Visits visitStatements) override;
+        void visitSwitchDefaultClause(Visits visitStatements) override;
+        void visitReturnStatement(long size) override;
+        void visitBreakStatement() override;
+        void visitContinueStatement() override;
+        void visitEmptyStatement() override;
+        void visitForConditionStatement(Visit visitInit, Visit visitCondition, Visit visitPost, Visit visitBody) override;
+
+        // Expressions - Literals
+        void visitBoolExpression(bool value) override;
+        void visitIntExpression(long value) override;
+        void visitFloat32Expression(float value) override;
+        void visitRuneExpression(char value) override;
+        void visitStringExpression(char *value, long length) override;
+        void visitConstantExpression(long index, Visit visitLiteral) override;
+
+        // Expressions - Rest
+        void visitIdentifierExpression(Atom id) override;
+        void visitTargetExpression() override;
+        void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+        void VisitFunctionLiteralExpression(Visit visitSignature, Visit visitBody) override;
+        void visitSelectExpression(Atom id, long& fieldIndex) override;
+        void visitIndexExpression(long& length, bool checked) override;
+        void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
+        void visitFullSliceExpression(bool lowDeclared) override;
+        void visitCallExpression(long size, long line, bool tailCall) override;
+        void visitConversionExpression() override;
+        void visitNewExpression(Visit visitType) override;
+        void visitUnaryPlusExpression() override;
+        void visitUnaryNegateExpression() override;
+        void visitUnaryLogicalNotExpression() override;
+        void visitUnaryBitwiseNotExpression() override;
+        void visitUnaryDereferenceExpression() override;
+        void visitUnaryReferenceExpression(bool& escapes) override;
+        void visitBinaryLogicalOrExpression() override;
+        void visitBinaryLogicalAndExpression() override;
+        void visitBinaryEqualExpression() override;
+        void visitBinaryNotEqualExpression() override;
+        void visitBinaryLessThanExpression() override;
+        void visitBinaryLessThanEqualExpression() override;
+        void visitBinaryGreaterThanExpression() override;
+        void visitBinaryGreaterThanEqualExpression() override;
+        void visitBinaryShiftLeftExpression() override;
+        void visitBinaryShiftRightExpression() override;
+        void visitBinaryAddExpression() override;
+        void visitBinarySubtractExpression() override;
+        void visitBinaryBitwiseOrExpression() override;
+        void visitBinaryBitwiseXOrExpression() override;
+        void visitBinaryBitwiseAndExpression() override;
+        void visitBinaryMultiplyExpression() override;
+        void visitBinaryDivideExpression() override;
+        void visitBinaryModuloExpression() override;
+
+        // Stores
+        void visitIdentifierStore(Atom id) override;
+        void visitSelectStore(Atom id, long& fieldIndex) override;
+        void visitIndexStore(long& length, bool checked) override;
+        void visitDereferenceStore() override;
+        void visitLiteralStore() override;
+        void visitValueStore() override;
+
+        // Superinstructions
+        void visitIncrementStatement(Atom id, long delta, long& executions, Visit visitOriginal) override;
+        void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, Visit visitOriginal) override;
+        void visitIndexLocalExpression(Atom id, long& executions, bool checked, Visit visitIndex, Visit visitOriginal) override;
+        void visitIndexGridExpression(bool rowChecked, bool checked, Visit visitRow, Visit visitColumn, Visit visitOriginal) override;
+
+    private:
+        std::vector<std::string> popStrings(long size);
+        std::string printStatements(Visits visitStatements);
+        void printUnary(const std::string& operation);
+        void printBinary(const std::string& operation);
+
+        std::string output;
+        Stack<std::string> stack;
+    };
+
+}; // namespace AST
+
+#endif // GOINTERPRETER_AST_PRINTER_HPP
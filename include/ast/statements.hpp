@@ -1,6 +1,9 @@
 #ifndef GOINTERPRETER_AST_STATEMENTS_HPP
 #define GOINTERPRETER_AST_STATEMENTS_HPP
 
+#include <map>
+#include <unordered_map>
+
 #include "ast/base.hpp"
 
 namespace AST {
@@ -16,6 +19,20 @@ namespace AST {
         Declaration *declaration;
     };
 
+    /**
+     * Nested block used as a statement, introduces its own scope
+     */
+    class BlockStatement : public Statement
+    {
+    public:
+        BlockStatement(Block *block);
+        virtual ~BlockStatement() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Block *block;
+    };
+
     class ExpressionStatement : public SimpleStatement 
     {
     public:
@@ -39,6 +56,56 @@ namespace AST {
         std::vector<Expression *> rhs;
     };
 
+    /**
+     * `target op= value`, stored as the update `target op value` whose left
+     * operand is a TargetExpression. The target is resolved once, read by the
+     * update and written in place.
+     */
+    class CompoundAssignmentStatement : public SimpleStatement
+    {
+    public:
+        CompoundAssignmentStatement(Expression *target, Expression *update);
+        virtual ~CompoundAssignmentStatement() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Expression *target;
+        Expression *update;
+    };
+
+    /**
+     * `target++` and `target--`, on any numeric target
+     */
+    class IncDecStatement : public SimpleStatement
+    {
+    public:
+        IncDecStatement(Expression *target, long delta);
+        virtual ~IncDecStatement() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Expression *target;
+        long delta;
+    };
+
+    /**
+     * Superinstruction for `id = id + delta` on an int variable, the
+     * assignment it replaces is kept for warm-up and failed type guards.
+     */
+    class IncrementStatement : public SimpleStatement
+    {
+    public:
+        IncrementStatement(Atom id, long delta, SimpleStatement *original);
+        virtual ~IncrementStatement() override;
+        virtual void accept(Visitor *visitor) const override;
+
+    private:
+        Atom id;
+        long delta;
+        SimpleStatement *original;
+        mutable long executions;
+    };
+
     class IfStatement : public Statement
     {
     public:
@@ -52,6 +119,40 @@ namespace AST {
         Block *falseBody;
     };
 
+    /**
+     * Selects the clause of a switch whose labels are all int/rune constants
+     * or all string constants, without evaluating them one by one. Int
+     * labels use a dense table when they fill half their range or more, a
+     * binary search otherwise, string labels use a hash table.
+     */
+    class SwitchTable
+    {
+    public:
+        static constexpr long NO_CLAUSE = -1;
+
+        SwitchTable(const std::vector<std::pair<long, long>>& labels, long defaultClause);
+        SwitchTable(const std::vector<std::pair<std::string, long>>& labels, long defaultClause);
+
+        bool hasStringLabels() const;
+        long lookup(long label) const;
+        long lookup(const std::string& label) const;
+        std::string getKind() const;
+
+    private:
+        enum class Kind {
+            Dense,
+            Sorted,
+            Hash,
+        };
+
+        Kind kind;
+        long defaultClause;
+        long low;
+        std::vector<long> dense;
+        std::vector<std::pair<long, long>> sorted;
+        std::unordered_map<std::string, long> hashed;
+    };
+
     class SwitchStatement : public Statement 
     {
     public:
@@ -88,13 +189,14 @@ namespace AST {
             void accept(Visitor *visitor) const override;
         };
 
-        SwitchStatement(Expression *expression, std::vector<SwitchClause *> clauses);
+        SwitchStatement(Expression *expression, std::vector<SwitchClause *> clauses, SwitchTable *table = nullptr);
         virtual ~SwitchStatement() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
         Expression *expression;
         std::vector<SwitchClause *> clauses;
+        SwitchTable *table; // nullptr when the labels have to be compared in order
     };
 
     class ReturnStatement : public Statement 
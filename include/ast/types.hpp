@@ -74,12 +74,12 @@ namespace AST {
     class StructType : public Type
     {
     public:
-        explicit StructType(std::vector<std::pair<std::string, Type *>> fields);
+        explicit StructType(std::vector<std::pair<Atom, Type *>> fields);
         virtual ~StructType() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        std::vector<std::pair<std::string, Type *>> fields;
+        std::vector<std::pair<Atom, Type *>> fields;
     };
     
     class PointerType : public Type
@@ -97,14 +97,17 @@ namespace AST {
     {
     public:
         FunctionType(
-            std::vector<std::pair<std::string, Type *>> parameters, 
-            std::vector<std::pair<std::string, Type *>> returns);
+            std::vector<std::pair<Atom, Type *>> parameters, 
+            std::vector<std::pair<Atom, Type *>> returns);
         virtual ~FunctionType() override;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        std::vector<std::pair<std::string, Type *>> parameters;
-        std::vector<std::pair<std::string, Type *>> returns;
+        std::vector<std::pair<Atom, Type *>> parameters;
+        std::vector<std::pair<Atom, Type *>> returns;
+        // Names handed to visitors, the signature is visited on every call
+        std::vector<Atom> parameterNames;
+        std::vector<Atom> returnNames;
     };
     
     class MapType : public Type
@@ -122,12 +125,12 @@ namespace AST {
     class CustomType : public Type
     {
     public:
-        explicit CustomType(const char *id);
+        explicit CustomType(Atom id);
         virtual ~CustomType() override= default;
         virtual void accept(Visitor *visitor) const override;
 
     private:
-        const std::string id;
+        const Atom id;
     };
 
 }; // namespace AST
@@ -5,8 +5,116 @@
 #include <vector>
 #include <functional> 
 
+#include "utils/atom.hpp"
+
 namespace AST {
 
+    class SwitchTable;
+    class Visitor;
+
+    /**
+     * Non-owning callable visiting one child node, or running a fixed
+     * sequence of visits, with a visitor. It is three words and holds no
+     * heap memory, it stays valid as long as the tree and the visitor do.
+     */
+    class Visit
+    {
+    public:
+        using Thunk = void (*)(const void *object, Visitor *visitor);
+
+        Visit(const void *object, Visitor *visitor, Thunk thunk)
+            : object{object}, visitor{visitor}, thunk{thunk}
+        {}
+
+        template<typename T>
+        Visit(const T *node, Visitor *visitor)
+            : object{node}, visitor{visitor}, thunk{[](const void *object, Visitor *visitor) {
+                static_cast<const T *>(object)->accept(visitor);
+            }}
+        {}
+
+        // Visits `node` as the target of a store, see Expression::acceptStore
+        template<typename T>
+        static Visit store(const T *node, Visitor *visitor)
+        {
+            return Visit{node, visitor, [](const void *object, Visitor *visitor) {
+                static_cast<const T *>(object)->acceptStore(visitor);
+            }};
+        }
+
+        void operator()() const { thunk(object, visitor); }
+
+        // Visit of `node` with the same visitor
+        template<typename T>
+        Visit to(const T *node) const { return Visit{node, visitor}; }
+
+    private:
+        const void *object;
+        Visitor *visitor;
+        Thunk thunk;
+    };
+
+    /**
+     * Non-owning span over a node's children, each element is a Visit.
+     * Calling it visits them all in order and returns how many there were.
+     */
+    class Visits
+    {
+    public:
+        template<typename T>
+        Visits(const std::vector<T *>& nodes, Visitor *visitor)
+            : nodes{nodes.data()}, count{static_cast<long>(nodes.size())}, visitor{visitor}, at{[](const void *nodes, long i, Visitor *visitor) {
+                return Visit{static_cast<T * const *>(nodes)[i], visitor};
+            }}
+        {}
+
+        // Visits the nodes as the targets of stores, see Expression::acceptStore
+        template<typename T>
+        static Visits stores(const std::vector<T *>& nodes, Visitor *visitor)
+        {
+            return Visits{nodes.data(), static_cast<long>(nodes.size()), visitor, [](const void *nodes, long i, Visitor *visitor) {
+                return Visit::store(static_cast<T * const *>(nodes)[i], visitor);
+            }};
+        }
+
+        class Iterator
+        {
+        public:
+            Iterator(const Visits *visits, long i) : visits{visits}, i{i} {}
+            Visit operator*() const { return (*visits)[i]; }
+            Iterator& operator++() { ++i; return *this; }
+            bool operator!=(const Iterator& other) const { return i != other.i; }
+
+        private:
+            const Visits *visits;
+            long i;
+        };
+
+        long size() const { return count; }
+        bool empty() const { return count == 0; }
+        Visit operator[](long i) const { return at(nodes, i, visitor); }
+        Iterator begin() const { return Iterator{this, 0}; }
+        Iterator end() const { return Iterator{this, count}; }
+
+        long operator()() const
+        {
+            for (long i = 0; i < count; ++i) (*this)[i]();
+            return count;
+        }
+
+    private:
+        using At = Visit (*)(const void *nodes, long i, Visitor *visitor);
+
+        Visits(const void *nodes, long count, Visitor *visitor, At at)
+            : nodes{nodes}, count{count}, visitor{visitor}, at{at}
+        {}
+
+        const void *nodes;
+        long count;
+        Visitor *visitor;
+        At at;
+    };
+
     class Visitor 
     {
     protected:
@@ -26,57 +134,66 @@ namespace AST {
         virtual void visitStringType() = 0;
         virtual void visitArrayType(long size) = 0;
         virtual void visitSliceType() = 0;
-        virtual void visitStructType(std::vector<std::string> fields) = 0;
+        virtual void visitStructType(std::vector<Atom> fields) = 0;
         virtual void visitPointerType() = 0;
-        virtual void visitFunctionType(std::vector<std::string> parameters, std::vector<std::string> returns) = 0;
+        virtual void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) = 0;
         virtual void visitMapType() = 0;
-        virtual void visitCustomType(std::string id) = 0;
+        virtual void visitCustomType(Atom id) = 0;
 
         // Block
-        virtual void visitBlock(const std::vector<const std::function<void ()>> visitStatements) = 0;
+        virtual void visitBlock(Visits visitStatements) = 0;
 
         // Declarations
-        virtual void visitFunctionDeclaration(std::string id, const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) = 0;
-        virtual void visitTypeAliasDeclaration(std::string id) = 0;
-        virtual void visitTypeDefinitionDeclaration(std::string id) = 0;
-        virtual void visitVariableDeclaration(std::vector<std::string> ids, bool typeDeclared, long expression_count) = 0;
+        virtual void visitFunctionDeclaration(Atom id, Visit visitSignature, Visit visitBody) = 0;
+        // The type is visited by the callee, after the name is known, so it can refer to itself
+        virtual void visitTypeAliasDeclaration(Atom id, Visit visitType) = 0;
+        virtual void visitTypeDefinitionDeclaration(Atom id, Visit visitType) = 0;
+        virtual void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) = 0;
 
         // Statements
         virtual void visitExpressionStatement() = 0;
-        virtual void visitAssignmentStatement(const std::function<long ()>& visitLhs, const std::function<long ()>& visitRhs) = 0;
-        virtual void visitIfStatement(const std::function<void ()>& visitTrue, const std::function<void ()>& visitFalse) = 0;
-        virtual void visitSwitchStatement(const std::function<void ()>& visitExpression, const std::vector<const std::function<void ()>> visitClauses) = 0;
-        virtual void visitSwitchExpressionClause(const std::vector<const std::function<void ()>> visitExpressions, const std::vector<const std::function<void ()>> visitStatements) = 0;
-        virtual void visitSwitchDefaultClause(const std::vector<const std::function<void ()>> visitStatements) = 0;
+        virtual void visitAssignmentStatement(Visits visitLhs, Visits visitRhs) = 0;
+        virtual void visitCompoundAssignmentStatement(Visit visitTarget, Visit visitUpdate) = 0;
+        virtual void visitIncDecStatement(Visit visitTarget, long delta) = 0;
+        virtual void visitIfStatement(Visit visitTrue, Visit visitFalse) = 0;
+        virtual void visitSwitchStatement(Visit visitExpression, Visits visitClauses, const SwitchTable *table) = 0;
+        virtual void visitSwitchExpressionClause(Visits visitExpressions, Visits visitStatements) = 0;
+        virtual void visitSwitchDefaultClause(Visits visitStatements) = 0;
         virtual void visitReturnStatement(long size) = 0;
         virtual void visitBreakStatement() = 0;
         virtual void visitContinueStatement() = 0;
         virtual void visitEmptyStatement() = 0;
-        virtual void visitForConditionStatement(const std::function<void ()>& visitInit, const std::function<void ()>& visitCondition, const std::function<void ()>& visitPost, const std::function<void ()>& visitBody) = 0;
+        virtual void visitForConditionStatement(Visit visitInit, Visit visitCondition, Visit visitPost, Visit visitBody) = 0;
 
         // Expressions - Literals
         virtual void visitBoolExpression(bool value) = 0;
-        virtual void visitIntExpression(int value) = 0;
+        virtual void visitIntExpression(long value) = 0;
         virtual void visitFloat32Expression(float value) = 0;
         virtual void visitRuneExpression(char value) = 0;
         virtual void visitStringExpression(char *value, long length) = 0;
+        virtual void visitConstantExpression(long index, Visit visitLiteral) = 0;
 
         // Expressions - Rest
-        virtual void visitIdentifierExpression(std::string id) = 0;
-        virtual void visitCompositLiteralExpression(std::vector<std::string> keys) = 0;
-        virtual void VisitFunctionLiteralExpression(const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) = 0;
-        virtual void visitSelectExpression(std::string id) = 0;
-        virtual void visitIndexExpression() = 0;
+        virtual void visitIdentifierExpression(Atom id) = 0;
+        virtual void visitTargetExpression() = 0;
+        virtual void visitCompositLiteralExpression(std::vector<Atom> keys) = 0;
+        virtual void VisitFunctionLiteralExpression(Visit visitSignature, Visit visitBody) = 0;
+        virtual void visitSelectExpression(Atom id, long& fieldIndex) = 0;
+        // `length` is that of an indexed array, resolved by the validator, -1 for anything else.
+        // `checked` is cleared where the optimizer proved the index in range
+        virtual void visitIndexExpression(long& length, bool checked) = 0;
         virtual void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) = 0;
         virtual void visitFullSliceExpression(bool lowDeclared) = 0;
-        virtual void visitCallExpression(long size) = 0;
+        virtual void visitCallExpression(long size, long line, bool tailCall) = 0;
         virtual void visitConversionExpression() = 0;
+        virtual void visitNewExpression(Visit visitType) = 0;
         virtual void visitUnaryPlusExpression() = 0;
         virtual void visitUnaryNegateExpression() = 0;
         virtual void visitUnaryLogicalNotExpression() = 0;
         virtual void visitUnaryBitwiseNotExpression() = 0;
         virtual void visitUnaryDereferenceExpression() = 0;
-        virtual void visitUnaryReferenceExpression() = 0;
+        // The operand is visited as a store, `escapes` is cleared when its address stays in the frame
+        virtual void visitUnaryReferenceExpression(bool& escapes) = 0;
         virtual void visitBinaryLogicalOrExpression() = 0;
         virtual void visitBinaryLogicalAndExpression() = 0;
         virtual void visitBinaryEqualExpression() = 0;
@@ -96,6 +213,26 @@ namespace AST {
         virtual void visitBinaryDivideExpression() = 0;
         virtual void visitBinaryModuloExpression() = 0;
 
+        // Stores, the left hand sides of assignments. The arrays, structs and
+        // pointers whose elements and fields are stored to are visited as
+        // stores too, so a copy on write can replace them. Other operands are
+        // visited as usual
+        virtual void visitIdentifierStore(Atom id) = 0;
+        virtual void visitSelectStore(Atom id, long& fieldIndex) = 0;
+        virtual void visitIndexStore(long& length, bool checked) = 0;
+        virtual void visitDereferenceStore() = 0;
+        // A composite literal whose address is taken, `&T{...}`
+        virtual void visitLiteralStore() = 0;
+        // Any other expression, the store goes to a temporary holding its value
+        virtual void visitValueStore() = 0;
+
+        // Superinstructions, `visitOriginal` visits the unfused form
+        virtual void visitIncrementStatement(Atom id, long delta, long& executions, Visit visitOriginal) = 0;
+        virtual void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, Visit visitOriginal) = 0;
+        virtual void visitIndexLocalExpression(Atom id, long& executions, bool checked, Visit visitIndex, Visit visitOriginal) = 0;
+        // `visitRow` visits the array and the row index, `rowChecked` tells whether the row is bounds checked
+        virtual void visitIndexGridExpression(bool rowChecked, bool checked, Visit visitRow, Visit visitColumn, Visit visitOriginal) = 0;
+
     };
 
 }; // namespace AST
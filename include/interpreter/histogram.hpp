@@ -0,0 +1,128 @@
+#ifndef GOINTERPRETER_INTERPRETER_HISTOGRAM_HPP
+#define GOINTERPRETER_INTERPRETER_HISTOGRAM_HPP
+
+#include <iostream>
+#include <map>
+
+#include "ast/visitor.hpp"
+
+/**
+ * Forwards every visit to another visitor and counts how often each node
+ * kind (opcode) is executed.
+ */
+class OpcodeHistogram : public AST::Visitor
+{
+public:
+    OpcodeHistogram(AST::Visitor *inner);
+    ~OpcodeHistogram() = default;
+
+    void print(std::ostream& out) const;
+
+    // Program
+    void visitProgram(long size) override;
+
+    // Types
+    void visitBoolType() override;
+    void visitIntType() override;
+    void visitFloat32Type() override;
+    void visitRuneType() override;
+    void visitStringType() override;
+    void visitArrayType(long size) override;
+    void visitSliceType() override;
+    void visitStructType(std::vector<Atom> fields) override;
+    void visitPointerType() override;
+    void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
+    void visitMapType() override;
+    void visitCustomType(Atom id) override;
+
+    // Block
+    void visitBlock(AST::Visits visitStatements) override;
+
+    // Declarations
+    void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override;
+    void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override;
+    void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
+
+    // Statements
+    void visitExpressionStatement() override;
+    void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override;
+    void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override;
+    void visitIncDecStatement(AST::Visit visitTarget, long delta) override;
+    void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override;
+    void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override;
+    void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override;
+    void visitSwitchDefaultClause(AST::Visits visitStatements) override;
+    void visitReturnStatement(long size) override;
+    void visitBreakStatement() override;
+    void visitContinueStatement() override;
+    void visitEmptyStatement() override;
+    void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override;
+
+    // Expressions - Literals
+    void visitBoolExpression(bool value) override;
+    void visitIntExpression(long value) override;
+    void visitFloat32Expression(float value) override;
+    void visitRuneExpression(char value) override;
+    void visitStringExpression(char *value, long length) override;
+    void visitConstantExpression(long index, AST::Visit visitLiteral) override;
+
+    // Expressions - Rest
+    void visitIdentifierExpression(Atom id) override;
+    void visitTargetExpression() override;
+    void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+    void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitSelectExpression(Atom id, long& fieldIndex) override;
+    void visitIndexExpression(long& length, bool checked) override;
+    void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
+    void visitFullSliceExpression(bool lowDeclared) override;
+    void visitCallExpression(long size, long line, bool tailCall) override;
+    void visitConversionExpression() override;
+    void visitNewExpression(AST::Visit visitType) override;
+    void visitUnaryPlusExpression() override;
+    void visitUnaryNegateExpression() override;
+    void visitUnaryLogicalNotExpression() override;
+    void visitUnaryBitwiseNotExpression() override;
+    void visitUnaryDereferenceExpression() override;
+    void visitUnaryReferenceExpression(bool& escapes) override;
+    void visitBinaryLogicalOrExpression() override;
+    void visitBinaryLogicalAndExpression() override;
+    void visitBinaryEqualExpression() override;
+    void visitBinaryNotEqualExpression() override;
+    void visitBinaryLessThanExpression() override;
+    void visitBinaryLessThanEqualExpression() override;
+    void visitBinaryGreaterThanExpression() override;
+    void visitBinaryGreaterThanEqualExpression() override;
+    void visitBinaryShiftLeftExpression() override;
+    void visitBinaryShiftRightExpression() override;
+    void visitBinaryAddExpression() override;
+    void visitBinarySubtractExpression() override;
+    void visitBinaryBitwiseOrExpression() override;
+    void visitBinaryBitwiseXOrExpression() override;
+    void visitBinaryBitwiseAndExpression() override;
+    void visitBinaryMultiplyExpression() override;
+    void visitBinaryDivideExpression() override;
+    void visitBinaryModuloExpression() override;
+
+    // Stores
+    void visitIdentifierStore(Atom id) override;
+    void visitSelectStore(Atom id, long& fieldIndex) override;
+    void visitIndexStore(long& length, bool checked) override;
+    void visitDereferenceStore() override;
+    void visitLiteralStore() override;
+    void visitValueStore() override;
+
+    // Superinstructions
+    void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override;
+    void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override;
+    void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override;
+    void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override;
+
+private:
+    void count(const char *opcode);
+
+    AST::Visitor *inner;
+    std::map<const char *, long> counts;
+};
+
+#endif // GOINTERPRETER_INTERPRETER_HISTOGRAM_HPP
@@ -2,8 +2,13 @@
 #define GOINTERPRETER_INTERPRETER_INTERPRETER_HPP
 
 #include <iostream>
+#include <deque>
+#include <memory>
+#include <unordered_map>
 
+#include "ast/declarations.hpp"
 #include "ast/visitor.hpp"
+#include "interpreter/layout.hpp"
 #include "interpreter/values.hpp"
 #include "utils/stack.hpp"
 #include "validation/symbol_table.hpp"
@@ -11,9 +16,14 @@
 class Interpreter : public AST::Visitor
 {
 public:
-    Interpreter();
+    // `stackSize` is the native stack the program runs on, 0 disables the overflow check
+    Interpreter(std::string file = "", long stackSize = 0);
     ~Interpreter();
 
+    // Runs before the first call of each declared function, may throw to stop the program.
+    // The declaration it returns, if any, runs instead of the visited one from then on.
+    void setFirstCallHook(const std::function<const AST::FunctionDeclaration *(Atom id)>& hook);
+
     // Program
     void visitProgram(long size) override;
 
@@ -25,57 +35,62 @@ public:
     void visitStringType() override;
     void visitArrayType(long size) override;
     void visitSliceType() override;
-    void visitStructType(std::vector<std::string> fields) override;
+    void visitStructType(std::vector<Atom> fields) override;
     void visitPointerType() override;
-    void visitFunctionType(std::vector<std::string> parameters, std::vector<std::string> returns) override;
+    void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
     void visitMapType() override;
-    void visitCustomType(std::string id) override;
+    void visitCustomType(Atom id) override;
 
     // Block
-    void visitBlock(const std::vector<const std::function<void ()>> visitStatements) override;
+    void visitBlock(AST::Visits visitStatements) override;
 
     // Declarations
-    void visitFunctionDeclaration(std::string id, const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) override;
-    void visitTypeAliasDeclaration(std::string id) override;
-    void visitTypeDefinitionDeclaration(std::string id) override;
-    void visitVariableDeclaration(std::vector<std::string> ids, bool typeDeclared, long expression_count) override;
+    void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override;
+    void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override;
+    void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
 
     // Statements
     void visitExpressionStatement() override;
-    void visitAssignmentStatement(const std::function<long ()>& visitLhs, const std::function<long ()>& visitRhs) override;
-    void visitIfStatement(const std::function <void ()>& visitTrue, const std::function <void ()>& visitFalse) override;
-    void visitSwitchStatement(const std::function<void ()>& visitExpression, const std::vector<const std::function<void ()>> visitClauses) override;
-    void visitSwitchExpressionClause(const std::vector<const std::function<void ()>> visitExpressions, const std::vector<const std::function<void ()>> visitStatements) override;
-    void visitSwitchDefaultClause(const std::vector<const std::function<void ()>> visitStatements) override;
+    void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override;
+    void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override;
+    void visitIncDecStatement(AST::Visit visitTarget, long delta) override;
+    void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override;
+    void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override;
+    void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override;
+    void visitSwitchDefaultClause(AST::Visits visitStatements) override;
     void visitReturnStatement(long size) override;
     void visitBreakStatement() override;
     void visitContinueStatement() override;
     void visitEmptyStatement() override;
-    void visitForConditionStatement(const std::function<void ()>& visitInit, const std::function<void ()>& visitCondition, const std::function<void ()>& visitPost, const std::function<void ()>& visitBody) override;
+    void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override;
 
     // Expressions - Literals
     void visitBoolExpression(bool value) override;
-    void visitIntExpression(int value) override;
+    void visitIntExpression(long value) override;
     void visitFloat32Expression(float value) override;
     void visitRuneExpression(char value) override;
     void visitStringExpression(char *value, long length) override;
+    void visitConstantExpression(long index, AST::Visit visitLiteral) override;
 
     // Expressions - Rest
-    void visitIdentifierExpression(std::string id) override;
-    void visitCompositLiteralExpression(std::vector<std::string> keys) override;
-    void VisitFunctionLiteralExpression(const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) override;
-    void visitSelectExpression(std::string id) override;
-    void visitIndexExpression() override;
+    void visitIdentifierExpression(Atom id) override;
+    void visitTargetExpression() override;
+    void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+    void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitSelectExpression(Atom id, long& fieldIndex) override;
+    void visitIndexExpression(long& length, bool checked) override;
     void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
     void visitFullSliceExpression(bool lowDeclared) override;
-    void visitCallExpression(long size) override;
+    void visitCallExpression(long size, long line, bool tailCall) override;
     void visitConversionExpression() override;
+    void visitNewExpression(AST::Visit visitType) override;
     void visitUnaryPlusExpression() override;
     void visitUnaryNegateExpression() override;
     void visitUnaryLogicalNotExpression() override;
     void visitUnaryBitwiseNotExpression() override;
     void visitUnaryDereferenceExpression() override;
-    void visitUnaryReferenceExpression() override;
+    void visitUnaryReferenceExpression(bool& escapes) override;
     void visitBinaryLogicalOrExpression() override;
     void visitBinaryLogicalAndExpression() override;
     void visitBinaryEqualExpression() override;
@@ -95,20 +110,159 @@ public:
     void visitBinaryDivideExpression() override;
     void visitBinaryModuloExpression() override;
 
+    // Stores
+    void visitIdentifierStore(Atom id) override;
+    void visitSelectStore(Atom id, long& fieldIndex) override;
+    void visitIndexStore(long& length, bool checked) override;
+    void visitDereferenceStore() override;
+    void visitLiteralStore() override;
+    void visitValueStore() override;
+
+    // Superinstructions
+    void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override;
+    void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override;
+    void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override;
+    void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override;
+
 private:
-    enum class CompositeLiteralType {
+    // How the clauses of the innermost switch react when visited
+    enum class SwitchState {
+        Matching, // Compare the labels with the switch value
+        Matched,  // A clause matched and ran, skip the rest
+        Default,  // Nothing matched, run the default clause
+        Selected, // The jump table picked the clause that is visited
+    };
+
+    enum class TypeKind {
+        Basic,
         Struct,
         Slice,
         Array,
+        Map,
+        Pointer,
+        Function,
     };
 
+    using Factory = std::function<Value *()>;
+
+    /**
+     * What the interpreter keeps of a type. Every type visit pushes one and
+     * pops those of its children. Composite types visited while a named type
+     * is defined also get a factory for fresh zero values, which `new` and
+     * declarations without a value call. Arrays and structs keep the types
+     * of their elements and fields to build a zero value without one.
+     */
+    struct TypeInfo
+    {
+        TypeKind kind;
+        Value *zero;         // Shared zero value, nullptr if it is made fresh or there is none
+        Value *elementZero;  // Zero value of the elements, a map reads it for missing keys
+        const Factory *make; // Fresh zero values, nullptr outside of type definitions
+        const Layout *layout = nullptr; // Equality and hash of arrays and structs
+        long length = 0; // Length of an array type
+        std::shared_ptr<const TypeInfo> element; // Element type of an array or map type
+        std::shared_ptr<const std::vector<TypeInfo>> fields; // Field types of a struct type
+    };
+
+    /**
+     * Target of a store, computed from the left hand side of an assignment
+     * before its right hand side runs. Variables are looked up when stored,
+     * elements, fields and map entries are written through their address,
+     * elements of a packed slice through the slice, rows of a grid through
+     * the grid. An element or field keeps the value it is in, which gets
+     * pinned if its address is taken.
+     */
+    struct Location
+    {
+        enum class Kind {
+            Variable,
+            Slot,
+            Element,
+            Row,
+        };
+
+        static Location variable(Atom id) { return Location{Kind::Variable, id, nullptr, nullptr, nullptr, nullptr}; }
+        static Location slot(Value **slot, Value *owner = nullptr) { return Location{Kind::Slot, {}, slot, nullptr, nullptr, owner}; }
+        static Location element(Index *container, Value *index, Value *owner = nullptr) { return Location{Kind::Element, {}, nullptr, container, index, owner}; }
+        static Location row(ArrayValue *grid, long row) { return Location{Kind::Row, {}, nullptr, nullptr, nullptr, grid, row}; }
+
+        Kind kind;
+        Atom id;
+        Value **address;
+        Index *container;
+        Value *index;
+        Value *owner; // Array, struct or slice the slot, element or row is in, nullptr for variables and cells
+        long rowIndex = 0; // Row of the grid `owner` for Row
+    };
+
+    // Executions of a superinstruction before its fused form is used
+    static constexpr long QUICKEN_THRESHOLD = 16;
+
+    bool quickened(long& executions);
+
+    // Fresh zero value of a type if it has a factory, its shared one otherwise
+    static Value *zeroOf(const TypeInfo& type);
+    // Zero value of a type, arrays and structs without a factory are built from the zeros of their elements or fields
+    static Value *builtZeroOf(const TypeInfo& type);
+    // Layout of an array or struct type, of the scalars of the type's zero value otherwise
+    static const Layout *layoutOf(const TypeInfo& type);
+    // `value` as a new holder stores it, see Aggregate
+    static Value *held(Value *value);
+    // Slice of `values`, packed if its elements are sized integers
+    static Value *makeSlice(Value *elementZero, const std::vector<Value *>& values);
+    // `value` converted to the sized integer type of `zero`, unchanged for other types
+    static Value *converted(Value *zero, Value *value);
+    // Keeps `make` for the program's life while a named type is defined, nullptr otherwise
+    template<typename Make>
+    const Factory *factory(Make make)
+    {
+        if (defining.empty()) return nullptr;
+        return &factories.emplace_back(std::move(make));
+    }
+
+    void visitClauseStatements(AST::Visits visitStatements);
+    Value *load(const Location& location);
+    void store(const Location& location, Value *value);
+    // Value at `location` to write into, a copy stored there first if it was shared
+    Value *owned(const Location& location);
+
+    // Headroom kept free below the overflow check for natives and the runtime
+    static constexpr long STACK_MARGIN = 256 * 1024;
+
+    /**
+     * Calls `callee`, then runs the tail calls it left behind in the same
+     * native frame
+     */
+    Value *call(Call *callee, Arguments arguments, long line);
+    // Binds `arguments` to the parameters of the signature just visited, in place
+    void bindSignature(Arguments arguments);
+
+    std::function<const AST::FunctionDeclaration *(Atom id)> firstCallHook;
+    std::string file;
+    long stackSize;
+    const char *stackLimit;
+    // Parameters and result count of the last function type visited. Nested
+    // function types are visited before the one they are in, so after a call
+    // visits its callee's signature these are the callee's own.
+    const std::vector<Atom> *signatureParameters;
+    long signatureReturns;
+    Call *tailCallee;
+    std::vector<Value *> tailArguments;
+    Value *tailCallResult; // Stands in for the result of a deferred tail call
+
     Stack<Value *> stack;
+    Stack<Location> locations;
     Stack<Value *> switchStack;
+    SwitchState switchState;
     SymbolTable<Value *> symbolTable;
+    std::vector<Value *> constants;
 
     Stack<long> returnsByCurrentFunction;
     Stack<bool> functionClosed;
-    Stack<CompositeLiteralType> compositeLiteralType;
+    Stack<TypeInfo> types;
+    std::unordered_map<Atom, TypeInfo> definitions; // Named types
+    std::deque<Factory> factories;
+    Atom defining; // Named type whose definition is visited, empty outside of one
 
     bool cont;
     bool brk;
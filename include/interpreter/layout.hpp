@@ -0,0 +1,62 @@
+#ifndef GOINTERPRETER_INTERPRETER_LAYOUT_HPP
+#define GOINTERPRETER_INTERPRETER_LAYOUT_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "interpreter/values.hpp"
+
+/**
+ * Equality and hash of the values of one type, behind `==`, switch
+ * clauses and map keys. The interpreter makes one for each array and
+ * struct type it visits, with kernels picked for the element and field
+ * types: scalars are compared without a cast or a virtual call. Plain
+ * values, which hold no floats, are equal when they are the same value,
+ * so aggregates sharing their elements after a copy on write compare
+ * with one wide compare of the element addresses. Layouts are interned,
+ * a type visited again gets the same one.
+ */
+class Layout
+{
+public:
+    // Layout of the scalars whose zero value is `zero`, compared through Equal and Hash if it is unknown
+    static const Layout *scalar(Value *zero);
+    static const Layout *array(const Layout *element);
+    // Without field layouts, when the field types are unknown, fields are compared through Equal and Hash
+    static const Layout *structure(const std::vector<const Layout *>& fields);
+
+    bool equal(Value *lhs, Value *rhs) const;
+    size_t hash(Value *value) const;
+    // Layout of the elements of an array
+    const Layout *element() const;
+
+private:
+    using EqualKernel = bool (*)(const Layout *layout, Value *lhs, Value *rhs);
+    using HashKernel = size_t (*)(const Layout *layout, Value *value);
+
+    // The kernels of a scalar type, and of the arrays of its values
+    template<typename Scalar>
+    static const Layout *scalar();
+    template<typename Scalar>
+    static bool equalScalars(const Layout *layout, Value *lhs, Value *rhs);
+    template<typename Scalar>
+    static size_t hashScalar(const Layout *layout, Value *value);
+    template<typename Scalar>
+    static bool equalArrays(const Layout *layout, Value *lhs, Value *rhs);
+    template<typename Scalar>
+    static size_t hashArray(const Layout *layout, Value *value);
+    static bool equalStructs(const Layout *layout, Value *lhs, Value *rhs);
+    static size_t hashStruct(const Layout *layout, Value *value);
+
+    Layout(EqualKernel equalKernel, HashKernel hashKernel, EqualKernel arrayEqualKernel, HashKernel arrayHashKernel, bool plain, std::vector<const Layout *> parts);
+
+    EqualKernel equalKernel;
+    HashKernel hashKernel;
+    // Kernels of an array of these values
+    EqualKernel arrayEqualKernel;
+    HashKernel arrayHashKernel;
+    bool plain;
+    std::vector<const Layout *> parts; // The element layout of an array, the field layouts of a struct
+};
+
+#endif // GOINTERPRETER_INTERPRETER_LAYOUT_HPP
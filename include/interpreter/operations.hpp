@@ -1,6 +1,7 @@
 #ifndef GOINTERPRETER_INTERPRETER_OPERATIONS_HPP
 #define GOINTERPRETER_INTERPRETER_OPERATIONS_HPP
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -9,8 +10,9 @@ class Value; // need to hoist this
 class Select
 {
 public:
-    virtual Value *select(std::string id) = 0;
-    virtual void setSelect(std::string id, Value *newValue) = 0;
+    virtual Value *select(long index) = 0;
+    // Address of the field, stores write it directly
+    virtual Value **selectSlot(long index) = 0;
 };
 
 class Index
@@ -18,6 +20,8 @@ class Index
 public:
     virtual Value *index(Value *index) = 0;
     virtual void setIndex(Value *index, Value *newValue) = 0;
+    // Address of the element, stores and compound assignments write it directly
+    virtual Value **indexSlot(Value *index) = 0;
 };
 
 class SimpleSlice
@@ -34,10 +38,43 @@ public:
     virtual Value *fullSlice(Value *low, Value *high, Value *max) = 0;
 };
 
+/**
+ * Arguments of a call, a window onto the caller's operand stack. It is only
+ * valid until something is pushed onto that stack, callees bind it first.
+ */
+struct Arguments
+{
+    Value **values;
+    long size;
+
+    Value *operator[](long i) const { return values[i]; }
+    Value **begin() const { return values; }
+    Value **end() const { return values + size; }
+};
+
+/**
+ * Integers of any width. Indices, slice bounds, shift counts and
+ * conversions read them as a long.
+ */
+class Integer
+{
+public:
+    virtual long getInt() = 0;
+    // `value` wrapped to the width of this integer's type
+    virtual Value *withInt(long value) = 0;
+};
+
+class Increment
+{
+public:
+    // Value of `++` and `--`, this value plus `delta`
+    virtual Value *increment(long delta) = 0;
+};
+
 class Call
 {
 public:
-    virtual Value *call(std::vector<Value *> arguments) = 0;
+    virtual Value *call(Arguments arguments) = 0;
 };
 
 class UnaryPlus
@@ -91,37 +128,44 @@ public:
 class Equal
 {
 public:
-    virtual Value *equal(Value *other) = 0;
+    virtual bool equal(Value *other) = 0;
+};
+
+// Values that are equal hash the same, map keys are hashed with it
+class Hash
+{
+public:
+    virtual size_t hash() = 0;
 };
 
 class NotEqual
 {
 public:
-    virtual Value *notEqual(Value *other) = 0;
+    virtual bool notEqual(Value *other) = 0;
 };
 
 class LessThan
 {
 public:
-    virtual Value *lessThan(Value *other) = 0;
+    virtual bool lessThan(Value *other) = 0;
 };
 
 class LessThanEqual
 {
 public:
-    virtual Value *lessThanEqual(Value *other) = 0;
+    virtual bool lessThanEqual(Value *other) = 0;
 };
 
 class GreaterThan
 {
 public:
-    virtual Value *greaterThan(Value *other) = 0;
+    virtual bool greaterThan(Value *other) = 0;
 };
 
 class GreaterThanEqual
 {
 public:
-    virtual Value *greaterThanEqual(Value *other) = 0;
+    virtual bool greaterThanEqual(Value *other) = 0;
 };
 
 class ShiftLeft
@@ -0,0 +1,31 @@
+#ifndef GOINTERPRETER_INTERPRETER_STRING_KERNELS_HPP
+#define GOINTERPRETER_INTERPRETER_STRING_KERNELS_HPP
+
+/**
+ * Byte string kernels behind StringValue and the string natives. The
+ * widest implementation the CPU supports (AVX2, SSE2 or scalar) is picked
+ * on first use.
+ */
+namespace StringKernels {
+
+    // Sign of the first differing byte, compared unsigned, 0 if equal
+    int compare(const char *lhs, const char *rhs, long size);
+    bool equal(const char *lhs, const char *rhs, long size);
+
+    // Copies `source` without its NUL bytes, returns the copied size
+    long stripNul(const char *source, long size, char *destination);
+
+    // Position of the first occurrence of `needle`, -1 if there is none
+    long find(const char *haystack, long size, const char *needle, long needleSize);
+
+    // Portable implementations, for comparison
+    namespace Scalar {
+        int compare(const char *lhs, const char *rhs, long size);
+        bool equal(const char *lhs, const char *rhs, long size);
+        long stripNul(const char *source, long size, char *destination);
+        long find(const char *haystack, long size, const char *needle, long needleSize);
+    }
+
+}; // namespace StringKernels
+
+#endif // GOINTERPRETER_INTERPRETER_STRING_KERNELS_HPP
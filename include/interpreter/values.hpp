@@ -1,14 +1,20 @@
 #ifndef GOINTERPRETER_INTERPRETER_VALUES_HPP
 #define GOINTERPRETER_INTERPRETER_VALUES_HPP
 
+#include <cstdint>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <functional> 
+#include <span>
 #include <stdexcept>
 
 #include "interpreter/operations.hpp"
+#include "utils/atom.hpp"
 #include "utils/instanceof.hpp"
 
+class Layout;
+
 class Value
 {
 protected:
@@ -16,42 +22,60 @@ protected:
 
 public:
     virtual Value *getValue();
+
+    // Copy on write, see Aggregate, the other values are immutable or references and ignore it.
+    // The value a new variable, element, field or cell holding it stores
+    virtual Value *hold();
+    // One of its holders stores another value
+    virtual void release();
+    // This value if its holder is the only one, else a copy for it. `parent` is the value it is an element or field of
+    virtual Value *owned(Value *parent);
+    // Something points into it
+    virtual void pin();
+
     virtual ~Value() = default;
 };
 
-class BoolValue : public Value, public LogicalNot, public LogicalOr, public LogicalAnd, public Equal, public NotEqual
+class BoolValue : public Value, public LogicalNot, public LogicalOr, public LogicalAnd, public Equal, public Hash, public NotEqual
 {
 public:
     BoolValue(bool value);
     ~BoolValue() = default;
     bool getBool();
 
+    // Shared `true` and `false`, comparisons and logic never allocate
+    static BoolValue *of(bool value);
+
     Value *logicalNot() override;
     Value *logicalOr(Value *other) override;
     Value *logicalAnd(Value *other) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
 
 private:
     bool value;
 };
 
-class IntValue : public Value, public UnaryPlus, public Negate, public BitwiseNot, public Equal, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public ShiftLeft, public ShiftRight, public Add, public Subtract, public BitwiseOr, public BitwiseXOr, public BitwiseAnd, public Multiply, public Divide, public Modulo
+class IntValue : public Value, public Integer, public UnaryPlus, public Negate, public BitwiseNot, public Increment, public Equal, public Hash, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public ShiftLeft, public ShiftRight, public Add, public Subtract, public BitwiseOr, public BitwiseXOr, public BitwiseAnd, public Multiply, public Divide, public Modulo
 {
 public:
     IntValue(long value);
     ~IntValue() = default;
-    long getInt();
+    long getInt() final;
+    Value *withInt(long value) override;
 
     Value *unaryPlus() override;
     Value *negate() override;
     Value *bitwiseNot() override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
-    Value *lessThan(Value *other) override;
-    Value *greaterThan(Value *other) override;
-    Value *lessThanEqual(Value *other) override;
-    Value *greaterThanEqual(Value *other) override;
+    Value *increment(long delta) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+    bool lessThan(Value *other) override;
+    bool greaterThan(Value *other) override;
+    bool lessThanEqual(Value *other) override;
+    bool greaterThanEqual(Value *other) override;
     Value *shiftLeft(Value *other) override;
     Value *shiftRight(Value *other) override;
     Value *add(Value *other) override;
@@ -67,7 +91,66 @@ private:
     long value;
 };
 
-class Float32Value : public Value, public UnaryPlus, public Negate, public Equal, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add, public Subtract, public Multiply, public Divide
+/**
+ * Element type whose slices store their elements unboxed, ints given for
+ * it in literals and declarations are converted to it
+ */
+class Packed
+{
+public:
+    // Slice of `values`, integers of any width
+    virtual Value *packedSlice(const std::vector<Value *>& values) = 0;
+};
+
+/**
+ * Integer of one of Go's sized types, T is int8_t to int64_t or uint8_t to
+ * uint64_t. The kernels are instantiated once per width and wrap around
+ * like Go's do, an int operand is converted to T first.
+ */
+template<typename T>
+class SizedIntValue : public Value, public Integer, public Packed, public UnaryPlus, public Negate, public BitwiseNot, public Increment, public Equal, public Hash, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public ShiftLeft, public ShiftRight, public Add, public Subtract, public BitwiseOr, public BitwiseXOr, public BitwiseAnd, public Multiply, public Divide, public Modulo
+{
+public:
+    SizedIntValue(T value);
+    ~SizedIntValue() = default;
+    T get();
+
+    // Shared for the 8 bit types, whose 256 values are made once
+    static SizedIntValue *of(T value);
+
+    long getInt() override;
+    Value *withInt(long value) override;
+    Value *packedSlice(const std::vector<Value *>& values) override;
+    Value *unaryPlus() override;
+    Value *negate() override;
+    Value *bitwiseNot() override;
+    Value *increment(long delta) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+    bool lessThan(Value *other) override;
+    bool greaterThan(Value *other) override;
+    bool lessThanEqual(Value *other) override;
+    bool greaterThanEqual(Value *other) override;
+    Value *shiftLeft(Value *other) override;
+    Value *shiftRight(Value *other) override;
+    Value *add(Value *other) override;
+    Value *subtract(Value *other) override;
+    Value *bitwiseOr(Value *other) override;
+    Value *bitwiseXOr(Value *other) override;
+    Value *bitwiseAnd(Value *other) override;
+    Value *multiply(Value *other) override;
+    Value *divide(Value *other) override;
+    Value *modulo(Value *other) override;
+
+private:
+    // The other operand as a T, it is of this type or an int
+    static T operand(Value *other);
+
+    T value;
+};
+
+class Float32Value : public Value, public UnaryPlus, public Negate, public Increment, public Equal, public Hash, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add, public Subtract, public Multiply, public Divide
 {
 public:
     Float32Value(float value);
@@ -76,12 +159,14 @@ public:
 
     Value *unaryPlus() override;
     Value *negate() override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
-    Value *lessThan(Value *other) override;
-    Value *greaterThan(Value *other) override;
-    Value *lessThanEqual(Value *other) override;
-    Value *greaterThanEqual(Value *other) override;
+    Value *increment(long delta) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+    bool lessThan(Value *other) override;
+    bool greaterThan(Value *other) override;
+    bool lessThanEqual(Value *other) override;
+    bool greaterThanEqual(Value *other) override;
     Value *add(Value *other) override;
     Value *subtract(Value *other) override;
     Value *multiply(Value *other) override;
@@ -91,19 +176,23 @@ private:
     float value;
 };
 
-class RuneValue : public Value, public Equal, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add, public Subtract, public Multiply, public Divide
+class RuneValue : public Value, public Integer, public Increment, public Equal, public Hash, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add, public Subtract, public Multiply, public Divide
 {
 public:
     RuneValue(char value);
     ~RuneValue() = default;
     char getChar();
 
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
-    Value *lessThan(Value *other) override;
-    Value *greaterThan(Value *other) override;
-    Value *lessThanEqual(Value *other) override;
-    Value *greaterThanEqual(Value *other) override;
+    long getInt() override;
+    Value *withInt(long value) override;
+    Value *increment(long delta) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+    bool lessThan(Value *other) override;
+    bool greaterThan(Value *other) override;
+    bool lessThanEqual(Value *other) override;
+    bool greaterThanEqual(Value *other) override;
     Value *add(Value *other) override;
     Value *subtract(Value *other) override;
     Value *multiply(Value *other) override;
@@ -113,53 +202,157 @@ private:
     char value;
 };
 
-class StringValue : public Value, public Index, public SimpleSlice, public FullSlice, public Equal, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add
+/**
+ * Immutable string, a view on a reference counted buffer. Short strings
+ * are stored inline, slices share the buffer of the string they come from.
+ */
+class StringValue : public Value, public Index, public SimpleSlice, public FullSlice, public Equal, public Hash, public NotEqual, public LessThan, public GreaterThan, public LessThanEqual, public GreaterThanEqual, public Add
 {
 public:
     typedef struct String { 
-        char * value; 
+        const char * value; 
         long size; 
     } String;
 
-    StringValue(char *value, long size);
+    StringValue(const char *value, long size);
     ~StringValue();
     String getString();
 
+    // One shared value per distinct literal, for the lifetime of the program
+    static StringValue *intern(const char *value, long size);
+
     static long compare(StringValue *lhs, StringValue *rhs);
+    static bool equals(StringValue *lhs, StringValue *rhs);
 
     Value *index(Value *index) override;
     void setIndex(Value *index, Value *newValue) override;
+    Value **indexSlot(Value *index) override;
     Value *simpleSlice(Value *low, Value *high) override;
     Value *fullSlice(Value *low, Value *high, Value *max) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
-    Value *lessThan(Value *other) override;
-    Value *greaterThan(Value *other) override;
-    Value *lessThanEqual(Value *other) override;
-    Value *greaterThanEqual(Value *other) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+    bool lessThan(Value *other) override;
+    bool greaterThan(Value *other) override;
+    bool lessThanEqual(Value *other) override;
+    bool greaterThanEqual(Value *other) override;
     Value *add(Value *other) override;
 
 private:
-    char *value;
+    // Bytes past `used` belong to nobody, so the string ending at `used` may append there
+    typedef struct Buffer {
+        long references;
+        long used;
+        long capacity;
+        char *bytes;
+    } Buffer;
+
+    static constexpr long INLINE_SIZE = 16;
+
+    StringValue(Buffer *buffer, long offset, long size);
+    const char *data() const;
+    Value *slice(long low, long high);
+
     long size;
+    Buffer *buffer; // nullptr when the bytes are inline
+    union {
+        char inlined[INLINE_SIZE];
+        long offset;
+    };
 };
 
-class ArrayValue : public Value, public Index, public SimpleSlice, public FullSlice, public Equal, public NotEqual
+/**
+ * Array or struct, a value in Go that is not copied when it is passed or
+ * assigned. It counts its holders instead, and the interpreter asks for an
+ * owned value before writing to one: with several holders it gets a copy,
+ * which shares the elements, and stores it in place of the shared one.
+ * Values pointed into are pinned, new holders get a copy of them right away.
+ */
+class Aggregate : public Value
 {
 public:
-    ArrayValue(std::vector<Value *> values);
+    Value *hold() override;
+    void release() override;
+    Value *owned(Value *parent) override;
+    // Pins the aggregates holding this one too, the ones `owned` saw last
+    void pin() override;
+
+protected:
+    Aggregate() = default;
+    // Stored inside `parent`, pinned there from the start
+    explicit Aggregate(Value *parent);
+    // Copy sharing the elements, which it holds once more
+    virtual Aggregate *copy() = 0;
+    static std::vector<Value *> held(std::span<Value * const> values);
+    // Whether a holder still stores this value
+    bool isHeld();
+
+private:
+    long holders = 0;
+    bool pinned = false;
+    Value *parent = nullptr;
+};
+
+/**
+ * Compared and hashed by the layout of its type, see Layout. An array of
+ * arrays of one length, which are no grids themselves, is a grid: the
+ * elements of its rows are stored row-major in one buffer, and a row is a
+ * view into that buffer, made when it is first asked for. Views are pinned
+ * to their grid, a new holder of a row gets a copy of it.
+ */
+class ArrayValue : public Aggregate, public Index, public SimpleSlice, public FullSlice, public Equal, public Hash, public NotEqual
+{
+public:
+    ArrayValue(std::vector<Value *> values, const Layout *layout);
     ~ArrayValue() = default;
-    std::vector<Value *> getArray();
+    // Array of `values`, a grid holding the elements of the rows instead of the rows if they make one
+    static ArrayValue *of(std::vector<Value *> values, const Layout *layout);
+    std::span<Value *> getArray();
+    // Length of the rows of a grid, 0 for other arrays
+    long getColumns();
+    // `index`, throws if it is out of range
+    long checked(long index);
+    // `index`, throws if it is out of range of the rows of a grid
+    long checkedColumn(long index);
+    // Without bounds check, for indices the optimizer proved in range
+    Value *at(long index);
+    // nullptr for a row of a grid, which is stored through setIndex
+    Value **slotAt(long index);
+    // Element `column` of row `row` of a grid, without bounds check
+    Value *cellAt(long row, long column);
+    // Stores the elements of `newValue` into row `row` of a grid, which holds them
+    void setRow(long row, Value *newValue);
 
     Value *index(Value *index) override;
     void setIndex(Value *index, Value *newValue) override;
+    Value **indexSlot(Value *index) override;
     Value *simpleSlice(Value *low, Value *high) override;
     Value *fullSlice(Value *low, Value *high, Value *max) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
+
+protected:
+    Aggregate *copy() override;
 
 private:
-    std::vector<Value *> values;
+    // Grid of `cells`, rows of `columns` elements one after the other
+    ArrayValue(std::vector<Value *> cells, long columns, const Layout *layout);
+    // View of row `row` of `grid`
+    ArrayValue(ArrayValue *grid, long row);
+
+    static long checked(long index, long size);
+    long checked(Value *index);
+    Value *row(long index);
+    // Slice of copies of some of the elements, packed if they are sized integers
+    Value *slice(const std::vector<Value *>& elements);
+
+    std::vector<Value *> values; // The elements, the views of the rows of a grid, nullptr until asked for
+    std::vector<Value *> cells;  // The elements of the rows of a grid
+    Value **elements;            // `values`, the cells of its row for a view
+    long size;
+    long columns = 0;
+    const Layout *layout;
 };
 
 class SliceValue : public Value, public Index, public SimpleSlice, public FullSlice, public Equal, public NotEqual
@@ -171,113 +364,156 @@ public:
 
     Value *index(Value *index) override;
     void setIndex(Value *index, Value *newValue) override;
+    Value **indexSlot(Value *index) override;
     Value *simpleSlice(Value *low, Value *high) override;
     Value *fullSlice(Value *low, Value *high, Value *max) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
+    bool equal(Value *other) override;
+    bool notEqual(Value *other) override;
 
 private:
     std::vector<Value *> values;
 };
 
-class StructValue : public Value, public Select, public Equal, public NotEqual
+/**
+ * Slice of sized integers stored unboxed, a []uint8 takes one byte per
+ * element. Elements are boxed when read, they have no slot: stores go
+ * through `setIndex`, and their address can not be taken.
+ */
+template<typename T>
+class PackedSliceValue : public Value, public Index, public SimpleSlice, public FullSlice, public Equal, public NotEqual
 {
 public:
-    StructValue(std::map<std::string, Value *> fields);
-    ~StructValue() = default;
+    PackedSliceValue(std::vector<T> values);
+    ~PackedSliceValue() = default;
 
-    Value *select(std::string id) override;
-    void setSelect(std::string id, Value *newValue) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
+    Value *index(Value *index) override;
+    void setIndex(Value *index, Value *newValue) override;
+    // Always nullptr, there is no boxed element to point at
+    Value **indexSlot(Value *index) override;
+    Value *simpleSlice(Value *low, Value *high) override;
+    Value *fullSlice(Value *low, Value *high, Value *max) override;
+    bool equal(Value *other) override;
+    bool notEqual(Value *other) override;
 
 private:
-    std::map<std::string, Value *> fields;
+    long checked(Value *index);
+
+    std::vector<T> values;
 };
 
-// TODO:
-// class PointerValue : public Value, public Dereference, public Equal, public NotEqual
-// {
-// public:
-//     PointerValue() = default;
-//     ~PointerValue() = default;
+/**
+ * Fields are stored in declaration order, selectors are resolved to an index
+ * by the validator. Compared and hashed by the layout of its type.
+ */
+class StructValue : public Aggregate, public Select, public Equal, public Hash, public NotEqual
+{
+public:
+    StructValue(std::vector<Value *> fields, const Layout *layout);
+    ~StructValue() = default;
 
-//     Value *dereference() override;
-//     Value *equal(Value *other) override;
-//     Value *notEqual(Value *other) override;
+    const std::vector<Value *>& getFields();
 
-// private:
-// };
+    Value *select(long index) override;
+    Value **selectSlot(long index) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
 
-class FunctionValue : public Value, public Call
+protected:
+    Aggregate *copy() override;
+
+private:
+    std::vector<Value *> fields;
+    const Layout *layout;
+};
+
+/**
+ * Address of a variable, an element, a field or a heap cell. Reads and
+ * writes go through it with no other indirection, selectors reach the
+ * struct it points at, `p.f` is `(*p).f`.
+ */
+class PointerValue : public Value, public Dereference, public Select, public Equal, public Hash, public NotEqual
 {
 public:
-    FunctionValue(const std::map<std::string, Value *>& closure, const std::function<Value *(std::map<std::string, Value *> closure, std::vector<Value *> arguments)>& call);
-    ~FunctionValue() = default;
+    PointerValue(Value **cell);
+    ~PointerValue() = default;
+    Value **getCell();
+
+    // The shared nil pointer, it points nowhere
+    static PointerValue *nil();
 
-    Value *call(std::vector<Value *> arguments) override;
+    Value *dereference() override;
+    Value *select(long index) override;
+    Value **selectSlot(long index) override;
+    bool equal(Value *other) override;
+    size_t hash() override;
+    bool notEqual(Value *other) override;
 
 private:
-    const std::function<Value *(std::map<std::string, Value *> closure, std::vector<Value *> arguments)> _call;
-    const std::map<std::string, Value *> _closure;
+    Value **cell;
 };
 
-class MapValue : public Value, public Index
+class FunctionValue : public Value, public Call
 {
 public:
-    MapValue(std::vector<std::pair<Value *, Value *>> fields);
-    ~MapValue() = default;
+    FunctionValue(const std::map<Atom, Value *>& closure, const std::function<Value *(const std::map<Atom, Value *>& closure, Arguments arguments)>& call);
+    ~FunctionValue() = default;
 
-    Value *index(Value *index) override;
-    void setIndex(Value *index, Value *newValue) override;
+    Value *call(Arguments arguments) override;
 
 private:
-    std::vector<std::pair<Value *, Value *>> fields;
+    const std::function<Value *(const std::map<Atom, Value *>& closure, Arguments arguments)> _call;
+    const std::map<Atom, Value *> _closure;
 };
 
-class ReferenceValue : public Value, public Index, public Select, public SimpleSlice, public FullSlice, public Call, public UnaryPlus, public Negate, public LogicalNot, public BitwiseNot, public Dereference, public Reference, public LogicalOr, public LogicalAnd, public Equal, public NotEqual, public LessThan, public LessThanEqual, public GreaterThan, public GreaterThanEqual, public ShiftLeft, public ShiftRight, public Add, public Subtract, public BitwiseOr, public BitwiseXOr, public BitwiseAnd, public Multiply, public Divide, public Modulo
+/**
+ * Hash map from scalar keys to values. Entries are nodes that never move,
+ * so a store or an update holds the address of its entry after one probe.
+ */
+class MapValue : public Value, public Index
 {
 public:
-    ReferenceValue(const std::function<Value* ()> getter, const std::function<void (Value *)> setter);
-    ~ReferenceValue() = default;
-    Value *getValue() override;
-    void setValue(Value *value);
+    // `zero` is read for missing keys, nullptr when the element type has no zero value
+    MapValue(Value *zero);
+    ~MapValue() = default;
 
-    Value *select(std::string id) override;
-    void setSelect(std::string id, Value *newValue) override;
     Value *index(Value *index) override;
     void setIndex(Value *index, Value *newValue) override;
-    Value *simpleSlice(Value *low, Value *high) override;
-    Value *fullSlice(Value *low, Value *high, Value *max) override;
-    Value *call(std::vector<Value *> parameters) override;
-    Value *unaryPlus() override;
-    Value *negate() override;
-    Value *logicalNot() override;
-    Value *bitwiseNot() override;
-    Value *dereference() override;
-    Value *reference() override;
-    Value *logicalOr(Value *other) override;
-    Value *logicalAnd(Value *other) override;
-    Value *equal(Value *other) override;
-    Value *notEqual(Value *other) override;
-    Value *lessThan(Value *other) override;
-    Value *greaterThan(Value *other) override;
-    Value *lessThanEqual(Value *other) override;
-    Value *greaterThanEqual(Value *other) override;
-    Value *shiftLeft(Value *other) override;
-    Value *shiftRight(Value *other) override;
-    Value *add(Value *other) override;
-    Value *subtract(Value *other) override;
-    Value *bitwiseOr(Value *other) override;
-    Value *bitwiseXOr(Value *other) override;
-    Value *bitwiseAnd(Value *other) override;
-    Value *multiply(Value *other) override;
-    Value *divide(Value *other) override;
-    Value *modulo(Value *other) override;
+    // Inserts the zero value for a missing key
+    Value **indexSlot(Value *index) override;
 
 private:
-    const std::function<Value* ()> getter; 
-    const std::function<void (Value *)> setter;
+    struct KeyHash
+    {
+        size_t operator()(Value *key) const;
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(Value *lhs, Value *rhs) const;
+    };
+
+    Value *zero;
+    std::unordered_map<Value *, Value *, KeyHash, KeyEqual> entries;
 };
 
+// Instantiated in sized_ints.cpp, one set of kernels per width
+extern template class SizedIntValue<int8_t>;
+extern template class SizedIntValue<int16_t>;
+extern template class SizedIntValue<int32_t>;
+extern template class SizedIntValue<int64_t>;
+extern template class SizedIntValue<uint8_t>;
+extern template class SizedIntValue<uint16_t>;
+extern template class SizedIntValue<uint32_t>;
+extern template class SizedIntValue<uint64_t>;
+
+extern template class PackedSliceValue<int8_t>;
+extern template class PackedSliceValue<int16_t>;
+extern template class PackedSliceValue<int32_t>;
+extern template class PackedSliceValue<int64_t>;
+extern template class PackedSliceValue<uint8_t>;
+extern template class PackedSliceValue<uint16_t>;
+extern template class PackedSliceValue<uint32_t>;
+extern template class PackedSliceValue<uint64_t>;
+
 #endif // GOINTERPRETER_INTERPRETER_VALUES_HPP
@@ -9,7 +9,13 @@
 #include "lexing/lexer.hpp"
 #include "ast/ast.hpp"
 #include "validation/validator.hpp"
+#include "validation/escape_analysis.hpp"
 #include "interpreter/interpreter.hpp"
+#include "interpreter/histogram.hpp"
+#include "optimization/optimizer.hpp"
+#include "ast/printer.hpp"
+#include "utils/thread.hpp"
+#include "utils/counters.hpp"
 extern int yyparse();
 extern AST::Node *tree;
 
@@ -0,0 +1,151 @@
+#ifndef GOINTERPRETER_NATIVES_NATIVES_HPP
+#define GOINTERPRETER_NATIVES_NATIVES_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "interpreter/values.hpp"
+#include "validation/types.hpp"
+
+/**
+ * Maps a C++ type onto the validator type and the runtime value used for it.
+ * Only the specialisations below can be used in a native signature.
+ */
+template<typename T>
+struct NativeType;
+
+template<>
+struct NativeType<bool>
+{
+    static Type *type() { return Types::get<BoolType>(); }
+    static bool unbox(Value *value) { return static_cast<BoolValue *>(value)->getBool(); }
+    static Value *box(bool value) { return BoolValue::of(value); }
+};
+
+template<>
+struct NativeType<long>
+{
+    static Type *type() { return Types::get<IntType>(); }
+    static long unbox(Value *value) { return static_cast<IntValue *>(value)->getInt(); }
+    static Value *box(long value) { return new IntValue{value}; }
+};
+
+template<>
+struct NativeType<float>
+{
+    static Type *type() { return Types::get<Float32Type>(); }
+    static float unbox(Value *value) { return static_cast<Float32Value *>(value)->getFloat(); }
+    static Value *box(float value) { return new Float32Value{value}; }
+};
+
+template<>
+struct NativeType<char>
+{
+    static Type *type() { return Types::get<RuneType>(); }
+    static char unbox(Value *value) { return static_cast<RuneValue *>(value)->getChar(); }
+    static Value *box(char value) { return new RuneValue{value}; }
+};
+
+template<>
+struct NativeType<StringValue::String>
+{
+    static Type *type() { return Types::get<StringType>(); }
+    static StringValue::String unbox(Value *value) { return static_cast<StringValue *>(value)->getString(); }
+    static Value *box(StringValue::String value) { return new StringValue{value.value, value.size}; }
+};
+
+/**
+ * Function value backed by a host function, the arguments are unboxed by a
+ * thunk generated from the signature. The validator guarantees the argument
+ * types, so no runtime type checks are done.
+ */
+class NativeFunctionValue : public Value, public Call
+{
+public:
+    typedef Value *(*Thunk)(void (*function)(), Arguments arguments);
+
+    NativeFunctionValue(Thunk thunk, void (*function)());
+    ~NativeFunctionValue() = default;
+
+    Value *call(Arguments arguments) override;
+
+private:
+    Thunk thunk;
+    void (*function)();
+};
+
+template<typename Signature>
+struct NativeBinding;
+
+template<typename R, typename... Args>
+struct NativeBinding<R(Args...)>
+{
+    typedef R (*Function)(Args...);
+
+    static Type *signature()
+    {
+        std::vector<std::pair<Atom, Type *>> parameters{std::make_pair("", NativeType<Args>::type())...};
+        std::vector<std::pair<Atom, Type *>> returns;
+
+        if constexpr (!std::is_void_v<R>) {
+            returns.push_back(std::make_pair("", NativeType<R>::type()));
+        }
+
+        return Types::get<FunctionType>(parameters, returns);
+    }
+
+    static Value *thunk(void (*function)(), Arguments arguments)
+    {
+        return invoke(reinterpret_cast<Function>(function), arguments, std::index_sequence_for<Args...>{});
+    }
+
+private:
+    template<std::size_t... I>
+    static Value *invoke(Function function, Arguments arguments, std::index_sequence<I...>)
+    {
+        if constexpr (std::is_void_v<R>) {
+            function(NativeType<Args>::unbox(arguments[I])...);
+            return nullptr;
+        } else {
+            return NativeType<R>::box(function(NativeType<Args>::unbox(arguments[I])...));
+        }
+    }
+};
+
+/**
+ * Registry of host functions, shared by the validator (signatures) and the
+ * interpreter (values), so a native only has to be declared once.
+ */
+class Natives
+{
+public:
+    struct Native
+    {
+        std::string id;
+        Type *(*signature)();
+        NativeFunctionValue::Thunk thunk;
+        void (*function)();
+    };
+
+    // `function` has to be convertible to a plain function pointer (captureless lambda)
+    template<typename Signature, typename F>
+    static void registerNative(const std::string& id, F function)
+    {
+        typename NativeBinding<Signature>::Function pointer = function;
+
+        registry().push_back(Native{
+            id,
+            &NativeBinding<Signature>::signature,
+            &NativeBinding<Signature>::thunk,
+            reinterpret_cast<void (*)()>(pointer)});
+    }
+
+    static const std::vector<Native>& all();
+
+private:
+    static std::vector<Native>& registry();
+    static void registerBuiltins();
+};
+
+#endif // GOINTERPRETER_NATIVES_NATIVES_HPP
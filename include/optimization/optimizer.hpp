@@ -0,0 +1,264 @@
+#ifndef GOINTERPRETER_OPTIMIZATION_OPTIMIZER_HPP
+#define GOINTERPRETER_OPTIMIZATION_OPTIMIZER_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+#include "ast/ast.hpp"
+#include "ast/visitor.hpp"
+#include "utils/stack.hpp"
+
+/**
+ * Rebuilds a validated program: folds constant expressions, prunes
+ * unreachable if/switch arms, hoists literals into a constant pool and
+ * drops the bounds checks of array accesses proven in range.
+ * The original tree is left untouched.
+ */
+class Optimizer : public AST::Visitor
+{
+public:
+    // A lazy optimizer leaves function bodies out of the program, they wait for optimizeFunction
+    Optimizer(bool lazy = false);
+    ~Optimizer();
+
+    // Ownership of the rebuilt program goes to the caller
+    AST::Program *getProgram() const;
+    // Rebuilds function `id` once its body is validated, nullptr if that happened already.
+    // Ownership goes to the caller, the original tree must still be alive.
+    AST::FunctionDeclaration *optimizeFunction(Atom id);
+    long getConstantCount() const;
+    long getRemovedBoundsChecks() const;
+
+    // Program
+    void visitProgram(long size) override;
+
+    // Types
+    void visitBoolType() override;
+    void visitIntType() override;
+    void visitFloat32Type() override;
+    void visitRuneType() override;
+    void visitStringType() override;
+    void visitArrayType(long size) override;
+    void visitSliceType() override;
+    void visitStructType(std::vector<Atom> fields) override;
+    void visitPointerType() override;
+    void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
+    void visitMapType() override;
+    void visitCustomType(Atom id) override;
+
+    // Block
+    void visitBlock(AST::Visits visitStatements) override;
+
+    // Declarations
+    void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override;
+    void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override;
+    void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
+
+    // Statements
+    void visitExpressionStatement() override;
+    void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override;
+    void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override;
+    void visitIncDecStatement(AST::Visit visitTarget, long delta) override;
+    void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override;
+    void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override;
+    void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override;
+    void visitSwitchDefaultClause(AST::Visits visitStatements) override;
+    void visitReturnStatement(long size) override;
+    void visitBreakStatement() override;
+    void visitContinueStatement() override;
+    void visitEmptyStatement() override;
+    void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override;
+
+    // Expressions - Literals
+    void visitBoolExpression(bool value) override;
+    void visitIntExpression(long value) override;
+    void visitFloat32Expression(float value) override;
+    void visitRuneExpression(char value) override;
+    void visitStringExpression(char *value, long length) override;
+    void visitConstantExpression(long index, AST::Visit visitLiteral) override;
+
+    // Expressions - Rest
+    void visitIdentifierExpression(Atom id) override;
+    void visitTargetExpression() override;
+    void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+    void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitSelectExpression(Atom id, long& fieldIndex) override;
+    void visitIndexExpression(long& length, bool checked) override;
+    void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
+    void visitFullSliceExpression(bool lowDeclared) override;
+    void visitCallExpression(long size, long line, bool tailCall) override;
+    void visitConversionExpression() override;
+    void visitNewExpression(AST::Visit visitType) override;
+    void visitUnaryPlusExpression() override;
+    void visitUnaryNegateExpression() override;
+    void visitUnaryLogicalNotExpression() override;
+    void visitUnaryBitwiseNotExpression() override;
+    void visitUnaryDereferenceExpression() override;
+    void visitUnaryReferenceExpression(bool& escapes) override;
+    void visitBinaryLogicalOrExpression() override;
+    void visitBinaryLogicalAndExpression() override;
+    void visitBinaryEqualExpression() override;
+    void visitBinaryNotEqualExpression() override;
+    void visitBinaryLessThanExpression() override;
+    void visitBinaryLessThanEqualExpression() override;
+    void visitBinaryGreaterThanExpression() override;
+    void visitBinaryGreaterThanEqualExpression() override;
+    void visitBinaryShiftLeftExpression() override;
+    void visitBinaryShiftRightExpression() override;
+    void visitBinaryAddExpression() override;
+    void visitBinarySubtractExpression() override;
+    void visitBinaryBitwiseOrExpression() override;
+    void visitBinaryBitwiseXOrExpression() override;
+    void visitBinaryBitwiseAndExpression() override;
+    void visitBinaryMultiplyExpression() override;
+    void visitBinaryDivideExpression() override;
+    void visitBinaryModuloExpression() override;
+
+    // Stores
+    void visitIdentifierStore(Atom id) override;
+    void visitSelectStore(Atom id, long& fieldIndex) override;
+    void visitIndexStore(long& length, bool checked) override;
+    void visitDereferenceStore() override;
+    void visitLiteralStore() override;
+    void visitValueStore() override;
+
+    // Superinstructions
+    void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override;
+    void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override;
+    void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override;
+    void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override;
+
+    /**
+     * Compile time value of an expression, `None` if it is not constant
+     */
+    struct Constant
+    {
+        enum class Kind {
+            None,
+            Bool,
+            Int,
+            Float32,
+            Rune,
+            String,
+        };
+
+        Kind kind;
+        bool boolean;
+        long integer;
+        float floating;
+        char rune;
+        std::string string;
+
+        static Constant none();
+        bool equals(const Constant& other) const;
+    };
+
+private:
+    /**
+     * What an expression looks like, for recognising superinstructions
+     * and loop bounds
+     */
+    struct Shape
+    {
+        Atom local;   // The expression is this identifier
+        Atom stepped; // The expression is `stepped + step`
+        long step;
+        Atom bounded; // The expression is a comparison holding for `low <= bounded < high`
+        long low;
+        long high;
+    };
+
+    /**
+     * What a simple statement did to a local, `local = value` or `local += value`
+     */
+    struct Effect
+    {
+        Atom local;
+        bool assigned;
+        long value;
+    };
+
+    // An array access without bounds check, `check` puts it back
+    struct Access
+    {
+        Atom index;
+        std::function<void()> check;
+    };
+
+    /**
+     * A loop counter staying in [low, high) in the loop body, unless the
+     * body stores to it
+     */
+    struct Range
+    {
+        Atom local;
+        long low;
+        long high;
+        bool stored;
+        std::vector<Access> accesses;
+    };
+
+    // Bounds check elimination state of a function declaration or literal
+    struct Frame
+    {
+        std::set<Atom> locals;
+        std::set<Atom> addressed;     // A pointer can store to these
+        std::vector<Range> ranges;    // Loops around the current statement
+        std::vector<Access> accesses; // Proven by loops that ended
+    };
+
+    struct Clause
+    {
+        bool isDefault;
+        std::vector<AST::Expression *> expressions;
+        std::vector<Constant> labels;
+        std::vector<AST::Statement *> statements;
+    };
+
+    void pushExpression(AST::Expression *expression, const Shape& shape = Shape{"", "", 0});
+    void pushConstant(const Constant& constant);
+    AST::Expression *materialise(AST::Expression *expression, const Constant& constant);
+    AST::Expression *popExpression();
+    std::vector<AST::Expression *> popExpressions(long size);
+    AST::SimpleStatement *popSimpleStatement();
+    std::vector<AST::Statement *> collectStatements(AST::Visits visitStatements);
+    void foldUnary(AST::UnaryExpression::Operation operation);
+    void foldBinary(AST::BinaryExpression::Operation operation);
+    AST::SwitchTable *makeSwitchTable(const std::vector<Clause>& clauses);
+    void beginFrame();
+    void endFrame();
+    bool beginRange(const Effect& start, const Shape& condition, const Effect& step);
+    void endRange();
+    void store(Atom local);
+    // Whether the index on top of the stacks is in range of an array of `length`, `range` is the loop proving it
+    bool inBounds(long length, Range *&range);
+    void removeBoundsCheck(Range *range, std::function<void()> check);
+
+    bool lazy;
+    std::map<Atom, const std::function<void ()>> functionDeclarationOptimizers;
+
+    AST::Program *program;
+    std::map<std::string, long> pool;
+
+    Stack<AST::Type *> types;
+    Stack<AST::Expression *> expressions; // nullptr for constants that are not in the tree yet
+    Stack<Constant> constants;
+    Stack<Shape> shapes;
+    Stack<AST::Statement *> statements; // nullptr for statements that were removed
+    Stack<AST::TopLevelDeclaration *> declarations;
+    Stack<AST::Block *> blocks;
+    Stack<long> blockSizes;
+    Stack<Clause> clauses;
+
+    std::vector<Frame> frames;
+    std::vector<Atom> signatureLocals; // Parameters and named results of the last function type
+    Effect entry;                      // Effect of the statement before the one being visited
+    Effect effect;                     // Effect of the simple statement visited last
+    long removedBoundsChecks;
+};
+
+#endif // GOINTERPRETER_OPTIMIZATION_OPTIMIZER_HPP
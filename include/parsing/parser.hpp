@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.12-4996.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED
 # define YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED
-/* Enabling traces.  */
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
@@ -40,8 +45,7 @@
 extern int yydebug;
 #endif
 /* "%code requires" blocks.  */
-/* Line 2060 of yacc.c  */
-#line 13 "src/parsing/parser.y"
+#line 49 "src/parsing/parser.y"
 
     #include <string>
     #include <map>
@@ -54,68 +58,70 @@ extern int yydebug;
         int length;
     } str;
 
+#line 62 "include/parsing/parser.hpp"
 
-/* Line 2060 of yacc.c  */
-#line 60 "include/parsing/parser.hpp"
-
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     BOOL = 258,
-     INT = 259,
-     FLOAT32 = 260,
-     RUNE = 261,
-     STRING = 262,
-     STRUCT = 263,
-     FUNC = 264,
-     MAP = 265,
-     TYPE = 266,
-     VAR = 267,
-     SHORT_VAR_DECL = 268,
-     IF = 269,
-     ELSE = 270,
-     SWITCH = 271,
-     CASE = 272,
-     DEFAULT = 273,
-     RETURN = 274,
-     BREAK = 275,
-     CONTINUE = 276,
-     FOR = 277,
-     INC = 278,
-     DEC = 279,
-     ELLIPSIS = 280,
-     OR = 281,
-     AND = 282,
-     EQ = 283,
-     NEQ = 284,
-     LTE = 285,
-     GTE = 286,
-     SHIFT_LEFT = 287,
-     SHIFT_RIGHT = 288,
-     IDENTIFIER = 289,
-     INT_LITERAL = 290,
-     FLOAT_LITERAL = 291,
-     BOOL_LITERAL = 292,
-     RUNE_LITERAL = 293,
-     STRING_LITERAL = 294
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    BOOL = 258,                    /* BOOL  */
+    INT = 259,                     /* INT  */
+    FLOAT32 = 260,                 /* FLOAT32  */
+    RUNE = 261,                    /* RUNE  */
+    STRING = 262,                  /* STRING  */
+    STRUCT = 263,                  /* STRUCT  */
+    FUNC = 264,                    /* FUNC  */
+    MAP = 265,                     /* MAP  */
+    TYPE = 266,                    /* TYPE  */
+    VAR = 267,                     /* VAR  */
+    SHORT_VAR_DECL = 268,          /* SHORT_VAR_DECL  */
+    IF = 269,                      /* IF  */
+    ELSE = 270,                    /* ELSE  */
+    SWITCH = 271,                  /* SWITCH  */
+    CASE = 272,                    /* CASE  */
+    DEFAULT = 273,                 /* DEFAULT  */
+    RETURN = 274,                  /* RETURN  */
+    BREAK = 275,                   /* BREAK  */
+    CONTINUE = 276,                /* CONTINUE  */
+    FOR = 277,                     /* FOR  */
+    INC = 278,                     /* INC  */
+    DEC = 279,                     /* DEC  */
+    ELLIPSIS = 280,                /* ELLIPSIS  */
+    OR = 281,                      /* OR  */
+    AND = 282,                     /* AND  */
+    EQ = 283,                      /* EQ  */
+    NEQ = 284,                     /* NEQ  */
+    LTE = 285,                     /* LTE  */
+    GTE = 286,                     /* GTE  */
+    SHIFT_LEFT = 287,              /* SHIFT_LEFT  */
+    SHIFT_RIGHT = 288,             /* SHIFT_RIGHT  */
+    BODY = 289,                    /* BODY  */
+    IDENTIFIER = 290,              /* IDENTIFIER  */
+    INT_LITERAL = 291,             /* INT_LITERAL  */
+    FLOAT_LITERAL = 292,           /* FLOAT_LITERAL  */
+    BOOL_LITERAL = 293,            /* BOOL_LITERAL  */
+    RUNE_LITERAL = 294,            /* RUNE_LITERAL  */
+    STRING_LITERAL = 295           /* STRING_LITERAL  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-/* Line 2060 of yacc.c  */
-#line 26 "src/parsing/parser.y"
+#line 62 "src/parsing/parser.y"
 
-    int integer;
+    long integer;
     float floating;
     bool boolean;
     char rune;
-    char *identifier;
+    Atom identifier;
     str string;
 
     AST::Block *block;
@@ -135,47 +141,38 @@ typedef union YYSTYPE
 
     AST::Expression *expression;
     LinkedList<AST::Expression *> *expressions;
-    LinkedList<std::pair<std::string, AST::Expression *>> *keyed_expressions;
+    LinkedList<std::pair<Atom, AST::Expression *>> *keyed_expressions;
 
-    LinkedList<std::string> *id_list;
-    LinkedList<std::pair<std::string, AST::Type *>> *fields;
+    LinkedList<Atom> *id_list;
+    LinkedList<std::pair<Atom, AST::Type *>> *fields;
 
+#line 150 "include/parsing/parser.hpp"
 
-/* Line 2060 of yacc.c  */
-#line 146 "include/parsing/parser.hpp"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+/* Location type.  */
 #if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
 {
   int first_line;
   int first_column;
   int last_line;
   int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
+};
 # define YYLTYPE_IS_DECLARED 1
 # define YYLTYPE_IS_TRIVIAL 1
 #endif
 
+
 extern YYSTYPE yylval;
 extern YYLTYPE yylloc;
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
+
 int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
+
 
 #endif /* !YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED  */
@@ -0,0 +1,46 @@
+#ifndef GOINTERPRETER_UTILS_ATOM_HPP
+#define GOINTERPRETER_UTILS_ATOM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/**
+ * Interned identifier. Every distinct name is stored once in a global table
+ * and referred to by its 32-bit index, comparing and hashing atoms are
+ * integer operations. Atoms are trivially copyable so the parser can carry
+ * them in its value union, a value-initialised atom is the empty name.
+ */
+class Atom
+{
+public:
+    Atom() = default;
+    Atom(const char *name);
+    Atom(const std::string& name);
+
+    const std::string& str() const;
+    uint32_t id() const { return index; }
+    bool empty() const { return index == 0; }
+
+    // Atoms order by interning order, not alphabetically
+    bool operator==(const Atom& other) const { return index == other.index; }
+    bool operator<(const Atom& other) const { return index < other.index; }
+
+private:
+    uint32_t index;
+};
+
+inline std::string operator+(const std::string& lhs, const Atom& rhs) { return lhs + rhs.str(); }
+inline std::string operator+(const Atom& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const char *lhs, const Atom& rhs) { return lhs + rhs.str(); }
+inline std::string operator+(const Atom& lhs, const char *rhs) { return lhs.str() + rhs; }
+inline std::ostream& operator<<(std::ostream& out, const Atom& atom) { return out << atom.str(); }
+
+template<>
+struct std::hash<Atom>
+{
+    size_t operator()(const Atom& atom) const noexcept { return atom.id(); }
+};
+
+#endif // GOINTERPRETER_UTILS_ATOM_HPP
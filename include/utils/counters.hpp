@@ -0,0 +1,62 @@
+#ifndef GOINTERPRETER_UTILS_COUNTERS_HPP
+#define GOINTERPRETER_UTILS_COUNTERS_HPP
+
+#include <ostream>
+#include <string>
+
+/**
+ * Counters for the work the interpreter does itself (allocations, casts,
+ * symbol lookups) and a timeline of function calls. Only compiled in with
+ * GOINTERPRETER_COUNTERS, otherwise the macros below are no-ops.
+ */
+namespace Counters {
+
+#ifdef GOINTERPRETER_COUNTERS
+    constexpr bool enabled = true;
+#else
+    constexpr bool enabled = false;
+#endif
+
+    // `name` must be a string literal. Counters are keyed by its text, a
+    // literal in a header has an address in every translation unit.
+    void increment(const char *name);
+    void enter(const std::string& function);
+    void exit(const std::string& function);
+
+    // Traces a call from its construction to its destruction, which an exception thrown out of the call runs too
+    class Trace
+    {
+    public:
+        explicit Trace(std::string function);
+        ~Trace();
+
+        Trace(const Trace&) = delete;
+        Trace& operator=(const Trace&) = delete;
+
+    private:
+        std::string function;
+    };
+
+    void printSummary(std::ostream& out);
+    // Chrome trace_event JSON, open with chrome://tracing or Perfetto
+    void writeTrace(std::ostream& out);
+
+}; // namespace Counters
+
+#ifdef GOINTERPRETER_COUNTERS
+#define COUNT(name) Counters::increment(name)
+#define TRACE(function) Counters::Trace callTrace{function}
+#else
+#define COUNT(name) ((void) 0)
+#define TRACE(function) ((void) 0)
+#endif
+
+// dynamic_cast that shows up in the counters
+template<typename T, typename U>
+inline T counted_cast(U *value)
+{
+    COUNT("dynamic_cast");
+    return dynamic_cast<T>(value);
+}
+
+#endif // GOINTERPRETER_UTILS_COUNTERS_HPP
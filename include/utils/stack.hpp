@@ -15,6 +15,11 @@ public:
         return values.empty();
     }
 
+    long size() const
+    {
+        return values.size();
+    }
+
     T pop()
     {
         if (empty()) throw std::exception{};
@@ -41,6 +46,29 @@ public:
         return result;
     }
 
+    // The `amount` topmost values in push order, valid until the next push
+    T *window(long amount)
+    {
+        if (amount > size()) throw std::exception{};
+
+        return values.data() + values.size() - amount;
+    }
+
+    // The value `depth` places below the top
+    T peek(long depth)
+    {
+        if (depth >= size()) throw std::exception{};
+
+        return values[values.size() - 1 - depth];
+    }
+
+    void drop(long amount)
+    {
+        if (amount > size()) throw std::exception{};
+
+        values.resize(values.size() - amount);
+    }
+
     void push(T value)
     {
         values.push_back(value);
@@ -0,0 +1,48 @@
+#ifndef GOINTERPRETER_UTILS_THREAD_HPP
+#define GOINTERPRETER_UTILS_THREAD_HPP
+
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <pthread.h>
+
+/**
+ * Runs `body` on a thread with a native stack of `size` bytes and waits
+ * for it. The stack is only reserved, pages are committed as it grows.
+ * Exceptions thrown by `body` are rethrown on the calling thread.
+ */
+inline void runWithStack(size_t size, const std::function<void ()>& body)
+{
+    struct Task
+    {
+        const std::function<void ()>& body;
+        std::exception_ptr error;
+    } task{body, nullptr};
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, size);
+
+    pthread_t thread;
+    auto status = pthread_create(&thread, &attributes, [](void *argument) -> void * {
+        auto task = static_cast<Task *>(argument);
+
+        try {
+            task->body();
+        } catch (...) {
+            task->error = std::current_exception();
+        }
+
+        return nullptr;
+    }, &task);
+
+    pthread_attr_destroy(&attributes);
+
+    if (status != 0) throw std::runtime_error{"Can't reserve an interpreter stack of " + std::to_string(size) + " bytes"};
+
+    pthread_join(thread, nullptr);
+
+    if (task.error) std::rethrow_exception(task.error);
+}
+
+#endif // GOINTERPRETER_UTILS_THREAD_HPP
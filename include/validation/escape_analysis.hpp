@@ -0,0 +1,168 @@
+#ifndef GOINTERPRETER_VALIDATION_ESCAPE_ANALYSIS_HPP
+#define GOINTERPRETER_VALIDATION_ESCAPE_ANALYSIS_HPP
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "ast/visitor.hpp"
+#include "utils/stack.hpp"
+
+/**
+ * Clears the escape flag of every `&x` whose pointer can not outlive the
+ * frame of x, the interpreter then points into the frame instead of moving
+ * x to the heap. Pointers are followed through the locals they are assigned
+ * to. Anything else they flow into makes them escape: arguments, results,
+ * composite literals, stores that are not to a local, closures capturing
+ * the local holding them, and locals whose own address is taken.
+ * Runs on a validated tree, types are not needed.
+ */
+class EscapeAnalysis : public AST::Visitor
+{
+public:
+    EscapeAnalysis();
+
+    // Program
+    void visitProgram(long size) override;
+
+    // Types
+    void visitBoolType() override;
+    void visitIntType() override;
+    void visitFloat32Type() override;
+    void visitRuneType() override;
+    void visitStringType() override;
+    void visitArrayType(long size) override;
+    void visitSliceType() override;
+    void visitStructType(std::vector<Atom> fields) override;
+    void visitPointerType() override;
+    void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
+    void visitMapType() override;
+    void visitCustomType(Atom id) override;
+
+    // Block
+    void visitBlock(AST::Visits visitStatements) override;
+
+    // Declarations
+    void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override;
+    void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override;
+    void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
+
+    // Statements
+    void visitExpressionStatement() override;
+    void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override;
+    void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override;
+    void visitIncDecStatement(AST::Visit visitTarget, long delta) override;
+    void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override;
+    void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override;
+    void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override;
+    void visitSwitchDefaultClause(AST::Visits visitStatements) override;
+    void visitReturnStatement(long size) override;
+    void visitBreakStatement() override;
+    void visitContinueStatement() override;
+    void visitEmptyStatement() override;
+    void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override;
+
+    // Expressions - Literals
+    void visitBoolExpression(bool value) override;
+    void visitIntExpression(long value) override;
+    void visitFloat32Expression(float value) override;
+    void visitRuneExpression(char value) override;
+    void visitStringExpression(char *value, long length) override;
+    void visitConstantExpression(long index, AST::Visit visitLiteral) override;
+
+    // Expressions - Rest
+    void visitIdentifierExpression(Atom id) override;
+    void visitTargetExpression() override;
+    void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+    void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitSelectExpression(Atom id, long& fieldIndex) override;
+    void visitIndexExpression(long& length, bool checked) override;
+    void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
+    void visitFullSliceExpression(bool lowDeclared) override;
+    void visitCallExpression(long size, long line, bool tailCall) override;
+    void visitConversionExpression() override;
+    void visitNewExpression(AST::Visit visitType) override;
+    void visitUnaryPlusExpression() override;
+    void visitUnaryNegateExpression() override;
+    void visitUnaryLogicalNotExpression() override;
+    void visitUnaryBitwiseNotExpression() override;
+    void visitUnaryDereferenceExpression() override;
+    void visitUnaryReferenceExpression(bool& escapes) override;
+    void visitBinaryLogicalOrExpression() override;
+    void visitBinaryLogicalAndExpression() override;
+    void visitBinaryEqualExpression() override;
+    void visitBinaryNotEqualExpression() override;
+    void visitBinaryLessThanExpression() override;
+    void visitBinaryLessThanEqualExpression() override;
+    void visitBinaryGreaterThanExpression() override;
+    void visitBinaryGreaterThanEqualExpression() override;
+    void visitBinaryShiftLeftExpression() override;
+    void visitBinaryShiftRightExpression() override;
+    void visitBinaryAddExpression() override;
+    void visitBinarySubtractExpression() override;
+    void visitBinaryBitwiseOrExpression() override;
+    void visitBinaryBitwiseXOrExpression() override;
+    void visitBinaryBitwiseAndExpression() override;
+    void visitBinaryMultiplyExpression() override;
+    void visitBinaryDivideExpression() override;
+    void visitBinaryModuloExpression() override;
+
+    // Stores
+    void visitIdentifierStore(Atom id) override;
+    void visitSelectStore(Atom id, long& fieldIndex) override;
+    void visitIndexStore(long& length, bool checked) override;
+    void visitDereferenceStore() override;
+    void visitLiteralStore() override;
+    void visitValueStore() override;
+
+    // Superinstructions
+    void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override;
+    void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override;
+    void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override;
+    void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override;
+
+private:
+    // What a value can hold a pointer from: `&x` of the current function, by index, and locals it was read from
+    struct Sources
+    {
+        std::vector<long> references;
+        std::vector<Atom> locals;
+    };
+
+    // Where a store writes, only stores to locals are followed
+    struct Target
+    {
+        bool local;
+        Atom id;
+    };
+
+    struct Reference
+    {
+        bool *escapes;
+        bool escaped;
+    };
+
+    struct Function
+    {
+        std::set<Atom> locals;
+        std::vector<Reference> references;
+        std::map<Atom, Sources> flows; // Everything assigned to a local
+        std::set<Atom> leaked;         // Locals whose value escapes
+    };
+
+    // Declared in the current function or captured by it, a closure runs on its own copy
+    bool isLocal(Atom id) const;
+    void declare(Atom id);
+    void push();
+    void escape(const Sources& sources);
+    void store(const Target& target, const Sources& sources);
+    // Follows the leaked locals, then writes the escape flags of the innermost function
+    void finishFunction();
+
+    std::vector<Function> functions;
+    Stack<Sources> values;
+    Stack<Target> targets;
+};
+
+#endif // GOINTERPRETER_VALIDATION_ESCAPE_ANALYSIS_HPP
@@ -2,92 +2,271 @@
 #define GOINTERPRETER_VALIDATION_SCOPE_HPP
 
 #include <stdexcept>
-#include <iterator>
+#include <functional>
 #include <string>
 #include <vector>
+#include <deque>
 #include <map>
-#include <algorithm>
 
+#include "utils/atom.hpp"
+#include "utils/counters.hpp"
+
+/**
+ * Scoped name bindings. Every atom bound once gets a symbol in an
+ * open-addressing table, which owns the stack of its bindings, innermost last. Scopes are marks
+ * in an undo log of the bindings they pushed, so lookup, add and removeScope
+ * are amortised O(1). Scopes can be hidden from lookups without popping
+ * them, which is how a callee stops seeing its caller's locals. Bindings
+ * never move while they live, so the address of a value can be handed out.
+ */
 template<typename T>
 class SymbolTable
 {
 public:
-    SymbolTable() = default;
+    SymbolTable();
     ~SymbolTable() = default;
 
     void addScope();
     void removeScope();
+    // Hides the innermost `count` scopes from lookups until they are shown again
+    void hideScopes(long count);
+    void showScopes(long count);
 
-    bool contains(std::string& key) const;
-    bool scopeContains(std::string& key) const;
-    T get(const std::string& key) const;
-    void add(const std::string& key, T value);
+    bool contains(Atom key) const;
+    bool scopeContains(Atom key) const;
+    T get(Atom key) const;
+    void add(Atom key, T value);
+    // Replaces the value of the innermost visible binding, where add would shadow it
+    void set(Atom key, T value);
+    // Address of the innermost visible binding's value, valid until its scope is removed
+    T *slot(Atom key);
+    // Moves the innermost visible binding's value to a heap cell that outlives the scope
+    T *box(Atom key);
     std::vector<T> allValues();
-    std::map<std::string, T> getScope() const;
-    void addScope(std::map<std::string, T> scope);
+    std::map<Atom, T> getScope() const;
+    // Innermost binding of every name in the visible scopes above the global one, what a function literal closes over
+    std::map<Atom, T> getClosure() const;
+    void addScope(const std::map<Atom, T>& scope);
 
 private:
-    std::vector<std::map<std::string, T>> scopes;
+    static constexpr long EMPTY = -1;
+
+    struct Binding
+    {
+        T value;
+        long depth;
+        T *boxed; // Heap cell holding the value once its address escaped, nullptr before
+
+        T& current() { return boxed != nullptr ? *boxed : value; }
+        const T& current() const { return boxed != nullptr ? *boxed : value; }
+    };
+
+    struct Symbol
+    {
+        Atom name;
+        std::deque<Binding> bindings;
+    };
+
+    // Index of the symbol called `key`, EMPTY if it was never interned
+    long find(Atom key) const;
+    // Innermost binding of `key` in a visible scope, nullptr if there is none
+    const Binding *lookup(Atom key) const;
+    long intern(Atom key);
+    void grow();
+
+    std::deque<Symbol> symbols; // A deque, growing it moves no bindings
+    // Open-addressing slots holding indices into `symbols`, linear probing
+    std::vector<long> slots;
+    // Symbols in the order their bindings were pushed, `marks` split it in scopes
+    std::vector<long> undo;
+    std::vector<size_t> marks;
+    // Whether bindings made at each scope depth can be looked up
+    std::vector<bool> visible;
 };
 
+template<typename T>
+SymbolTable<T>::SymbolTable()
+    : slots(64, EMPTY), visible{true}
+{}
+
+template<typename T>
+long SymbolTable<T>::find(Atom key) const
+{
+    auto mask = slots.size() - 1;
+
+    for (auto slot = std::hash<Atom>{}(key) & mask; slots[slot] != EMPTY; slot = (slot + 1) & mask) {
+        if (symbols[slots[slot]].name == key) return slots[slot];
+    }
+
+    return EMPTY;
+}
+
+template<typename T>
+long SymbolTable<T>::intern(Atom key)
+{
+    auto mask = slots.size() - 1;
+    auto slot = std::hash<Atom>{}(key) & mask;
+
+    for (; slots[slot] != EMPTY; slot = (slot + 1) & mask) {
+        if (symbols[slots[slot]].name == key) return slots[slot];
+    }
+
+    long index = symbols.size();
+    symbols.push_back(Symbol{key, {}});
+    slots[slot] = index;
+
+    // Keep the load factor under one half
+    if (symbols.size() * 2 > slots.size()) grow();
+
+    return index;
+}
+
+template<typename T>
+void SymbolTable<T>::grow()
+{
+    slots.assign(slots.size() * 2, EMPTY);
+    auto mask = slots.size() - 1;
+
+    for (long index = 0; index < symbols.size(); ++index) {
+        auto slot = std::hash<Atom>{}(symbols[index].name) & mask;
+        while (slots[slot] != EMPTY) slot = (slot + 1) & mask;
+        slots[slot] = index;
+    }
+}
+
 template<typename T>
 void SymbolTable<T>::addScope()
 {
-    this->scopes.push_back(std::map<std::string, T>{});
+    COUNT("SymbolTable::addScope");
+    marks.push_back(undo.size());
+    visible.push_back(true);
 }
 
 template<typename T>
 void SymbolTable<T>::removeScope()
 {
-    this->scopes.pop_back();
+    COUNT("SymbolTable::removeScope");
+
+    for (auto i = undo.size(); i > marks.back(); --i) {
+        symbols[undo[i - 1]].bindings.pop_back();
+    }
+
+    undo.resize(marks.back());
+    marks.pop_back();
+    visible.pop_back();
 }
 
 template<typename T>
-bool SymbolTable<T>::contains(std::string& key) const
+void SymbolTable<T>::hideScopes(long count)
 {
-    auto _scopes = this->scopes;
+    for (long i = 0; i < count; ++i) visible[marks.size() - i] = false;
+}
 
-    std::reverse(_scopes.begin(), _scopes.end());
+template<typename T>
+void SymbolTable<T>::showScopes(long count)
+{
+    for (long i = 0; i < count; ++i) visible[marks.size() - i] = true;
+}
 
-    for (const auto scope : _scopes)
-    {
-        if (scope.contains(key))
-        {
-            return true;
-        }
+template<typename T>
+const typename SymbolTable<T>::Binding *SymbolTable<T>::lookup(Atom key) const
+{
+    auto index = find(key);
+    if (index == EMPTY) return nullptr;
+
+    const auto& bindings = symbols[index].bindings;
+
+    for (auto binding = bindings.rbegin(); binding != bindings.rend(); ++binding) {
+        if (visible[binding->depth]) return &*binding;
     }
 
-    return false;
+    return nullptr;
 }
 
 template<typename T>
-bool SymbolTable<T>::scopeContains(std::string& key) const
+bool SymbolTable<T>::contains(Atom key) const
 {
-    return scopes.back().contains(key);
+    return lookup(key) != nullptr;
 }
 
 template<typename T>
-T SymbolTable<T>::get(const std::string& key) const
+bool SymbolTable<T>::scopeContains(Atom key) const
 {
-    auto _scopes = this->scopes;
+    auto index = find(key);
+    return index != EMPTY && !symbols[index].bindings.empty() && symbols[index].bindings.back().depth == marks.size();
+}
 
-    std::reverse(_scopes.begin(), _scopes.end());
+template<typename T>
+T SymbolTable<T>::get(Atom key) const
+{
+    COUNT("SymbolTable::get");
 
-    for (auto scope : _scopes)
-    {
-        if (scope.contains(key))
-        {
-            return scope[key];
-        }
+    auto binding = lookup(key);
+
+    if (binding == nullptr) {
+        throw new std::out_of_range{key.str()};
+    }
+
+    return binding->current();
+}
+
+template<typename T>
+void SymbolTable<T>::set(Atom key, T value)
+{
+    auto binding = lookup(key);
+
+    if (binding == nullptr) {
+        throw new std::out_of_range{key.str()};
+    }
+
+    // The binding lives in a symbol this table owns, lookup is only const for its callers
+    const_cast<Binding *>(binding)->current() = value;
+}
+
+template<typename T>
+T *SymbolTable<T>::slot(Atom key)
+{
+    auto binding = lookup(key);
+
+    if (binding == nullptr) {
+        throw new std::out_of_range{key.str()};
+    }
+
+    return &const_cast<Binding *>(binding)->current();
+}
+
+template<typename T>
+T *SymbolTable<T>::box(Atom key)
+{
+    auto binding = const_cast<Binding *>(lookup(key));
+
+    if (binding == nullptr) {
+        throw new std::out_of_range{key.str()};
+    }
+
+    if (binding->boxed == nullptr) {
+        binding->boxed = new T{binding->value};
     }
 
-    throw new std::out_of_range{key};
+    return binding->boxed;
 }
 
 template<typename T>
-void SymbolTable<T>::add(const std::string& key, T value)
+void SymbolTable<T>::add(Atom key, T value)
 {
-    this->scopes.back()[key] = value;
+    auto index = intern(key);
+    auto& bindings = symbols[index].bindings;
+
+    // Rebinding in the same scope replaces, otherwise the outer binding is shadowed.
+    // A replaced variable is a new one, pointers to the old cell keep it.
+    if (!bindings.empty() && bindings.back().depth == marks.size()) {
+        bindings.back().value = value;
+        bindings.back().boxed = nullptr;
+        return;
+    }
+
+    bindings.push_back(Binding{value, static_cast<long>(marks.size()), nullptr});
+    undo.push_back(index);
 }
 
 template<typename T>
@@ -95,28 +274,56 @@ std::vector<T> SymbolTable<T>::allValues()
 {
     std::vector<T> result;
 
-    for (const auto scope : this->scopes)
+    for (const auto& symbol : symbols)
     {
-        for (const auto pair : scope)
+        for (const auto& binding : symbol.bindings)
         {
-            result.push_back(pair.second);
+            result.push_back(binding.current());
         }
     }
 
     return result;
 }
 
+template<typename T>
+std::map<Atom, T> SymbolTable<T>::getScope() const
+{
+    std::map<Atom, T> scope;
+
+    for (auto i = marks.back(); i < undo.size(); ++i) {
+        const auto& symbol = symbols[undo[i]];
+        scope[symbol.name] = symbol.bindings.back().current();
+    }
+
+    return scope;
+}
 
 template<typename T>
-std::map<std::string, T> SymbolTable<T>::getScope() const
+std::map<Atom, T> SymbolTable<T>::getClosure() const
 {
-    return scopes.back();
+    std::map<Atom, T> scope;
+
+    // The scopes of the current function, up to the first one hidden from it
+    for (auto depth = marks.size(); depth > 0 && visible[depth]; --depth) {
+        auto end = depth == marks.size() ? undo.size() : marks[depth];
+
+        for (auto i = marks[depth - 1]; i < end; ++i) {
+            const auto& symbol = symbols[undo[i]];
+            scope.try_emplace(symbol.name, lookup(symbol.name)->current());
+        }
+    }
+
+    return scope;
 }
 
 template<typename T>
-void SymbolTable<T>::addScope(std::map<std::string, T> scope)
+void SymbolTable<T>::addScope(const std::map<Atom, T>& scope)
 {
-    scopes.push_back(scope);
+    addScope();
+
+    for (const auto& pair : scope) {
+        add(pair.first, pair.second);
+    }
 }
 
-#endif // GOINTERPRETER_VALIDATION_SCOPE_HPP
\ No newline at end of file
+#endif // GOINTERPRETER_VALIDATION_SCOPE_HPP
@@ -7,21 +7,35 @@
 #include <sstream>
 #include <iterator>
 #include <map>
+#include <unordered_map>
+#include <utility>
 
+#include "utils/atom.hpp"
 #include "utils/instanceof.hpp"
 
+/**
+ * Validator type. Types are only created through `Types::get`, which hands
+ * out one canonical instance per structure, so `equals` is an address
+ * compare.
+ */
 class Type
 {
 public:
     virtual ~Type() = default;
-    virtual bool equals(const Type& other) const = 0;
-    virtual std::string toString() const = 0;
+    virtual bool equals(const Type& other) const;
+    // Described once, the result is kept for later error messages
+    std::string toString() const;
     virtual bool composable() const;
 
+    virtual std::string describe() const = 0;
+    // Structural identity, children are identified by their canonical address
+    virtual std::string key() const = 0;
+
 protected:
     Type() = default;
 
 private:
+    mutable std::string description;
 };
 
 class BoolType : public Type
@@ -29,8 +43,8 @@ class BoolType : public Type
 public:
     BoolType() = default;
     virtual ~BoolType() override = default;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 };
 
 class IntType : public Type
@@ -38,8 +52,27 @@ class IntType : public Type
 public:
     IntType() = default;
     virtual ~IntType() override = default;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
+};
+
+/**
+ * int8 to int64 and uint8 to uint64, `byte` is uint8. They count as
+ * integers wherever an int is expected, arithmetic wraps at their width.
+ */
+class SizedIntType : public IntType
+{
+public:
+    SizedIntType(long bits, bool isSigned);
+    virtual ~SizedIntType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
+    long getBits() const;
+    bool getSigned() const;
+
+private:
+    long bits;
+    bool isSigned;
 };
 
 class Float32Type : public Type
@@ -47,8 +80,8 @@ class Float32Type : public Type
 public:
     Float32Type() = default;
     virtual ~Float32Type() override = default;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 };
 
 class RuneType : public Type
@@ -56,8 +89,8 @@ class RuneType : public Type
 public:
     RuneType() = default;
     virtual ~RuneType() override = default;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 };
 
 class StringType : public Type
@@ -65,19 +98,20 @@ class StringType : public Type
 public:
     StringType() = default;
     virtual ~StringType() override = default;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 };
 
 class ArrayType : public Type
 {
 public:
     ArrayType(Type *type, long size);
-    virtual ~ArrayType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual ~ArrayType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     virtual bool composable() const override;
     Type *elementType() const;
+    long length() const;
 
 private:
     Type *type;
@@ -88,9 +122,9 @@ class SliceType : public Type
 {
 public:
     SliceType(Type *type);
-    virtual ~SliceType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual ~SliceType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     virtual bool composable() const override;
     Type *elementType() const;
 
@@ -101,26 +135,27 @@ private:
 class StructType : public Type
 {
 public:
-    StructType(std::vector<std::pair<std::string, Type *>> fields);
-    virtual ~StructType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    StructType(std::vector<std::pair<Atom, Type *>> fields);
+    virtual ~StructType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     virtual bool composable() const override;
 
-    bool hasField(std::string field) const;
-    Type *typeOfField(std::string field) const;
+    bool hasField(Atom field) const;
+    Type *typeOfField(Atom field) const;
+    long indexOfField(Atom field) const;
 
 private:
-    std::vector<std::pair<std::string, Type *>> fields;
+    std::vector<std::pair<Atom, Type *>> fields;
 };
 
 class PointerType : public Type
 {
 public:
     PointerType(Type *type);
-    virtual ~PointerType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual ~PointerType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     Type *underlyingType() const;
 
 private:
@@ -131,30 +166,30 @@ class FunctionType : public Type
 {
 public:
     FunctionType(
-        std::vector<std::pair<std::string, Type *>> parameters,
-        std::vector<std::pair<std::string, Type *>> returns);
-    virtual ~FunctionType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+        std::vector<std::pair<Atom, Type *>> parameters,
+        std::vector<std::pair<Atom, Type *>> returns);
+    virtual ~FunctionType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 
     std::vector<Type *> getParameterTypes() const;
     std::vector<Type *> getReturnTypes() const;
 
-    std::vector<std::pair<std::string, Type *>> getParameters() const;
-    std::vector<std::pair<std::string, Type *>> getReturns() const;
+    std::vector<std::pair<Atom, Type *>> getParameters() const;
+    std::vector<std::pair<Atom, Type *>> getReturns() const;
 
 private:
-    std::vector<std::pair<std::string, Type *>> parameters;
-    std::vector<std::pair<std::string, Type *>> returns;
+    std::vector<std::pair<Atom, Type *>> parameters;
+    std::vector<std::pair<Atom, Type *>> returns;
 };
 
 class MapType : public Type
 {
 public:
     MapType(Type *keyType, Type *elementType);
-    virtual ~MapType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual ~MapType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     virtual bool composable() const override;
     Type *keyType() const;
     Type *elementType() const;
@@ -168,16 +203,29 @@ class CustomType : public Type
 {
 public:
     CustomType(Type *type);
-    virtual ~CustomType() override;
-    virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual ~CustomType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
     virtual bool composable() const override;
     Type *underlyingType() const;
+    // Sets the underlying type of a type declared before it was visited
+    void define(Type *type);
 
 private:
     static int idGen;
     int id;
     Type *type;
+    mutable bool describing; // A type can refer to itself, it is spelled out once
+};
+
+// Type of `nil`, assignable to and comparable with every pointer type
+class NilType : public Type
+{
+public:
+    NilType() = default;
+    virtual ~NilType() override = default;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
 };
 
 class UnresolvedType : public Type
@@ -186,7 +234,28 @@ public:
     UnresolvedType() = default;
     virtual ~UnresolvedType() override = default;
     virtual bool equals(const Type& other) const override;
-    virtual std::string toString() const override;
+    virtual std::string describe() const override;
+    virtual std::string key() const override;
+};
+
+/**
+ * Interner for validator types, structurally equal types share one instance.
+ * Canonical types are never freed.
+ */
+class Types
+{
+public:
+    template<typename T, typename... Arguments>
+    static T *get(Arguments&&... arguments)
+    {
+        T candidate{std::forward<Arguments>(arguments)...};
+        auto& type = canonical()[candidate.key()];
+        if (type == nullptr) type = new T{std::move(candidate)};
+        return static_cast<T *>(type);
+    }
+
+private:
+    static std::unordered_map<std::string, Type *>& canonical();
 };
 
 #endif // GOINTERPRETER_VALIDATION_TYPES_HPP
@@ -16,11 +16,14 @@
 class Validator : public AST::Visitor
 {
 public:
-    Validator();
-    ~Validator();
+    // A lazy validator only checks signatures, bodies wait for validateFunction
+    Validator(bool lazy = false);
 
     std::vector<std::string> getErrors() const;
 
+    // Checks the body of function `id` if that did not happen yet
+    void validateFunction(Atom id);
+
     // Program
     void visitProgram(long size) override;
 
@@ -32,57 +35,62 @@ public:
     void visitStringType() override;
     void visitArrayType(long size) override;
     void visitSliceType() override;
-    void visitStructType(std::vector<std::string> fields) override;
+    void visitStructType(std::vector<Atom> fields) override;
     void visitPointerType() override;
-    void visitFunctionType(std::vector<std::string> parameters, std::vector<std::string> returns) override;
+    void visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns) override;
     void visitMapType() override;
-    void visitCustomType(std::string id) override;
+    void visitCustomType(Atom id) override;
 
     // Block
-    void visitBlock(const std::vector<const std::function<void ()>> visitStatements) override;
+    void visitBlock(AST::Visits visitStatements) override;
 
     // Declarations
-    void visitFunctionDeclaration(std::string id, const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) override;
-    void visitTypeAliasDeclaration(std::string id) override;
-    void visitTypeDefinitionDeclaration(std::string id) override;
-    void visitVariableDeclaration(std::vector<std::string> ids, bool typeDeclared, long expression_count) override;
+    void visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitTypeAliasDeclaration(Atom id, AST::Visit visitType) override;
+    void visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType) override;
+    void visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count) override;
 
     // Statements
     void visitExpressionStatement() override;
-    void visitAssignmentStatement(const std::function<long ()>& visitLhs, const std::function<long ()>& visitRhs) override;
-    void visitIfStatement(const std::function <void ()>& visitTrue, const std::function <void ()>& visitFalse) override;
-    void visitSwitchStatement(const std::function<void ()>& visitExpression, const std::vector<const std::function<void ()>> visitClauses) override;
-    void visitSwitchExpressionClause(const std::vector<const std::function<void ()>> visitExpressions, const std::vector<const std::function<void ()>> visitStatements) override;
-    void visitSwitchDefaultClause(const std::vector<const std::function<void ()>> visitStatements) override;
+    void visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs) override;
+    void visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate) override;
+    void visitIncDecStatement(AST::Visit visitTarget, long delta) override;
+    void visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse) override;
+    void visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table) override;
+    void visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements) override;
+    void visitSwitchDefaultClause(AST::Visits visitStatements) override;
     void visitReturnStatement(long size) override;
     void visitBreakStatement() override;
     void visitContinueStatement() override;
     void visitEmptyStatement() override;
-    void visitForConditionStatement(const std::function<void ()>& visitInit, const std::function<void ()>& visitCondition, const std::function<void ()>& visitPost, const std::function<void ()>& visitBody) override;
+    void visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody) override;
 
     // Expressions - Literals
     void visitBoolExpression(bool value) override;
-    void visitIntExpression(int value) override;
+    void visitIntExpression(long value) override;
     void visitFloat32Expression(float value) override;
     void visitRuneExpression(char value) override;
     void visitStringExpression(char *value, long length) override;
+    void visitConstantExpression(long index, AST::Visit visitLiteral) override;
 
     // Expressions - Rest
-    void visitIdentifierExpression(std::string id) override;
-    void visitCompositLiteralExpression(std::vector<std::string> keys) override;
-    void VisitFunctionLiteralExpression(const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody) override;
-    void visitSelectExpression(std::string id) override;
-    void visitIndexExpression() override;
+    void visitIdentifierExpression(Atom id) override;
+    void visitTargetExpression() override;
+    void visitCompositLiteralExpression(std::vector<Atom> keys) override;
+    void VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody) override;
+    void visitSelectExpression(Atom id, long& fieldIndex) override;
+    void visitIndexExpression(long& length, bool checked) override;
     void visitSimpleSliceExpression(bool lowDeclared, bool highDeclared) override;
     void visitFullSliceExpression(bool lowDeclared) override;
-    void visitCallExpression(long size) override;
+    void visitCallExpression(long size, long line, bool tailCall) override;
     void visitConversionExpression() override;
+    void visitNewExpression(AST::Visit visitType) override;
     void visitUnaryPlusExpression() override;
     void visitUnaryNegateExpression() override;
     void visitUnaryLogicalNotExpression() override;
     void visitUnaryBitwiseNotExpression() override;
     void visitUnaryDereferenceExpression() override;
-    void visitUnaryReferenceExpression() override;
+    void visitUnaryReferenceExpression(bool& escapes) override;
     void visitBinaryLogicalOrExpression() override;
     void visitBinaryLogicalAndExpression() override;
     void visitBinaryEqualExpression() override;
@@ -102,9 +110,29 @@ public:
     void visitBinaryDivideExpression() override;
     void visitBinaryModuloExpression() override;
 
+    // Stores
+    void visitIdentifierStore(Atom id) override;
+    void visitSelectStore(Atom id, long& fieldIndex) override;
+    void visitIndexStore(long& length, bool checked) override;
+    void visitDereferenceStore() override;
+    void visitLiteralStore() override;
+    void visitValueStore() override;
+
+    // Superinstructions
+    void visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal) override;
+    void visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal) override;
+    void visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal) override;
+    void visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal) override;
+
 private:
+    // Values of a type are assignable to it, nil is assignable to every pointer type
+    static bool assignable(Type *value, Type *target);
+    // An int operand takes the sized integer type of the other operand, as an untyped constant would
+    static Type *converted(Type *operand, Type *other);
+
+    bool lazy;
     std::vector<std::string> errors;
-    std::map<std::string, const std::function<void ()>> functionDeclarationValidators;
+    std::map<Atom, const std::function<void ()>> functionDeclarationValidators;
 
     SymbolTable<Type *> typeDeclTable;
     SymbolTable<Type *> varDeclTable;
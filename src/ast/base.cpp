@@ -1,5 +1,11 @@
 #include "ast/base.hpp"
 
+void AST::Expression::acceptStore(Visitor *visitor) const
+{
+    accept(visitor);
+    visitor->visitValueStore();
+}
+
 AST::Block::Block(std::vector<Statement *> statements)
     :statements{statements}
 {}
@@ -14,16 +20,7 @@ AST::Block::~Block()
 
 void AST::Block::accept(Visitor *visitor) const
 {
-    std::vector<const std::function<void ()>> visitStatements;
-
-    for (const auto statement : this->statements)
-    {
-        visitStatements.push_back([visitor, statement]() {
-            statement->accept(visitor);
-        });
-    }
-
-    visitor->visitBlock(visitStatements);
+    visitor->visitBlock(Visits{statements, visitor});
 }
 
 AST::Program::Program(std::vector<TopLevelDeclaration *> declarations)
@@ -1,6 +1,6 @@
 #include "ast/declarations.hpp"
 
-AST::FunctionDeclaration::FunctionDeclaration(std::string id, Type *signature, Block *body)
+AST::FunctionDeclaration::FunctionDeclaration(Atom id, Type *signature, Block *body)
     : id{id}, signature{signature}, body{body}
 {}
 
@@ -12,14 +12,20 @@ AST::FunctionDeclaration::~FunctionDeclaration()
 
 void AST::FunctionDeclaration::accept(Visitor *visitor) const
 {
-    visitor->visitFunctionDeclaration(this->id, [this, visitor]() {
-        this->signature->accept(visitor);
-    }, [this, visitor]() {
-        this->body->accept(visitor);
-    });
+    visitor->visitFunctionDeclaration(this->id, Visit{signature, visitor}, Visit{body, visitor});
 }
 
-AST::TypeAliasDeclaration::TypeAliasDeclaration(std::string id, Type *underlyingType)
+const AST::Type *AST::FunctionDeclaration::getSignature() const
+{
+    return signature;
+}
+
+const AST::Block *AST::FunctionDeclaration::getBody() const
+{
+    return body;
+}
+
+AST::TypeAliasDeclaration::TypeAliasDeclaration(Atom id, Type *underlyingType)
     :id{id}, underlyingType{underlyingType}
 {}
 
@@ -30,11 +36,10 @@ AST::TypeAliasDeclaration::~TypeAliasDeclaration()
 
 void AST::TypeAliasDeclaration::accept(Visitor *visitor) const
 {
-    this->underlyingType->accept(visitor);
-    visitor->visitTypeAliasDeclaration(this->id);
+    visitor->visitTypeAliasDeclaration(this->id, Visit{underlyingType, visitor});
 }
 
-AST::TypeDefinitionDeclaration::TypeDefinitionDeclaration(std::string id, Type *underlyingType)
+AST::TypeDefinitionDeclaration::TypeDefinitionDeclaration(Atom id, Type *underlyingType)
     :id{id}, underlyingType{underlyingType}
 {}
 
@@ -45,11 +50,10 @@ AST::TypeDefinitionDeclaration::~TypeDefinitionDeclaration()
 
 void AST::TypeDefinitionDeclaration::accept(Visitor *visitor) const
 {
-    this->underlyingType->accept(visitor);
-    visitor->visitTypeDefinitionDeclaration(this->id);
+    visitor->visitTypeDefinitionDeclaration(this->id, Visit{underlyingType, visitor});
 }
 
-AST::VariableDeclaration::VariableDeclaration(std::vector<std::string> ids, Type *type, std::vector<Expression *> expressions)
+AST::VariableDeclaration::VariableDeclaration(std::vector<Atom> ids, Type *type, std::vector<Expression *> expressions)
     :ids{ids}, type{type}, expressions{expressions}
 {}
 
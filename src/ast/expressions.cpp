@@ -1,6 +1,6 @@
 #include "ast/expressions.hpp"
 
-AST::IdentifierExpression::IdentifierExpression(std::string id)
+AST::IdentifierExpression::IdentifierExpression(Atom id)
     : id{id}
 {}
 
@@ -9,7 +9,124 @@ void AST::IdentifierExpression::accept(Visitor *visitor) const
     visitor->visitIdentifierExpression(this->id);
 }
 
-AST::CompositLiteralExpression::CompositLiteralExpression(Type *type, std::vector<std::pair<std::string, Expression *>> elements)
+void AST::IdentifierExpression::acceptStore(Visitor *visitor) const
+{
+    visitor->visitIdentifierStore(this->id);
+}
+
+Atom AST::IdentifierExpression::getId() const
+{
+    return id;
+}
+
+void AST::TargetExpression::accept(Visitor *visitor) const
+{
+    visitor->visitTargetExpression();
+}
+
+AST::ConstantExpression::ConstantExpression(long index, Expression *literal)
+    : index{index}, literal{literal}
+{}
+
+AST::ConstantExpression::~ConstantExpression()
+{
+    delete literal;
+}
+
+void AST::ConstantExpression::accept(Visitor *visitor) const
+{
+    visitor->visitConstantExpression(this->index, Visit{literal, visitor});
+}
+
+AST::CompareLocalExpression::CompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), Expression *original)
+    : id{id}, constant{constant}, compare{compare}, original{original}, executions{0}
+{}
+
+AST::CompareLocalExpression::~CompareLocalExpression()
+{
+    delete original;
+}
+
+void AST::CompareLocalExpression::accept(Visitor *visitor) const
+{
+    visitor->visitCompareLocalExpression(id, constant, compare, executions, Visit{original, visitor});
+}
+
+AST::IndexLocalExpression::IndexLocalExpression(Atom id, Expression *index, long length, bool checked)
+    : id{id}, index{index}, executions{0}, length{length}, checked{checked}
+{}
+
+AST::IndexLocalExpression::~IndexLocalExpression()
+{
+    delete index;
+}
+
+void AST::IndexLocalExpression::accept(Visitor *visitor) const
+{
+    // The unfused form is no single node, it is replayed from the fused one
+    auto visitOriginal = [](const void *object, Visitor *visitor) {
+        auto self = static_cast<const IndexLocalExpression *>(object);
+        visitor->visitIdentifierExpression(self->id);
+        self->index->accept(visitor);
+        visitor->visitIndexExpression(self->length, self->checked);
+    };
+
+    visitor->visitIndexLocalExpression(id, executions, checked, Visit{index, visitor}, Visit{this, visitor, visitOriginal});
+}
+
+void AST::IndexLocalExpression::acceptOperands(Visitor *visitor) const
+{
+    visitor->visitIdentifierExpression(id);
+    index->accept(visitor);
+}
+
+long AST::IndexLocalExpression::getLength() const
+{
+    return length;
+}
+
+bool AST::IndexLocalExpression::isChecked() const
+{
+    return checked;
+}
+
+void AST::IndexLocalExpression::setChecked(bool checked)
+{
+    this->checked = checked;
+}
+
+AST::IndexGridExpression::IndexGridExpression(ElementExpression *row, Expression *column, long length, bool checked)
+    : row{row}, column{column}, length{length}, checked{checked}
+{}
+
+AST::IndexGridExpression::~IndexGridExpression()
+{
+    delete row;
+    delete column;
+}
+
+void AST::IndexGridExpression::accept(Visitor *visitor) const
+{
+    auto visitOperands = [](const void *object, Visitor *visitor) {
+        static_cast<const ElementExpression *>(object)->acceptOperands(visitor);
+    };
+
+    auto visitOriginal = [](const void *object, Visitor *visitor) {
+        auto self = static_cast<const IndexGridExpression *>(object);
+        self->row->accept(visitor);
+        self->column->accept(visitor);
+        visitor->visitIndexExpression(self->length, self->checked);
+    };
+
+    visitor->visitIndexGridExpression(row->isChecked(), checked, Visit{row, visitor, visitOperands}, Visit{column, visitor}, Visit{this, visitor, visitOriginal});
+}
+
+void AST::IndexGridExpression::setChecked(bool checked)
+{
+    this->checked = checked;
+}
+
+AST::CompositLiteralExpression::CompositLiteralExpression(Type *type, std::vector<std::pair<Atom, Expression *>> elements)
     : type{type}, elements{elements}
 {}
 
@@ -25,7 +142,7 @@ void AST::CompositLiteralExpression::accept(Visitor *visitor) const
 {
     type->accept(visitor);
     
-    std::vector<std::string> keys;
+    std::vector<Atom> keys;
     std::vector<Expression *> expressions;
 
     for (const auto pair : this->elements) {
@@ -40,6 +157,12 @@ void AST::CompositLiteralExpression::accept(Visitor *visitor) const
     visitor->visitCompositLiteralExpression(keys);
 }
 
+void AST::CompositLiteralExpression::acceptStore(Visitor *visitor) const
+{
+    accept(visitor);
+    visitor->visitLiteralStore();
+}
+
 AST::FunctionLiteralExpression::FunctionLiteralExpression(Type *signature, Block* body)
     : signature{signature}, body{body}
 {}
@@ -52,15 +175,11 @@ AST::FunctionLiteralExpression::~FunctionLiteralExpression()
 
 void AST::FunctionLiteralExpression::accept(Visitor *visitor) const
 {
-    visitor->VisitFunctionLiteralExpression([this, visitor]() {
-        signature->accept(visitor);
-    }, [this, visitor]() {
-        body->accept(visitor);
-    });
+    visitor->VisitFunctionLiteralExpression(Visit{signature, visitor}, Visit{body, visitor});
 }
         
-AST::SelectExpression::SelectExpression(Expression *expression, std::string id)
-    : expression{expression}, id{id}
+AST::SelectExpression::SelectExpression(Expression *expression, Atom id, long fieldIndex)
+    : expression{expression}, id{id}, fieldIndex{fieldIndex}
 {}
 
 AST::SelectExpression::~SelectExpression()
@@ -71,11 +190,17 @@ AST::SelectExpression::~SelectExpression()
 void AST::SelectExpression::accept(Visitor *visitor) const
 {
     expression->accept(visitor);
-    visitor->visitSelectExpression(id);
+    visitor->visitSelectExpression(id, fieldIndex);
+}
+
+void AST::SelectExpression::acceptStore(Visitor *visitor) const
+{
+    expression->acceptStore(visitor);
+    visitor->visitSelectStore(id, fieldIndex);
 }
 
-AST::IndexExpression::IndexExpression(Expression *expression, Expression *index)
-    : expression{expression}, index{index}
+AST::IndexExpression::IndexExpression(Expression *expression, Expression *index, long length, bool checked)
+    : expression{expression}, index{index}, length{length}, checked{checked}
 {}
 
 AST::IndexExpression::~IndexExpression()
@@ -88,7 +213,35 @@ void AST::IndexExpression::accept(Visitor *visitor) const
 {
     expression->accept(visitor);
     index->accept(visitor);
-    visitor->visitIndexExpression();
+    visitor->visitIndexExpression(length, checked);
+}
+
+void AST::IndexExpression::acceptStore(Visitor *visitor) const
+{
+    expression->acceptStore(visitor);
+    index->accept(visitor);
+    visitor->visitIndexStore(length, checked);
+}
+
+void AST::IndexExpression::acceptOperands(Visitor *visitor) const
+{
+    expression->accept(visitor);
+    index->accept(visitor);
+}
+
+long AST::IndexExpression::getLength() const
+{
+    return length;
+}
+
+bool AST::IndexExpression::isChecked() const
+{
+    return checked;
+}
+
+void AST::IndexExpression::setChecked(bool checked)
+{
+    this->checked = checked;
 }
 
 AST::SimpleSliceExpression::SimpleSliceExpression(Expression *expression, Expression *low, Expression *high)
@@ -131,8 +284,8 @@ void AST::FullSliceExpression::accept(Visitor *visitor) const
     visitor->visitFullSliceExpression(low != nullptr);
 }
 
-AST::CallExpression::CallExpression(Expression *expression, std::vector<Expression *> arguments)
-    : expression{expression}, arguments{arguments}
+AST::CallExpression::CallExpression(Expression *expression, std::vector<Expression *> arguments, long line, bool tailCall)
+    : expression{expression}, arguments{arguments}, line{line}, tailCall{tailCall}
 {}
 
 AST::CallExpression::~CallExpression()
@@ -153,7 +306,12 @@ void AST::CallExpression::accept(Visitor *visitor) const
         argument->accept(visitor);
     }
 
-    visitor->visitCallExpression(arguments.size());
+    visitor->visitCallExpression(arguments.size(), line, tailCall);
+}
+
+void AST::CallExpression::markTailCall()
+{
+    tailCall = true;
 }
 
 AST::ConversionExpression::ConversionExpression(Type *type, Expression* expression)
@@ -173,9 +331,22 @@ void AST::ConversionExpression::accept(Visitor *visitor) const
     visitor->visitConversionExpression();
 }
 
+AST::NewExpression::NewExpression(Type *type)
+    : type{type}
+{}
 
-AST::UnaryExpression::UnaryExpression(Operation operation, Expression * expression)
-    : operation{operation}, expression{expression}
+AST::NewExpression::~NewExpression()
+{
+    delete type;
+}
+
+void AST::NewExpression::accept(Visitor *visitor) const
+{
+    visitor->visitNewExpression(Visit{type, visitor});
+}
+
+AST::UnaryExpression::UnaryExpression(Operation operation, Expression * expression, bool escapes)
+    : operation{operation}, expression{expression}, escapes{escapes}
 {}
 
 AST::UnaryExpression::~UnaryExpression()
@@ -185,6 +356,13 @@ AST::UnaryExpression::~UnaryExpression()
 
 void AST::UnaryExpression::accept(Visitor *visitor) const
 {
+    // The address of the operand is taken, not its value
+    if (operation == Operation::REFERENCE) {
+        expression->acceptStore(visitor);
+        visitor->visitUnaryReferenceExpression(escapes);
+        return;
+    }
+
     expression->accept(visitor);
     switch (operation)
     {
@@ -204,11 +382,21 @@ void AST::UnaryExpression::accept(Visitor *visitor) const
         visitor->visitUnaryDereferenceExpression();
         break;
     case Operation::REFERENCE:
-        visitor->visitUnaryReferenceExpression();
         break;
     }
 }
 
+void AST::UnaryExpression::acceptStore(Visitor *visitor) const
+{
+    if (operation != Operation::DEREFERENCE) {
+        Expression::acceptStore(visitor);
+        return;
+    }
+
+    expression->accept(visitor);
+    visitor->visitDereferenceStore();
+}
+
 AST::BinaryExpression::BinaryExpression(Operation operation, Expression *lhs, Expression* rhs)
     : operation{operation}, lhs{lhs}, rhs{rhs}
 {}
@@ -9,7 +9,7 @@ void AST::BoolExpression::accept(Visitor *visitor) const
     visitor->visitBoolExpression(this->value);
 }
 
-AST::IntExpression::IntExpression(int value)
+AST::IntExpression::IntExpression(long value)
     :value{value}
 {}
 
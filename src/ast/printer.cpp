@@ -0,0 +1,662 @@
+#include <sstream>
+#include <iomanip>
+
+#include "ast/printer.hpp"
+#include "ast/statements.hpp"
+
+namespace {
+
+    std::string join(const std::vector<std::string>& parts, const std::string& separator)
+    {
+        std::string result;
+
+        for (int i = 0; i < parts.size(); ++i) {
+            if (i > 0) result += separator;
+            result += parts[i];
+        }
+
+        return result;
+    }
+
+    std::string join(const std::vector<Atom>& names, const std::string& separator)
+    {
+        std::vector<std::string> parts;
+
+        for (const auto name : names) {
+            parts.push_back(name.str());
+        }
+
+        return join(parts, separator);
+    }
+
+    std::string indent(const std::string& text)
+    {
+        std::string result = "\t";
+
+        for (int i = 0; i < text.size(); ++i) {
+            result += text[i];
+            if (text[i] == '\n' && i + 1 < text.size()) result += '\t';
+        }
+
+        return result;
+    }
+
+    std::string escape(char value, char quote)
+    {
+        switch (value) {
+        case '\n': return "\\n";
+        case '\t': return "\\t";
+        case '\r': return "\\r";
+        case '\\': return "\\\\";
+        default: break;
+        }
+
+        if (value == quote) {
+            return std::string("\\") + quote;
+        }
+
+        if (value < ' ' || value > '~') {
+            std::ostringstream stream;
+            stream << "\\x" << std::hex << std::setw(2) << std::setfill('0') << (static_cast<int>(value) & 0xff);
+            return stream.str();
+        }
+
+        return std::string(1, value);
+    }
+
+} // namespace
+
+AST::Printer::Printer()
+    : output{}, stack{}
+{}
+
+AST::Printer::~Printer()
+{}
+
+std::string AST::Printer::getOutput() const
+{
+    return output;
+}
+
+std::vector<std::string> AST::Printer::popStrings(long size)
+{
+    auto result = stack.pop(size);
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+std::string AST::Printer::printStatements(Visits visitStatements)
+{
+    std::string result;
+
+    for (const auto& visitStatement : visitStatements) {
+        visitStatement();
+        auto statement = stack.pop();
+        if (!statement.empty()) {
+            result += statement + "\n";
+        }
+    }
+
+    return result;
+}
+
+void AST::Printer::printUnary(const std::string& operation)
+{
+    auto operand = stack.pop();
+
+    // Avoid printing `--x` or `&&x`
+    if (!operand.empty() && operand[0] == operation[0]) {
+        operand = "(" + operand + ")";
+    }
+
+    stack.push(operation + operand);
+}
+
+void AST::Printer::printBinary(const std::string& operation)
+{
+    auto rhs = stack.pop();
+    auto lhs = stack.pop();
+    stack.push("(" + lhs + " " + operation + " " + rhs + ")");
+}
+
+void AST::Printer::visitProgram(long size)
+{
+    output = join(popStrings(size), "\n\n");
+}
+
+void AST::Printer::visitBoolType()
+{
+    stack.push("bool");
+}
+
+void AST::Printer::visitIntType()
+{
+    stack.push("int");
+}
+
+void AST::Printer::visitFloat32Type()
+{
+    stack.push("float32");
+}
+
+void AST::Printer::visitRuneType()
+{
+    stack.push("rune");
+}
+
+void AST::Printer::visitStringType()
+{
+    stack.push("string");
+}
+
+void AST::Printer::visitArrayType(long size)
+{
+    stack.push("[" + std::to_string(size) + "]" + stack.pop());
+}
+
+void AST::Printer::visitSliceType()
+{
+    stack.push("[]" + stack.pop());
+}
+
+void AST::Printer::visitStructType(std::vector<Atom> fields)
+{
+    auto types = popStrings(fields.size());
+    std::vector<std::string> parts;
+
+    for (int i = 0; i < fields.size(); ++i) {
+        parts.push_back(fields[i] + " " + types[i]);
+    }
+
+    stack.push(parts.empty() ? "struct {}" : "struct { " + join(parts, "; ") + " }");
+}
+
+void AST::Printer::visitPointerType()
+{
+    stack.push("*" + stack.pop());
+}
+
+void AST::Printer::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
+{
+    auto returnTypes = popStrings(returns.size());
+    auto parameterTypes = popStrings(parameters.size());
+
+    std::vector<std::string> parameterParts;
+    for (int i = 0; i < parameters.size(); ++i) {
+        parameterParts.push_back(parameters[i].empty() ? parameterTypes[i] : parameters[i] + " " + parameterTypes[i]);
+    }
+
+    std::vector<std::string> returnParts;
+    for (int i = 0; i < returns.size(); ++i) {
+        returnParts.push_back(returns[i].empty() ? returnTypes[i] : returns[i] + " " + returnTypes[i]);
+    }
+
+    std::string result;
+    if (returns.size() == 1 && returns[0].empty()) {
+        result = " " + returnParts[0];
+    } else if (!returns.empty()) {
+        result = " (" + join(returnParts, ", ") + ")";
+    }
+
+    stack.push("func(" + join(parameterParts, ", ") + ")" + result);
+}
+
+void AST::Printer::visitMapType()
+{
+    auto elementType = stack.pop();
+    auto keyType = stack.pop();
+    stack.push("map[" + keyType + "]" + elementType);
+}
+
+void AST::Printer::visitCustomType(Atom id)
+{
+    stack.push(id.str());
+}
+
+void AST::Printer::visitBlock(Visits visitStatements)
+{
+    auto body = printStatements(visitStatements);
+    stack.push(body.empty() ? "{}" : "{\n" + indent(body) + "}");
+}
+
+void AST::Printer::visitFunctionDeclaration(Atom id, Visit visitSignature, Visit visitBody)
+{
+    visitSignature();
+    auto signature = stack.pop();
+    visitBody();
+    auto body = stack.pop();
+
+    // Strip the leading `func` of the signature
+    stack.push("func " + id + signature.substr(4) + " " + body);
+}
+
+void AST::Printer::visitTypeAliasDeclaration(Atom id, Visit visitType)
+{
+    visitType();
+    stack.push("type " + id + " = " + stack.pop());
+}
+
+void AST::Printer::visitTypeDefinitionDeclaration(Atom id, Visit visitType)
+{
+    visitType();
+    stack.push("type " + id + " " + stack.pop());
+}
+
+void AST::Printer::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
+{
+    auto values = popStrings(expression_count);
+    auto declaration = "var " + join(ids, ", ");
+
+    if (typeDeclared) {
+        declaration += " " + stack.pop();
+    }
+
+    if (!values.empty()) {
+        declaration += " = " + join(values, ", ");
+    }
+
+    stack.push(declaration);
+}
+
+void AST::Printer::visitExpressionStatement()
+{}
+
+void AST::Printer::visitAssignmentStatement(Visits visitLhs, Visits visitRhs)
+{
+    auto lhs = popStrings(visitLhs());
+    auto rhs = popStrings(visitRhs());
+    stack.push(join(lhs, ", ") + " = " + join(rhs, ", "));
+}
+
+void AST::Printer::visitCompoundAssignmentStatement(Visit visitTarget, Visit visitUpdate)
+{
+    visitTarget();
+    auto target = stack.top();
+    visitUpdate();
+    auto update = stack.pop();
+    stack.pop();
+
+    // The update prints as `(target op value)`, turn it back into `target op= value`
+    auto prefix = "(" + target + " ";
+    auto operation = update.find(' ', prefix.size());
+    stack.push(target + " " + update.substr(prefix.size(), operation - prefix.size()) + "=" + update.substr(operation, update.size() - operation - 1));
+}
+
+void AST::Printer::visitIncDecStatement(Visit visitTarget, long delta)
+{
+    visitTarget();
+    stack.push(stack.pop() + (delta > 0 ? "++" : "--"));
+}
+
+void AST::Printer::visitIfStatement(Visit visitTrue, Visit visitFalse)
+{
+    auto condition = stack.pop();
+    visitTrue();
+    auto trueBody = stack.pop();
+    visitFalse();
+    auto falseBody = stack.pop();
+
+    stack.push("if " + condition + " " + trueBody + (falseBody == "{}" ? "" : " else " + falseBody));
+}
+
+void AST::Printer::visitSwitchStatement(Visit visitExpression, Visits visitClauses, const SwitchTable *table)
+{
+    visitExpression();
+    auto expression = stack.pop();
+
+    for (const auto& visitClause : visitClauses) {
+        visitClause();
+    }
+
+    auto dispatch = table == nullptr ? "" : "/* jump table: " + table->getKind() + " */ ";
+    stack.push("switch " + expression + " " + dispatch + "{\n" + join(popStrings(visitClauses.size()), "") + "}");
+}
+
+void AST::Printer::visitSwitchExpressionClause(Visits visitExpressions, Visits visitStatements)
+{
+    for (const auto& visitExpression : visitExpressions) {
+        visitExpression();
+    }
+
+    auto labels = popStrings(visitExpressions.size());
+    auto body = printStatements(visitStatements);
+    stack.push("case " + join(labels, ", ") + ":\n" + (body.empty() ? "" : indent(body)));
+}
+
+void AST::Printer::visitSwitchDefaultClause(Visits visitStatements)
+{
+    auto body = printStatements(visitStatements);
+    stack.push("default:\n" + (body.empty() ? "" : indent(body)));
+}
+
+void AST::Printer::visitReturnStatement(long size)
+{
+    auto values = popStrings(size);
+    stack.push(values.empty() ? "return" : "return " + join(values, ", "));
+}
+
+void AST::Printer::visitBreakStatement()
+{
+    stack.push("break");
+}
+
+void AST::Printer::visitContinueStatement()
+{
+    stack.push("continue");
+}
+
+void AST::Printer::visitEmptyStatement()
+{
+    stack.push("");
+}
+
+void AST::Printer::visitForConditionStatement(Visit visitInit, Visit visitCondition, Visit visitPost, Visit visitBody)
+{
+    visitInit();
+    auto init = stack.pop();
+    visitCondition();
+    auto condition = stack.pop();
+    visitPost();
+    auto post = stack.pop();
+    visitBody();
+    auto body = stack.pop();
+
+    if (init.empty() && post.empty()) {
+        stack.push("for " + condition + " " + body);
+    } else {
+        stack.push("for " + init + "; " + condition + "; " + post + " " + body);
+    }
+}
+
+void AST::Printer::visitBoolExpression(bool value)
+{
+    stack.push(value ? "true" : "false");
+}
+
+void AST::Printer::visitIntExpression(long value)
+{
+    stack.push(std::to_string(value));
+}
+
+void AST::Printer::visitFloat32Expression(float value)
+{
+    std::ostringstream stream;
+    stream << std::setprecision(9) << value;
+
+    auto result = stream.str();
+    if (result.find_first_of(".eni") == std::string::npos) {
+        result += ".0";
+    }
+
+    stack.push(result);
+}
+
+void AST::Printer::visitRuneExpression(char value)
+{
+    stack.push("'" + escape(value, '\'') + "'");
+}
+
+void AST::Printer::visitStringExpression(char *value, long length)
+{
+    std::string result = "\"";
+
+    for (long i = 0; i < length; ++i) {
+        result += escape(value[i], '"');
+    }
+
+    stack.push(result + "\"");
+}
+
+void AST::Printer::visitConstantExpression(long index, Visit visitLiteral)
+{
+    visitLiteral();
+    stack.push(stack.pop() + " /* #" + std::to_string(index) + " */");
+}
+
+void AST::Printer::visitIdentifierExpression(Atom id)
+{
+    stack.push(id.str());
+}
+
+void AST::Printer::visitTargetExpression()
+{
+    // The target was printed just before the update
+    stack.push(stack.top());
+}
+
+void AST::Printer::visitCompositLiteralExpression(std::vector<Atom> keys)
+{
+    auto values = popStrings(keys.size());
+    auto type = stack.pop();
+
+    std::vector<std::string> elements;
+    for (int i = 0; i < keys.size(); ++i) {
+        elements.push_back(keys[i].empty() ? values[i] : keys[i] + ": " + values[i]);
+    }
+
+    stack.push(type + "{" + join(elements, ", ") + "}");
+}
+
+void AST::Printer::VisitFunctionLiteralExpression(Visit visitSignature, Visit visitBody)
+{
+    visitSignature();
+    auto signature = stack.pop();
+    visitBody();
+    stack.push(signature + " " + stack.pop());
+}
+
+void AST::Printer::visitSelectExpression(Atom id, long& fieldIndex)
+{
+    stack.push(stack.pop() + "." + id);
+}
+
+void AST::Printer::visitIndexExpression(long& length, bool checked)
+{
+    auto index = stack.pop();
+    stack.push(stack.pop() + "[" + index + "]" + (checked ? "" : " /* unchecked */"));
+}
+
+void AST::Printer::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared)
+{
+    auto high = highDeclared ? stack.pop() : "";
+    auto low = lowDeclared ? stack.pop() : "";
+    stack.push(stack.pop() + "[" + low + ":" + high + "]");
+}
+
+void AST::Printer::visitFullSliceExpression(bool lowDeclared)
+{
+    auto max = stack.pop();
+    auto high = stack.pop();
+    auto low = lowDeclared ? stack.pop() : "";
+    stack.push(stack.pop() + "[" + low + ":" + high + ":" + max + "]");
+}
+
+void AST::Printer::visitCallExpression(long size, long line, bool tailCall)
+{
+    auto arguments = popStrings(size);
+    auto call = stack.pop() + "(" + join(arguments, ", ") + ")";
+    stack.push(tailCall ? call + " /* tail call */" : call);
+}
+
+void AST::Printer::visitConversionExpression()
+{
+    auto expression = stack.pop();
+    stack.push(stack.pop() + "(" + expression + ")");
+}
+
+void AST::Printer::visitNewExpression(Visit visitType)
+{
+    visitType();
+    stack.push("new(" + stack.pop() + ")");
+}
+
+void AST::Printer::visitUnaryPlusExpression()
+{
+    printUnary("+");
+}
+
+void AST::Printer::visitUnaryNegateExpression()
+{
+    printUnary("-");
+}
+
+void AST::Printer::visitUnaryLogicalNotExpression()
+{
+    printUnary("!");
+}
+
+void AST::Printer::visitUnaryBitwiseNotExpression()
+{
+    printUnary("^");
+}
+
+void AST::Printer::visitUnaryDereferenceExpression()
+{
+    printUnary("*");
+}
+
+void AST::Printer::visitUnaryReferenceExpression(bool& escapes)
+{
+    printUnary("&");
+    if (!escapes) stack.push(stack.pop() + " /* in frame */");
+}
+
+void AST::Printer::visitBinaryLogicalOrExpression()
+{
+    printBinary("||");
+}
+
+void AST::Printer::visitBinaryLogicalAndExpression()
+{
+    printBinary("&&");
+}
+
+void AST::Printer::visitBinaryEqualExpression()
+{
+    printBinary("==");
+}
+
+void AST::Printer::visitBinaryNotEqualExpression()
+{
+    printBinary("!=");
+}
+
+void AST::Printer::visitBinaryLessThanExpression()
+{
+    printBinary("<");
+}
+
+void AST::Printer::visitBinaryLessThanEqualExpression()
+{
+    printBinary("<=");
+}
+
+void AST::Printer::visitBinaryGreaterThanExpression()
+{
+    printBinary(">");
+}
+
+void AST::Printer::visitBinaryGreaterThanEqualExpression()
+{
+    printBinary(">=");
+}
+
+void AST::Printer::visitBinaryShiftLeftExpression()
+{
+    printBinary("<<");
+}
+
+void AST::Printer::visitBinaryShiftRightExpression()
+{
+    printBinary(">>");
+}
+
+void AST::Printer::visitBinaryAddExpression()
+{
+    printBinary("+");
+}
+
+void AST::Printer::visitBinarySubtractExpression()
+{
+    printBinary("-");
+}
+
+void AST::Printer::visitBinaryBitwiseOrExpression()
+{
+    printBinary("|");
+}
+
+void AST::Printer::visitBinaryBitwiseXOrExpression()
+{
+    printBinary("^");
+}
+
+void AST::Printer::visitBinaryBitwiseAndExpression()
+{
+    printBinary("&");
+}
+
+void AST::Printer::visitBinaryMultiplyExpression()
+{
+    printBinary("*");
+}
+
+void AST::Printer::visitBinaryDivideExpression()
+{
+    printBinary("/");
+}
+
+void AST::Printer::visitBinaryModuloExpression()
+{
+    printBinary("%");
+}
+
+void AST::Printer::visitIdentifierStore(Atom id)
+{
+    visitIdentifierExpression(id);
+}
+
+void AST::Printer::visitSelectStore(Atom id, long& fieldIndex)
+{
+    visitSelectExpression(id, fieldIndex);
+}
+
+void AST::Printer::visitIndexStore(long& length, bool checked)
+{
+    visitIndexExpression(length, checked);
+}
+
+void AST::Printer::visitDereferenceStore()
+{
+    visitUnaryDereferenceExpression();
+}
+
+void AST::Printer::visitLiteralStore()
+{}
+
+void AST::Printer::visitValueStore()
+{}
+
+void AST::Printer::visitIncrementStatement(Atom id, long delta, long& executions, Visit visitOriginal)
+{
+    visitOriginal();
+    stack.push(stack.pop() + " /* fused: increment */");
+}
+
+void AST::Printer::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, Visit visitOriginal)
+{
+    visitOriginal();
+    stack.push(stack.pop() + " /* fused: compare */");
+}
+
+void AST::Printer::visitIndexLocalExpression(Atom id, long& executions, bool checked, Visit visitIndex, Visit visitOriginal)
+{
+    visitOriginal();
+    stack.push(stack.pop() + " /* fused: index */");
+}
+
+void AST::Printer::visitIndexGridExpression(bool rowChecked, bool checked, Visit visitRow, Visit visitColumn, Visit visitOriginal)
+{
+    visitOriginal();
+    stack.push(stack.pop() + " /* fused: grid */");
+}
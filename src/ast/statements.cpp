@@ -14,6 +14,20 @@ void AST::DeclarationStatement::accept(Visitor *visitor) const
     this->declaration->accept(visitor);
 }
 
+AST::BlockStatement::BlockStatement(Block *block)
+    : block{block}
+{}
+
+AST::BlockStatement::~BlockStatement()
+{
+    delete block;
+}
+
+void AST::BlockStatement::accept(Visitor *visitor) const
+{
+    this->block->accept(visitor);
+}
+
 AST::ExpressionStatement::ExpressionStatement(Expression *expression)
     :expression{expression}
 {}
@@ -48,26 +62,50 @@ AST::AssignmentStatement::~AssignmentStatement()
 
 void AST::AssignmentStatement::accept(Visitor *visitor) const
 {
+    visitor->visitAssignmentStatement(Visits::stores(lhs, visitor), Visits{rhs, visitor});
+}
 
-    auto visitLhs = [this, visitor](){
-        for (const auto expression : this->lhs)
-        {
-            expression->accept(visitor);
-        }
+AST::CompoundAssignmentStatement::CompoundAssignmentStatement(Expression *target, Expression *update)
+    : target{target}, update{update}
+{}
 
-        return this->lhs.size();
-    };
+AST::CompoundAssignmentStatement::~CompoundAssignmentStatement()
+{
+    delete target;
+    delete update;
+}
 
-    auto visitRhs = [this, visitor](){
-        for (const auto expression : this->rhs)
-        {
-            expression->accept(visitor);
-        }
+void AST::CompoundAssignmentStatement::accept(Visitor *visitor) const
+{
+    visitor->visitCompoundAssignmentStatement(Visit::store(target, visitor), Visit{update, visitor});
+}
+
+AST::IncDecStatement::IncDecStatement(Expression *target, long delta)
+    : target{target}, delta{delta}
+{}
+
+AST::IncDecStatement::~IncDecStatement()
+{
+    delete target;
+}
+
+void AST::IncDecStatement::accept(Visitor *visitor) const
+{
+    visitor->visitIncDecStatement(Visit::store(target, visitor), delta);
+}
 
-        return this->rhs.size();
-    };
+AST::IncrementStatement::IncrementStatement(Atom id, long delta, SimpleStatement *original)
+    : id{id}, delta{delta}, original{original}, executions{0}
+{}
 
-    visitor->visitAssignmentStatement(visitLhs, visitRhs);
+AST::IncrementStatement::~IncrementStatement()
+{
+    delete original;
+}
+
+void AST::IncrementStatement::accept(Visitor *visitor) const
+{
+    visitor->visitIncrementStatement(id, delta, executions, Visit{original, visitor});
 }
 
 AST::IfStatement::IfStatement(Expression *condition, Block *trueBody, Block *falseBody)
@@ -85,15 +123,77 @@ void AST::IfStatement::accept(Visitor *visitor) const
 {
     condition->accept(visitor);
 
-    auto visitTrue = [this, visitor](){
-        this->trueBody->accept(visitor);
-    };
+    visitor->visitIfStatement(Visit{trueBody, visitor}, Visit{falseBody, visitor});
+}
+
+AST::SwitchTable::SwitchTable(const std::vector<std::pair<long, long>>& labels, long defaultClause)
+    : kind{Kind::Sorted}, defaultClause{defaultClause}, low{0}, dense{}, sorted{}, hashed{}
+{
+    // The first clause with a label wins, like comparing in order would
+    std::map<long, long> clauses;
+    for (const auto& label : labels) {
+        clauses.emplace(label.first, label.second);
+    }
+
+    if (clauses.empty()) return;
 
-    auto visitFalse = [this, visitor](){
-        this->falseBody->accept(visitor);
-    };
+    low = clauses.begin()->first;
+    auto range = clauses.rbegin()->first - low + 1;
 
-    visitor->visitIfStatement(visitTrue, visitFalse);
+    if (range <= 2 * static_cast<long>(clauses.size())) {
+        kind = Kind::Dense;
+        dense.assign(range, defaultClause);
+
+        for (const auto& clause : clauses) {
+            dense[clause.first - low] = clause.second;
+        }
+    } else {
+        sorted.assign(clauses.begin(), clauses.end());
+    }
+}
+
+AST::SwitchTable::SwitchTable(const std::vector<std::pair<std::string, long>>& labels, long defaultClause)
+    : kind{Kind::Hash}, defaultClause{defaultClause}, low{0}, dense{}, sorted{}, hashed{}
+{
+    for (const auto& label : labels) {
+        hashed.emplace(label.first, label.second);
+    }
+}
+
+bool AST::SwitchTable::hasStringLabels() const
+{
+    return kind == Kind::Hash;
+}
+
+long AST::SwitchTable::lookup(long label) const
+{
+    if (kind == Kind::Dense) {
+        if (label < low || label - low >= static_cast<long>(dense.size())) return defaultClause;
+        return dense[label - low];
+    }
+
+    auto found = std::lower_bound(sorted.begin(), sorted.end(), label, [](const std::pair<long, long>& entry, long label) {
+        return entry.first < label;
+    });
+
+    return found != sorted.end() && found->first == label ? found->second : defaultClause;
+}
+
+long AST::SwitchTable::lookup(const std::string& label) const
+{
+    auto found = hashed.find(label);
+    return found != hashed.end() ? found->second : defaultClause;
+}
+
+std::string AST::SwitchTable::getKind() const
+{
+    switch (kind) {
+        case Kind::Dense: return "dense";
+        case Kind::Sorted: return "binary search";
+        case Kind::Hash: return "hash";
+    }
+
+    return "";
 }
 
 AST::SwitchStatement::SwitchExpressionClause::SwitchExpressionClause(std::vector<Expression *> expressions, std::vector<Statement *> statements)
@@ -113,22 +213,7 @@ AST::SwitchStatement::SwitchExpressionClause::~SwitchExpressionClause()
 
 void AST::SwitchStatement::SwitchExpressionClause::accept(Visitor *visitor) const
 {
-    std::vector<const std::function<void ()>> visitExpressions{};
-    std::vector<const std::function<void ()>> visitStatements{};
-
-    for (const auto expression : this->expressions) {
-        visitExpressions.push_back([expression, visitor]() {
-            expression->accept(visitor);
-        });
-    }
-
-    for (const auto statement : this->statements) {
-        visitStatements.push_back([statement, visitor]() {
-            statement->accept(visitor);
-        });
-    }
-
-    visitor->visitSwitchExpressionClause(visitExpressions, visitStatements);
+    visitor->visitSwitchExpressionClause(Visits{expressions, visitor}, Visits{statements, visitor});
 }
 
 AST::SwitchStatement::SwitchDefaultClause::SwitchDefaultClause(std::vector<Statement *> statements)
@@ -144,24 +229,17 @@ AST::SwitchStatement::SwitchDefaultClause::~SwitchDefaultClause()
 
 void AST::SwitchStatement::SwitchDefaultClause::accept(Visitor *visitor) const
 {
-    std::vector<const std::function<void ()>> visitStatements{};
-
-    for (const auto statement : this->statements) {
-        visitStatements.push_back([statement, visitor]() {
-            statement->accept(visitor);
-        });
-    }
-
-    visitor->visitSwitchDefaultClause(visitStatements);
+    visitor->visitSwitchDefaultClause(Visits{statements, visitor});
 }
 
-AST::SwitchStatement::SwitchStatement::SwitchStatement(Expression *expression, std::vector<SwitchClause *> clauses)
-    : expression{expression}, clauses{clauses}
+AST::SwitchStatement::SwitchStatement::SwitchStatement(Expression *expression, std::vector<SwitchClause *> clauses, SwitchTable *table)
+    : expression{expression}, clauses{clauses}, table{table}
 {}
 
 AST::SwitchStatement::SwitchStatement::~SwitchStatement()
 {
     delete expression;
+    delete table;
 
     for (const auto clause : this->clauses) {
         delete clause;
@@ -170,17 +248,7 @@ AST::SwitchStatement::SwitchStatement::~SwitchStatement()
 
 void AST::SwitchStatement::SwitchStatement::accept(Visitor *visitor) const
 {  
-    std::vector<const std::function<void ()>> visitClauses{};
-
-    for (const auto clause : this->clauses) {
-        visitClauses.push_back([clause, visitor]() {
-            clause->accept(visitor);
-        });
-    }
-
-    visitor->visitSwitchStatement([this, visitor]() {
-        this->expression->accept(visitor);
-    }, visitClauses);
+    visitor->visitSwitchStatement(Visit{expression, visitor}, Visits{clauses, visitor}, table);
 }
 
 AST::ReturnStatement::ReturnStatement(std::vector<Expression *> expressions)
@@ -232,13 +300,5 @@ AST::ForConditionStatement::~ForConditionStatement()
 
 void AST::ForConditionStatement::accept(Visitor *visitor) const
 {
-    visitor->visitForConditionStatement([this, visitor]() {
-        this->init->accept(visitor);
-    }, [this, visitor]() {
-        this->condition->accept(visitor);
-    }, [this, visitor]() {
-        this->post->accept(visitor);
-    }, [this, visitor]() {
-        this->body->accept(visitor);
-    });
+    visitor->visitForConditionStatement(Visit{init, visitor}, Visit{condition, visitor}, Visit{post, visitor}, Visit{body, visitor});
 }
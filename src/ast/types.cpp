@@ -55,20 +55,23 @@ void AST::SliceType::accept(Visitor *visitor) const
     visitor->visitSliceType();
 }
 
-AST::StructType::StructType(std::vector<std::pair<std::string, Type *>> fields)
+AST::StructType::StructType(std::vector<std::pair<Atom, Type *>> fields)
     :fields{fields}
 {}
 
 AST::StructType::~StructType()
 {
+    // Fields declared together, `x, y int`, share one type
+    Type *previous = nullptr;
     for (const auto pair : this->fields) {
-        delete pair.second;
+        if (pair.second != previous) delete pair.second;
+        previous = pair.second;
     }
 }
 
 void AST::StructType::accept(Visitor *visitor) const
 {
-    std::vector<std::string> field_names;
+    std::vector<Atom> field_names;
     std::vector<Type *> field_types;
 
     for (const auto pair : this->fields) {
@@ -99,49 +102,46 @@ void AST::PointerType::accept(Visitor *visitor) const
 }
 
 AST::FunctionType::FunctionType(
-    std::vector<std::pair<std::string, Type *>> parameters, 
-    std::vector<std::pair<std::string, Type *>> returns)
+    std::vector<std::pair<Atom, Type *>> parameters, 
+    std::vector<std::pair<Atom, Type *>> returns)
     :parameters{parameters}, returns{returns}
-{}
-
-AST::FunctionType::~FunctionType()
 {
     for (const auto ppair : this->parameters) {
-        delete ppair.second;
+        parameterNames.push_back(ppair.first);
     }
 
     for (const auto rpair : this->returns) {
-        delete rpair.second;
+        returnNames.push_back(rpair.first);
     }
 }
 
-void AST::FunctionType::accept(Visitor *visitor) const
+AST::FunctionType::~FunctionType()
 {
-    std::vector<std::string> parameter_names;
-    std::vector<Type *> parameter_types;
-
+    // Parameters declared together, `x, y int`, share one type
+    Type *previous = nullptr;
     for (const auto ppair : this->parameters) {
-        parameter_names.push_back(ppair.first);
-        parameter_types.push_back(ppair.second);
+        if (ppair.second != previous) delete ppair.second;
+        previous = ppair.second;
     }
 
-    for (const auto type : parameter_types) {
-        type->accept(visitor);
+    previous = nullptr;
+    for (const auto rpair : this->returns) {
+        if (rpair.second != previous) delete rpair.second;
+        previous = rpair.second;
     }
+}
 
-    std::vector<std::string> return_names;
-    std::vector<Type *> return_types;
-
-    for (const auto rpair : this->returns) {
-        return_names.push_back(rpair.first);
-        return_types.push_back(rpair.second);
+void AST::FunctionType::accept(Visitor *visitor) const
+{
+    for (const auto& ppair : this->parameters) {
+        ppair.second->accept(visitor);
     }
 
-    for (const auto type : return_types) {
-        type->accept(visitor);
+    for (const auto& rpair : this->returns) {
+        rpair.second->accept(visitor);
     }
 
-    visitor->visitFunctionType(parameter_names, return_names);
+    visitor->visitFunctionType(parameterNames, returnNames);
 }
 
 AST::MapType::MapType(Type *keyType, Type *elementType)
@@ -161,8 +161,8 @@ void AST::MapType::accept(Visitor *visitor) const
     visitor->visitMapType();
 }
 
-AST::CustomType::CustomType(const char *id)
-    :id{std::string{id}} 
+AST::CustomType::CustomType(Atom id)
+    :id{id} 
 {}
 
 void AST::CustomType::accept(Visitor *visitor) const
@@ -0,0 +1,528 @@
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+#include "interpreter/histogram.hpp"
+
+OpcodeHistogram::OpcodeHistogram(AST::Visitor *inner)
+    : inner{inner}, counts{}
+{}
+
+void OpcodeHistogram::print(std::ostream& out) const
+{
+    std::vector<std::pair<const char *, long>> sorted{counts.begin(), counts.end()};
+    long total = 0;
+
+    for (const auto& entry : sorted) {
+        total += entry.second;
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const auto& first, const auto& second) {
+        return first.second > second.second;
+    });
+
+    out << std::left << std::setw(32) << "opcode" << std::right << std::setw(14) << "executions" << std::setw(9) << "share" << std::endl;
+
+    for (const auto& entry : sorted) {
+        out << std::left << std::setw(32) << entry.first
+            << std::right << std::setw(14) << entry.second
+            << std::setw(8) << std::fixed << std::setprecision(2) << 100.0 * entry.second / total << '%' << std::endl;
+    }
+}
+
+void OpcodeHistogram::count(const char *opcode)
+{
+    ++counts[opcode];
+}
+
+void OpcodeHistogram::visitProgram(long size)
+{
+    count("Program");
+    inner->visitProgram(size);
+}
+
+void OpcodeHistogram::visitBoolType()
+{
+    count("BoolType");
+    inner->visitBoolType();
+}
+
+void OpcodeHistogram::visitIntType()
+{
+    count("IntType");
+    inner->visitIntType();
+}
+
+void OpcodeHistogram::visitFloat32Type()
+{
+    count("Float32Type");
+    inner->visitFloat32Type();
+}
+
+void OpcodeHistogram::visitRuneType()
+{
+    count("RuneType");
+    inner->visitRuneType();
+}
+
+void OpcodeHistogram::visitStringType()
+{
+    count("StringType");
+    inner->visitStringType();
+}
+
+void OpcodeHistogram::visitArrayType(long size)
+{
+    count("ArrayType");
+    inner->visitArrayType(size);
+}
+
+void OpcodeHistogram::visitSliceType()
+{
+    count("SliceType");
+    inner->visitSliceType();
+}
+
+void OpcodeHistogram::visitStructType(std::vector<Atom> fields)
+{
+    count("StructType");
+    inner->visitStructType(fields);
+}
+
+void OpcodeHistogram::visitPointerType()
+{
+    count("PointerType");
+    inner->visitPointerType();
+}
+
+void OpcodeHistogram::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
+{
+    count("FunctionType");
+    inner->visitFunctionType(parameters, returns);
+}
+
+void OpcodeHistogram::visitMapType()
+{
+    count("MapType");
+    inner->visitMapType();
+}
+
+void OpcodeHistogram::visitCustomType(Atom id)
+{
+    count("CustomType");
+    inner->visitCustomType(id);
+}
+
+void OpcodeHistogram::visitBlock(AST::Visits visitStatements)
+{
+    count("Block");
+    inner->visitBlock(visitStatements);
+}
+
+void OpcodeHistogram::visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody)
+{
+    count("FunctionDeclaration");
+    inner->visitFunctionDeclaration(id, visitSignature, visitBody);
+}
+
+void OpcodeHistogram::visitTypeAliasDeclaration(Atom id, AST::Visit visitType)
+{
+    count("TypeAliasDeclaration");
+    inner->visitTypeAliasDeclaration(id, visitType);
+}
+
+void OpcodeHistogram::visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType)
+{
+    count("TypeDefinitionDeclaration");
+    inner->visitTypeDefinitionDeclaration(id, visitType);
+}
+
+void OpcodeHistogram::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
+{
+    count("VariableDeclaration");
+    inner->visitVariableDeclaration(ids, typeDeclared, expression_count);
+}
+
+void OpcodeHistogram::visitExpressionStatement()
+{
+    count("ExpressionStatement");
+    inner->visitExpressionStatement();
+}
+
+void OpcodeHistogram::visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs)
+{
+    count("AssignmentStatement");
+    inner->visitAssignmentStatement(visitLhs, visitRhs);
+}
+
+void OpcodeHistogram::visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate)
+{
+    count("CompoundAssignmentStatement");
+    inner->visitCompoundAssignmentStatement(visitTarget, visitUpdate);
+}
+
+void OpcodeHistogram::visitIncDecStatement(AST::Visit visitTarget, long delta)
+{
+    count("IncDecStatement");
+    inner->visitIncDecStatement(visitTarget, delta);
+}
+
+void OpcodeHistogram::visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse)
+{
+    count("IfStatement");
+    inner->visitIfStatement(visitTrue, visitFalse);
+}
+
+void OpcodeHistogram::visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table)
+{
+    count("SwitchStatement");
+    inner->visitSwitchStatement(visitExpression, visitClauses, table);
+}
+
+void OpcodeHistogram::visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements)
+{
+    count("SwitchExpressionClause");
+    inner->visitSwitchExpressionClause(visitExpressions, visitStatements);
+}
+
+void OpcodeHistogram::visitSwitchDefaultClause(AST::Visits visitStatements)
+{
+    count("SwitchDefaultClause");
+    inner->visitSwitchDefaultClause(visitStatements);
+}
+
+void OpcodeHistogram::visitReturnStatement(long size)
+{
+    count("ReturnStatement");
+    inner->visitReturnStatement(size);
+}
+
+void OpcodeHistogram::visitBreakStatement()
+{
+    count("BreakStatement");
+    inner->visitBreakStatement();
+}
+
+void OpcodeHistogram::visitContinueStatement()
+{
+    count("ContinueStatement");
+    inner->visitContinueStatement();
+}
+
+void OpcodeHistogram::visitEmptyStatement()
+{
+    count("EmptyStatement");
+    inner->visitEmptyStatement();
+}
+
+void OpcodeHistogram::visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody)
+{
+    count("ForConditionStatement");
+    inner->visitForConditionStatement(visitInit, visitCondition, visitPost, visitBody);
+}
+
+void OpcodeHistogram::visitBoolExpression(bool value)
+{
+    count("BoolExpression");
+    inner->visitBoolExpression(value);
+}
+
+void OpcodeHistogram::visitIntExpression(long value)
+{
+    count("IntExpression");
+    inner->visitIntExpression(value);
+}
+
+void OpcodeHistogram::visitFloat32Expression(float value)
+{
+    count("Float32Expression");
+    inner->visitFloat32Expression(value);
+}
+
+void OpcodeHistogram::visitRuneExpression(char value)
+{
+    count("RuneExpression");
+    inner->visitRuneExpression(value);
+}
+
+void OpcodeHistogram::visitStringExpression(char *value, long length)
+{
+    count("StringExpression");
+    inner->visitStringExpression(value, length);
+}
+
+void OpcodeHistogram::visitConstantExpression(long index, AST::Visit visitLiteral)
+{
+    count("ConstantExpression");
+    inner->visitConstantExpression(index, visitLiteral);
+}
+
+void OpcodeHistogram::visitIdentifierExpression(Atom id)
+{
+    count("IdentifierExpression");
+    inner->visitIdentifierExpression(id);
+}
+
+void OpcodeHistogram::visitTargetExpression()
+{
+    count("TargetExpression");
+    inner->visitTargetExpression();
+}
+
+void OpcodeHistogram::visitCompositLiteralExpression(std::vector<Atom> keys)
+{
+    count("CompositLiteralExpression");
+    inner->visitCompositLiteralExpression(keys);
+}
+
+void OpcodeHistogram::VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody)
+{
+    count("FunctionLiteralExpression");
+    inner->VisitFunctionLiteralExpression(visitSignature, visitBody);
+}
+
+void OpcodeHistogram::visitSelectExpression(Atom id, long& fieldIndex)
+{
+    count("SelectExpression");
+    inner->visitSelectExpression(id, fieldIndex);
+}
+
+void OpcodeHistogram::visitIndexExpression(long& length, bool checked)
+{
+    count("IndexExpression");
+    inner->visitIndexExpression(length, checked);
+}
+
+void OpcodeHistogram::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared)
+{
+    count("SimpleSliceExpression");
+    inner->visitSimpleSliceExpression(lowDeclared, highDeclared);
+}
+
+void OpcodeHistogram::visitFullSliceExpression(bool lowDeclared)
+{
+    count("FullSliceExpression");
+    inner->visitFullSliceExpression(lowDeclared);
+}
+
+void OpcodeHistogram::visitCallExpression(long size, long line, bool tailCall)
+{
+    count("CallExpression");
+    inner->visitCallExpression(size, line, tailCall);
+}
+
+void OpcodeHistogram::visitConversionExpression()
+{
+    count("ConversionExpression");
+    inner->visitConversionExpression();
+}
+
+void OpcodeHistogram::visitNewExpression(AST::Visit visitType)
+{
+    count("NewExpression");
+    inner->visitNewExpression(visitType);
+}
+
+void OpcodeHistogram::visitUnaryPlusExpression()
+{
+    count("UnaryPlusExpression");
+    inner->visitUnaryPlusExpression();
+}
+
+void OpcodeHistogram::visitUnaryNegateExpression()
+{
+    count("UnaryNegateExpression");
+    inner->visitUnaryNegateExpression();
+}
+
+void OpcodeHistogram::visitUnaryLogicalNotExpression()
+{
+    count("UnaryLogicalNotExpression");
+    inner->visitUnaryLogicalNotExpression();
+}
+
+void OpcodeHistogram::visitUnaryBitwiseNotExpression()
+{
+    count("UnaryBitwiseNotExpression");
+    inner->visitUnaryBitwiseNotExpression();
+}
+
+void OpcodeHistogram::visitUnaryDereferenceExpression()
+{
+    count("UnaryDereferenceExpression");
+    inner->visitUnaryDereferenceExpression();
+}
+
+void OpcodeHistogram::visitUnaryReferenceExpression(bool& escapes)
+{
+    count("UnaryReferenceExpression");
+    inner->visitUnaryReferenceExpression(escapes);
+}
+
+void OpcodeHistogram::visitBinaryLogicalOrExpression()
+{
+    count("BinaryLogicalOrExpression");
+    inner->visitBinaryLogicalOrExpression();
+}
+
+void OpcodeHistogram::visitBinaryLogicalAndExpression()
+{
+    count("BinaryLogicalAndExpression");
+    inner->visitBinaryLogicalAndExpression();
+}
+
+void OpcodeHistogram::visitBinaryEqualExpression()
+{
+    count("BinaryEqualExpression");
+    inner->visitBinaryEqualExpression();
+}
+
+void OpcodeHistogram::visitBinaryNotEqualExpression()
+{
+    count("BinaryNotEqualExpression");
+    inner->visitBinaryNotEqualExpression();
+}
+
+void OpcodeHistogram::visitBinaryLessThanExpression()
+{
+    count("BinaryLessThanExpression");
+    inner->visitBinaryLessThanExpression();
+}
+
+void OpcodeHistogram::visitBinaryLessThanEqualExpression()
+{
+    count("BinaryLessThanEqualExpression");
+    inner->visitBinaryLessThanEqualExpression();
+}
+
+void OpcodeHistogram::visitBinaryGreaterThanExpression()
+{
+    count("BinaryGreaterThanExpression");
+    inner->visitBinaryGreaterThanExpression();
+}
+
+void OpcodeHistogram::visitBinaryGreaterThanEqualExpression()
+{
+    count("BinaryGreaterThanEqualExpression");
+    inner->visitBinaryGreaterThanEqualExpression();
+}
+
+void OpcodeHistogram::visitBinaryShiftLeftExpression()
+{
+    count("BinaryShiftLeftExpression");
+    inner->visitBinaryShiftLeftExpression();
+}
+
+void OpcodeHistogram::visitBinaryShiftRightExpression()
+{
+    count("BinaryShiftRightExpression");
+    inner->visitBinaryShiftRightExpression();
+}
+
+void OpcodeHistogram::visitBinaryAddExpression()
+{
+    count("BinaryAddExpression");
+    inner->visitBinaryAddExpression();
+}
+
+void OpcodeHistogram::visitBinarySubtractExpression()
+{
+    count("BinarySubtractExpression");
+    inner->visitBinarySubtractExpression();
+}
+
+void OpcodeHistogram::visitBinaryBitwiseOrExpression()
+{
+    count("BinaryBitwiseOrExpression");
+    inner->visitBinaryBitwiseOrExpression();
+}
+
+void OpcodeHistogram::visitBinaryBitwiseXOrExpression()
+{
+    count("BinaryBitwiseXOrExpression");
+    inner->visitBinaryBitwiseXOrExpression();
+}
+
+void OpcodeHistogram::visitBinaryBitwiseAndExpression()
+{
+    count("BinaryBitwiseAndExpression");
+    inner->visitBinaryBitwiseAndExpression();
+}
+
+void OpcodeHistogram::visitBinaryMultiplyExpression()
+{
+    count("BinaryMultiplyExpression");
+    inner->visitBinaryMultiplyExpression();
+}
+
+void OpcodeHistogram::visitBinaryDivideExpression()
+{
+    count("BinaryDivideExpression");
+    inner->visitBinaryDivideExpression();
+}
+
+void OpcodeHistogram::visitBinaryModuloExpression()
+{
+    count("BinaryModuloExpression");
+    inner->visitBinaryModuloExpression();
+}
+
+void OpcodeHistogram::visitIdentifierStore(Atom id)
+{
+    count("IdentifierStore");
+    inner->visitIdentifierStore(id);
+}
+
+void OpcodeHistogram::visitSelectStore(Atom id, long& fieldIndex)
+{
+    count("SelectStore");
+    inner->visitSelectStore(id, fieldIndex);
+}
+
+void OpcodeHistogram::visitIndexStore(long& length, bool checked)
+{
+    count("IndexStore");
+    inner->visitIndexStore(length, checked);
+}
+
+void OpcodeHistogram::visitDereferenceStore()
+{
+    count("DereferenceStore");
+    inner->visitDereferenceStore();
+}
+
+void OpcodeHistogram::visitLiteralStore()
+{
+    count("LiteralStore");
+    inner->visitLiteralStore();
+}
+
+void OpcodeHistogram::visitValueStore()
+{
+    count("ValueStore");
+    inner->visitValueStore();
+}
+
+void OpcodeHistogram::visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal)
+{
+    count("IncrementStatement");
+    inner->visitIncrementStatement(id, delta, executions, visitOriginal);
+}
+
+void OpcodeHistogram::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal)
+{
+    count("CompareLocalExpression");
+    inner->visitCompareLocalExpression(id, constant, compare, executions, visitOriginal);
+}
+
+void OpcodeHistogram::visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal)
+{
+    count("IndexLocalExpression");
+    inner->visitIndexLocalExpression(id, executions, checked, visitIndex, visitOriginal);
+}
+
+void OpcodeHistogram::visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal)
+{
+    count("IndexGridExpression");
+    inner->visitIndexGridExpression(rowChecked, checked, visitRow, visitColumn, visitOriginal);
+}
@@ -1,41 +1,39 @@
+#include <memory>
+#include <typeinfo>
+
 #include "interpreter/interpreter.hpp"
+#include "natives/natives.hpp"
+#include "ast/statements.hpp"
+#include "utils/counters.hpp"
+
+namespace {
+
+    class TailCallValue : public Value
+    {};
+
+}
 
-Interpreter::Interpreter()
-    : stack{}, switchStack{}, symbolTable{}, returnsByCurrentFunction{}, functionClosed{}, compositeLiteralType{}, brk{false}, cont{false}, ret{false}
+Interpreter::Interpreter(std::string file, long stackSize)
+    : firstCallHook{}, file{file}, stackSize{stackSize}, stackLimit{nullptr}, signatureParameters{nullptr}, signatureReturns{0}, tailCallee{nullptr}, tailArguments{}, tailCallResult{new TailCallValue{}}, stack{}, locations{}, switchStack{}, switchState{SwitchState::Matching}, symbolTable{}, constants{}, returnsByCurrentFunction{}, functionClosed{}, types{}, definitions{}, factories{}, defining{}, brk{false}, cont{false}, ret{false}
 {
     symbolTable.addScope();
 
-    std::string printInt = "printInt";
-    std::string printRune = "printRune";
-    std::string printFloat32 = "printFloat32";
-    std::string printString = "printString";
-    symbolTable.add(printInt, new FunctionValue{{}, [](auto closure, auto arguments) -> Value * {
-        auto value = dynamic_cast<IntValue *>(arguments[0]->getValue());
-        std::cout << value->getInt();
-        return nullptr;
-    }});
-    symbolTable.add(printRune, new FunctionValue{{}, [](auto closure, auto arguments) -> Value * {
-        auto value = dynamic_cast<RuneValue *>(arguments[0]->getValue());
-        std::cout << value->getChar();
-        return nullptr;
-    }});
-    symbolTable.add(printFloat32, new FunctionValue{{}, [](auto closure, auto arguments) -> Value * {
-        auto value = dynamic_cast<Float32Value *>(arguments[0]->getValue());
-        std::cout << value->getFloat();
-        return nullptr;
-    }});
-    symbolTable.add(printString, new FunctionValue{{}, [](auto closure, auto arguments) -> Value * {
-        auto value = dynamic_cast<StringValue *>(arguments[0]->getValue());
-        auto string = value->getString();
-        auto converted = std::string{};
-        for (int i = 0; i < string.size; ++i) {
-            if (string.value[i] != '\0') {
-                converted += string.value[i];
-            }
-        }
-        std::cout << converted;
-        return nullptr;
-    }});
+    for (const auto& native : Natives::all()) {
+        symbolTable.add(native.id, new NativeFunctionValue{native.thunk, native.function});
+    }
+
+    symbolTable.add("nil", PointerValue::nil());
+
+    // Predeclared sized integer types, their zero values are shared
+    definitions["int8"] = TypeInfo{TypeKind::Basic, SizedIntValue<int8_t>::of(0), nullptr, nullptr};
+    definitions["int16"] = TypeInfo{TypeKind::Basic, SizedIntValue<int16_t>::of(0), nullptr, nullptr};
+    definitions["int32"] = TypeInfo{TypeKind::Basic, SizedIntValue<int32_t>::of(0), nullptr, nullptr};
+    definitions["int64"] = TypeInfo{TypeKind::Basic, SizedIntValue<int64_t>::of(0), nullptr, nullptr};
+    definitions["uint8"] = TypeInfo{TypeKind::Basic, SizedIntValue<uint8_t>::of(0), nullptr, nullptr};
+    definitions["uint16"] = TypeInfo{TypeKind::Basic, SizedIntValue<uint16_t>::of(0), nullptr, nullptr};
+    definitions["uint32"] = TypeInfo{TypeKind::Basic, SizedIntValue<uint32_t>::of(0), nullptr, nullptr};
+    definitions["uint64"] = TypeInfo{TypeKind::Basic, SizedIntValue<uint64_t>::of(0), nullptr, nullptr};
+    definitions["byte"] = definitions["uint8"];
 }
 
 Interpreter::~Interpreter()
@@ -44,70 +42,195 @@ Interpreter::~Interpreter()
     std::cout << std::endl;
 }
 
+void Interpreter::setFirstCallHook(const std::function<const AST::FunctionDeclaration *(Atom id)>& hook)
+{
+    firstCallHook = hook;
+}
+
 void Interpreter::visitProgram(long size)
 {
     std::string main_name = "main";
-    auto main = dynamic_cast<FunctionValue *>(symbolTable.get(main_name)->getValue());
+    auto main = counted_cast<FunctionValue *>(symbolTable.get(main_name)->getValue());
 
+    // Calls nest on the native stack, stop before it runs out
+    char base;
+    if (stackSize > 0) stackLimit = &base - stackSize + STACK_MARGIN;
 
     symbolTable.addScope();
     functionClosed.push(false);
-    main->call({});
+    call(main, Arguments{nullptr, 0}, 0);
     symbolTable.removeScope();
 }
 
 void Interpreter::visitBoolType()
-{}
+{
+    types.push(TypeInfo{TypeKind::Basic, BoolValue::of(false), nullptr, nullptr});
+}
 
 void Interpreter::visitIntType()
-{}
+{
+    static auto zero = new IntValue{0};
+    types.push(TypeInfo{TypeKind::Basic, zero, nullptr, nullptr});
+}
 
 void Interpreter::visitFloat32Type()
-{}
+{
+    static auto zero = new Float32Value{0};
+    types.push(TypeInfo{TypeKind::Basic, zero, nullptr, nullptr});
+}
 
 void Interpreter::visitRuneType()
-{}
+{
+    static auto zero = new RuneValue{0};
+    types.push(TypeInfo{TypeKind::Basic, zero, nullptr, nullptr});
+}
 
 void Interpreter::visitStringType()
-{}
+{
+    types.push(TypeInfo{TypeKind::Basic, StringValue::intern("", 0), nullptr, nullptr});
+}
 
 void Interpreter::visitArrayType(long size)
 {
-    compositeLiteralType.push(CompositeLiteralType::Array);
+    auto element = types.pop();
+    auto layout = Layout::array(layoutOf(element));
+
+    auto make = factory([size, element, layout]() -> Value * {
+        std::vector<Value *> values(size);
+        for (auto& value : values) value = held(builtZeroOf(element));
+        return ArrayValue::of(values, layout);
+    });
+
+    types.push(TypeInfo{TypeKind::Array, nullptr, element.zero, make, layout, size, std::make_shared<const TypeInfo>(element)});
 }
 
 void Interpreter::visitSliceType()
 {
-    compositeLiteralType.push(CompositeLiteralType::Slice);
+    auto element = types.pop();
+    auto make = factory([element]() -> Value * { return makeSlice(element.zero, {}); });
+    types.push(TypeInfo{TypeKind::Slice, nullptr, element.zero, make});
 }
 
-void Interpreter::visitStructType(std::vector<std::string> fields)
+void Interpreter::visitStructType(std::vector<Atom> fields)
 {
-    compositeLiteralType.push(CompositeLiteralType::Struct);
+    const Factory *make = nullptr;
+
+    auto fieldTypes = types.pop(fields.size());
+    std::reverse(fieldTypes.begin(), fieldTypes.end());
+
+    std::vector<const Layout *> fieldLayouts;
+    for (const auto& field : fieldTypes) fieldLayouts.push_back(layoutOf(field));
+    auto layout = Layout::structure(fieldLayouts);
+
+    // Only a named type gets a factory, the zero of another is built from its fields
+    if (!defining.empty()) {
+        make = factory([fieldTypes, layout]() -> Value * {
+            std::vector<Value *> values;
+            for (const auto& field : fieldTypes) values.push_back(held(builtZeroOf(field)));
+            return new StructValue{values, layout};
+        });
+    }
+
+    auto info = TypeInfo{TypeKind::Struct, nullptr, nullptr, make, layout};
+    info.fields = std::make_shared<const std::vector<TypeInfo>>(std::move(fieldTypes));
+    types.push(info);
 }
 
 void Interpreter::visitPointerType()
-{}
+{
+    types.pop();
+    types.push(TypeInfo{TypeKind::Pointer, PointerValue::nil(), nullptr, nullptr});
+}
 
-void Interpreter::visitFunctionType(std::vector<std::string> parameters, std::vector<std::string> returns)
+void Interpreter::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
 {
-    auto arguments = stack.pop(parameters.size());
-    std::reverse(arguments.begin(), arguments.end());
+    types.drop(parameters.size() + returns.size());
 
-    for (int i = 0; i < parameters.size(); ++i) {
-        symbolTable.add(parameters[i], arguments[i]->getValue());
-    }
+    // A call binds its arguments once its callee's whole signature is visited
+    signatureParameters = &parameters;
+    signatureReturns = returns.size();
 
-    returnsByCurrentFunction.push(returns.size());
+    types.push(TypeInfo{TypeKind::Function, nullptr, nullptr, nullptr});
 }
 
 void Interpreter::visitMapType()
-{}
+{
+    // Reading a missing key gives the element type's zero value
+    auto element = types.pop();
+    types.pop();
 
-void Interpreter::visitCustomType(std::string id)
-{}
+    auto make = factory([element]() -> Value * { return new MapValue{held(builtZeroOf(element))}; });
+
+    auto info = TypeInfo{TypeKind::Map, nullptr, element.zero, make};
+    info.element = std::make_shared<const TypeInfo>(element);
+    types.push(info);
+}
+
+void Interpreter::visitCustomType(Atom id)
+{
+    auto definition = definitions.find(id);
+
+    // A type only refers to itself through a pointer, whose zero value is nil
+    if (id == defining || definition == definitions.end()) {
+        types.push(TypeInfo{TypeKind::Basic, nullptr, nullptr, nullptr});
+        return;
+    }
+
+    types.push(definition->second);
+}
+
+Value *Interpreter::zeroOf(const TypeInfo& type)
+{
+    return type.make != nullptr ? (*type.make)() : type.zero;
+}
+
+Value *Interpreter::builtZeroOf(const TypeInfo& type)
+{
+    auto zero = zeroOf(type);
+    if (zero != nullptr) return zero;
+
+    std::vector<Value *> values;
+
+    switch (type.kind)
+    {
+    case TypeKind::Array:
+        for (long i = 0; i < type.length; ++i) values.push_back(held(builtZeroOf(*type.element)));
+        break;
+    case TypeKind::Struct:
+        // Fields of a function type have no value yet
+        for (const auto& field : *type.fields) values.push_back(held(builtZeroOf(field)));
+        return new StructValue{values, type.layout};
+    default:
+        return nullptr;
+    }
+
+    if (std::find(values.begin(), values.end(), nullptr) != values.end()) return nullptr;
+    return ArrayValue::of(values, type.layout);
+}
 
-void Interpreter::visitBlock(const std::vector<const std::function<void ()>> visitStatements)
+const Layout *Interpreter::layoutOf(const TypeInfo& type)
+{
+    return type.layout != nullptr ? type.layout : Layout::scalar(type.zero);
+}
+
+Value *Interpreter::held(Value *value)
+{
+    return value != nullptr ? value->hold() : nullptr;
+}
+
+Value *Interpreter::makeSlice(Value *elementZero, const std::vector<Value *>& values)
+{
+    if (auto packed = dynamic_cast<Packed *>(elementZero)) return packed->packedSlice(values);
+    return new SliceValue{values};
+}
+
+Value *Interpreter::converted(Value *zero, Value *value)
+{
+    if (!instanceof<Packed>(zero)) return value;
+    return counted_cast<Integer *>(zero)->withInt(counted_cast<Integer *>(value)->getInt());
+}
+
+void Interpreter::visitBlock(AST::Visits visitStatements)
 {
     for (const auto visitStatement : visitStatements) {
         visitStatement();
@@ -115,40 +238,51 @@ void Interpreter::visitBlock(const std::vector<const std::function<void ()>> vis
     }
 }
 
-void Interpreter::visitFunctionDeclaration(std::string id, const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody)
+void Interpreter::visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody)
 {  
-    symbolTable.add(id, new FunctionValue{{}, [this, visitSignature, visitBody](auto closure, auto arguments) -> Value * {
-        // Remove current scope
-        auto closed = functionClosed.pop();
-        std::vector<std::map<std::string, Value *>> scopes;
+    // The first call runs the hook, which can give the function another declaration
+    struct Definition
+    {
+        bool called;
+        AST::Visit visitSignature;
+        AST::Visit visitBody;
+    };
 
-        scopes.push_back(symbolTable.getScope());
-        symbolTable.removeScope();
+    auto definition = std::make_shared<Definition>(Definition{false, visitSignature, visitBody});
+
+    symbolTable.add(id, new FunctionValue{{}, [this, id, definition](const auto& closure, auto arguments) -> Value * {
+        if (!definition->called) {
+            definition->called = true;
+            auto declaration = firstCallHook ? firstCallHook(id) : nullptr;
 
-        if (closed) {
-            scopes.push_back(symbolTable.getScope());
-            symbolTable.removeScope();
+            if (declaration != nullptr) {
+                definition->visitSignature = definition->visitSignature.to(declaration->getSignature());
+                definition->visitBody = definition->visitBody.to(declaration->getBody());
+            }
         }
 
+        TRACE(id.str());
+
+        // Hide the caller's scope, and its closure scope if it has one
+        auto closed = functionClosed.pop();
+        auto hidden = closed ? 2 : 1;
+        symbolTable.hideScopes(hidden);
+
         // Run function
         symbolTable.addScope();
 
         functionClosed.push(false);
-        for (const auto argument : arguments) {
-            stack.push(argument);
-        }
-        visitSignature();
-        visitBody();
+        definition->visitSignature();
+        types.pop();
+        bindSignature(arguments);
+        definition->visitBody();
         symbolTable.removeScope();
 
-        // restore scope(s)
-        std::reverse(scopes.begin(), scopes.end());
-        for (auto scope : scopes) {
-            symbolTable.addScope(scope);
-        }
+        symbolTable.showScopes(hidden);
 
+        functionClosed.pop();
         functionClosed.push(closed);
-        
+
         // return the result of the function
         auto returns = returnsByCurrentFunction.pop();
         if (returns == 0) {
@@ -161,87 +295,224 @@ void Interpreter::visitFunctionDeclaration(std::string id, const std::function<v
     }});
 }
 
-void Interpreter::visitTypeAliasDeclaration(std::string id)
-{}
+void Interpreter::visitTypeAliasDeclaration(Atom id, AST::Visit visitType)
+{
+    visitTypeDefinitionDeclaration(id, visitType);
+}
 
-void Interpreter::visitTypeDefinitionDeclaration(std::string id)
-{}
+void Interpreter::visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType)
+{
+    auto outer = defining;
+    defining = id;
+    visitType();
+    defining = outer;
 
-void Interpreter::visitVariableDeclaration(std::vector<std::string> ids, bool typeDeclared, long expression_count)
+    definitions[id] = types.pop();
+}
+
+void Interpreter::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
 {
+    auto type = typeDeclared ? types.pop() : TypeInfo{TypeKind::Basic, nullptr, nullptr, nullptr};
+
     auto values = stack.pop(expression_count);
     std::reverse(values.begin(), values.end());
     for (int i = 0; i < expression_count; ++i) {
-        symbolTable.add(ids[i], values[i]->getValue());
+        symbolTable.add(ids[i], held(converted(type.zero, values[i]->getValue())));
+    }
+
+    // Without values, variables of a type with a zero value start with it
+    if (expression_count != 0 || !typeDeclared) return;
+
+    for (auto id : ids) {
+        auto zero = builtZeroOf(type);
+        if (zero != nullptr) symbolTable.add(id, zero->hold());
     }
 }
 
 void Interpreter::visitExpressionStatement()
 {}
 
-void Interpreter::visitAssignmentStatement(const std::function<long ()>& visitLhs, const std::function<long ()>& visitRhs)
+void Interpreter::visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs)
 {
+    // Every value is read before the first store, `x, y = y, x` swaps
     auto lhsSize = visitLhs();
-    auto lhs = stack.pop(lhsSize);
-    std::reverse(lhs.begin(), lhs.end());
-
     auto rhsSize = visitRhs();
-    auto rhs = stack.pop(rhsSize);
-    std::reverse(rhs.begin(), rhs.end());
-    
-    for (int i = 0; i < lhsSize; ++i) {
-        dynamic_cast<ReferenceValue *>(lhs[i])->setValue(rhs[i]->getValue());
+
+    auto targets = locations.window(lhsSize);
+    auto values = stack.window(rhsSize);
+
+    // A row of a grid is a view, the values are held so a store into the grid doesn't change one read already
+    if (lhsSize > 1) {
+        for (long i = 0; i < rhsSize; ++i) values[i] = held(values[i]->getValue());
     }
+
+    for (long i = 0; i < lhsSize; ++i) {
+        store(targets[i], values[i]);
+    }
+
+    if (lhsSize > 1) {
+        for (long i = 0; i < rhsSize; ++i) values[i]->release();
+    }
+
+    locations.drop(lhsSize);
+    stack.drop(rhsSize);
+}
+
+void Interpreter::visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate)
+{
+    // The update reads the target through its location, then the result is stored there
+    visitTarget();
+    visitUpdate();
+    store(locations.pop(), stack.pop());
+}
+
+void Interpreter::visitIncDecStatement(AST::Visit visitTarget, long delta)
+{
+    visitTarget();
+    auto location = locations.pop();
+    store(location, counted_cast<Increment *>(load(location))->increment(delta));
 }
 
-void Interpreter::visitIfStatement(const std::function <void ()>& visitTrue, const std::function <void ()>& visitFalse)
+Value *Interpreter::load(const Location& location)
+{
+    switch (location.kind)
+    {
+    case Location::Kind::Variable:
+        return symbolTable.get(location.id);
+    case Location::Kind::Slot:
+        return *location.address;
+    case Location::Kind::Element:
+        return location.container->index(location.index);
+    case Location::Kind::Row:
+        return static_cast<ArrayValue *>(location.owner)->at(location.rowIndex);
+    }
+
+    return nullptr;
+}
+
+void Interpreter::store(const Location& location, Value *value)
+{
+    // The holder takes the new value before it lets go of the old one, which may be the same
+    Value **slot;
+
+    switch (location.kind)
+    {
+    case Location::Kind::Variable:
+        slot = symbolTable.slot(location.id);
+        break;
+    case Location::Kind::Slot:
+        slot = location.address;
+        break;
+    case Location::Kind::Element:
+        // Packed elements are integers, nothing holds them
+        location.container->setIndex(location.index, value);
+        return;
+    case Location::Kind::Row:
+        // The grid holds the elements of the row itself
+        static_cast<ArrayValue *>(location.owner)->setRow(location.rowIndex, value);
+        return;
+    }
+
+    auto old = *slot;
+    *slot = held(value);
+    if (old != nullptr) old->release();
+}
+
+Value *Interpreter::owned(const Location& location)
+{
+    auto value = load(location);
+    auto owned = value->owned(location.owner);
+
+    if (owned != value) store(location, owned);
+    return owned;
+}
+
+void Interpreter::visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse)
 {
     auto condition = stack.pop();
     auto value = condition->getValue();
 
-    if (dynamic_cast<BoolValue *>(value)->getBool()) {
+    if (static_cast<BoolValue *>(value)->getBool()) {
         visitTrue();
     } else {
         visitFalse();
     }
 }
 
-void Interpreter::visitSwitchStatement(const std::function<void ()>& visitExpression, const std::vector<const std::function<void ()>> visitClauses)
+void Interpreter::visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table)
 {
     visitExpression();
-    switchStack.push(stack.pop());
-    for (auto visitClause : visitClauses) {
-        visitClause();
-        if (brk || ret) {
-            brk = false;
-            break;
+    auto value = stack.pop()->getValue();
+
+    auto outer = switchState;
+    switchStack.push(value);
+
+    if (table != nullptr) {
+        long clause;
+
+        if (table->hasStringLabels()) {
+            auto string = static_cast<StringValue *>(value)->getString();
+            clause = table->lookup(std::string{string.value, static_cast<size_t>(string.size)});
+        } else if (auto integer = counted_cast<Integer *>(value)) {
+            clause = table->lookup(integer->getInt());
+        } else {
+            clause = table->lookup(static_cast<RuneValue *>(value)->getChar());
+        }
+
+        if (clause != AST::SwitchTable::NO_CLAUSE) {
+            switchState = SwitchState::Selected;
+            visitClauses[clause]();
+        }
+    } else {
+        // Cases are tried in order, the default clause only runs if none matched
+        switchState = SwitchState::Matching;
+        for (const auto& visitClause : visitClauses) {
+            visitClause();
+            if (switchState == SwitchState::Matched) break;
+        }
+
+        if (switchState != SwitchState::Matched) {
+            switchState = SwitchState::Default;
+            for (const auto& visitClause : visitClauses) {
+                visitClause();
+            }
         }
     }
+
+    brk = false;
+    switchState = outer;
     switchStack.pop();
 }
 
-void Interpreter::visitSwitchExpressionClause(const std::vector<const std::function<void ()>> visitExpressions, const std::vector<const std::function<void ()>> visitStatements)
+void Interpreter::visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements)
 {
-    for (auto visitExpression : visitExpressions) {
-        visitExpression();
-        auto value = dynamic_cast<Equal *>(stack.pop()->getValue());
-
-        if (value->equal(switchStack.top()->getValue())) {
-            for (auto visitStatement : visitStatements) {
-                visitStatement();
-                if (cont || brk || ret) {
-                    break;
-                }
+    if (switchState == SwitchState::Matching) {
+        for (const auto& visitExpression : visitExpressions) {
+            visitExpression();
+            auto value = counted_cast<Equal *>(stack.pop()->getValue());
+
+            if (value->equal(switchStack.top())) {
+                switchState = SwitchState::Matched;
+                break;
             }
-
-            break;
         }
     }
+
+    if (switchState == SwitchState::Matched || switchState == SwitchState::Selected) {
+        visitClauseStatements(visitStatements);
+    }
+}
+
+void Interpreter::visitSwitchDefaultClause(AST::Visits visitStatements)
+{
+    if (switchState == SwitchState::Default || switchState == SwitchState::Selected) {
+        visitClauseStatements(visitStatements);
+    }
 }
 
-void Interpreter::visitSwitchDefaultClause(const std::vector<const std::function<void ()>> visitStatements)
+void Interpreter::visitClauseStatements(AST::Visits visitStatements)
 {
-    for (auto visitStatement : visitStatements) {
+    for (const auto& visitStatement : visitStatements) {
         visitStatement();
         if (cont || brk || ret) {
             break;
@@ -268,12 +539,12 @@ void Interpreter::visitContinueStatement()
 void Interpreter::visitEmptyStatement()
 {}
 
-void Interpreter::visitForConditionStatement(const std::function<void ()>& visitInit, const std::function<void ()>& visitCondition, const std::function<void ()>& visitPost, const std::function<void ()>& visitBody)
+void Interpreter::visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody)
 {
     visitInit();
 
     visitCondition();
-    bool conditionMet = dynamic_cast<BoolValue*>(stack.pop()->getValue())->getBool();
+    bool conditionMet = static_cast<BoolValue *>(stack.pop()->getValue())->getBool();
 
     while (conditionMet) {
         visitBody();
@@ -287,16 +558,16 @@ void Interpreter::visitForConditionStatement(const std::function<void ()>& visit
         visitPost();
 
         visitCondition();
-        conditionMet = dynamic_cast<BoolValue*>(stack.pop()->getValue())->getBool();
+        conditionMet = static_cast<BoolValue *>(stack.pop()->getValue())->getBool();
     }
 }
 
 void Interpreter::visitBoolExpression(bool value)
 {
-    stack.push(new BoolValue{value});
+    stack.push(BoolValue::of(value));
 }
 
-void Interpreter::visitIntExpression(int value)
+void Interpreter::visitIntExpression(long value)
 {
     stack.push(new IntValue{value});
 }
@@ -313,94 +584,111 @@ void Interpreter::visitRuneExpression(char value)
 
 void Interpreter::visitStringExpression(char *value, long length)
 {
-    stack.push(new StringValue{value, length});
+    stack.push(StringValue::intern(value, length));
 }
 
-void Interpreter::visitIdentifierExpression(std::string id)
+void Interpreter::visitConstantExpression(long index, AST::Visit visitLiteral)
 {
-    stack.push(new ReferenceValue{
-       [this, id]() -> Value * {
-           auto _id = id;
-           return this->symbolTable.get(_id);
-       },
-       [this, id](Value *newValue) -> void {
-           auto _id = id;
-           this->symbolTable.add(_id, newValue);
-       } 
-    });
+    if (index >= constants.size()) {
+        constants.resize(index + 1, nullptr);
+    }
+
+    // Materialise the literal the first time it is evaluated
+    if (constants[index] == nullptr) {
+        visitLiteral();
+        constants[index] = stack.top();
+        return;
+    }
+
+    stack.push(constants[index]);
+}
+
+void Interpreter::visitIdentifierExpression(Atom id)
+{
+    stack.push(symbolTable.get(id));
 }
 
-void Interpreter::visitCompositLiteralExpression(std::vector<std::string> keys)
+void Interpreter::visitTargetExpression()
 {
-    auto type = compositeLiteralType.pop();
+    stack.push(load(locations.top()));
+}
+
+void Interpreter::visitCompositLiteralExpression(std::vector<Atom> keys)
+{
+    auto type = types.pop();
     auto values = stack.pop(keys.size());
     std::reverse(values.begin(), values.end());
 
-    std::map<std::string, Value *> _values;
-
+    // Filter references, the literal holds what is left
     for (int i = 0; i < values.size(); ++i) {
-        values[i] = values[i]->getValue(); // Filter references
+        values[i] = held(values[i]->getValue());
     }
 
-    switch (type)
+    switch (type.kind)
     {
-    case CompositeLiteralType::Struct:
-
-        for (int i = 0; i < keys.size(); ++i) {
-            _values[keys[i]] = values[i];
+    case TypeKind::Struct:
+        // The validator only accepts every field keyed in declaration order
+        stack.push(new StructValue{values, type.layout});
+        break;
+    case TypeKind::Slice:
+        stack.push(makeSlice(type.elementZero, values));
+        break;
+    case TypeKind::Array:
+        for (auto& value : values) value = converted(type.elementZero, value);
+
+        // Elements left out are zero, the optimizer drops bounds checks up to the declared length
+        while (values.size() < type.length) {
+            auto zero = builtZeroOf(*type.element);
+            if (zero == nullptr) {
+                throw std::runtime_error{"Composite literal leaves out elements of a type without a zero value"};
+            }
+            values.push_back(held(zero));
         }
 
-        stack.push(new StructValue{_values});
-        break;
-    case CompositeLiteralType::Slice:
-        stack.push(new SliceValue{values});
+        stack.push(ArrayValue::of(values, type.layout));
         break;
-    case CompositeLiteralType::Array:
-        stack.push(new ArrayValue{values});
+    case TypeKind::Map:
+        // The validator only accepts empty map literals
+        stack.push(new MapValue{held(builtZeroOf(*type.element))});
         break;
+    default:
+        throw std::runtime_error{"Composite literal of a type that is not composable"};
     }
 }
 
-void Interpreter::VisitFunctionLiteralExpression(const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody)
+void Interpreter::VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody)
 {
-    auto closure = symbolTable.getScope(); 
-    stack.push( new FunctionValue{closure, [this, visitSignature, visitBody](auto closure, auto arguments) -> Value * {
-        // Remove current scope
-        auto closed = functionClosed.pop();
-        std::vector<std::map<std::string, Value *>> scopes;
+    auto closure = symbolTable.getClosure();
+    for (auto& var : closure) var.second = held(var.second);
 
-        scopes.push_back(symbolTable.getScope());
-        symbolTable.removeScope();
+    stack.push( new FunctionValue{closure, [this, visitSignature, visitBody](const auto& closure, auto arguments) -> Value * {
+        TRACE("func literal");
 
-        if (closed) {
-            scopes.push_back(symbolTable.getScope());
-            symbolTable.removeScope();
-        }
+        // Hide the caller's scope, and its closure scope if it has one
+        auto closed = functionClosed.pop();
+        auto hidden = closed ? 2 : 1;
+        symbolTable.hideScopes(hidden);
 
         // Run function
         symbolTable.addScope();// closure scope
         
-        for (auto var : closure) {
-            symbolTable.add(var.first, var.second);
+        for (const auto& var : closure) {
+            symbolTable.add(var.first, held(var.second));
         }
 
         symbolTable.addScope();
 
         functionClosed.push(true);
-        for (const auto argument : arguments) {
-            stack.push(argument);
-        }
         visitSignature();
+        types.pop();
+        bindSignature(arguments);
         visitBody();
         symbolTable.removeScope();
         symbolTable.removeScope();
 
-        // restore scope(s)
-        std::reverse(scopes.begin(), scopes.end());
-        for (auto scope : scopes) {
-            symbolTable.addScope(scope);
-        }
+        symbolTable.showScopes(hidden);
 
+        functionClosed.pop();
         functionClosed.push(closed);
 
         // return the result of the function
@@ -415,16 +703,24 @@ void Interpreter::VisitFunctionLiteralExpression(const std::function<void ()>& v
     }});
 }
 
-void Interpreter::visitSelectExpression(std::string id)
+void Interpreter::visitSelectExpression(Atom id, long& fieldIndex)
 {
-    auto value = dynamic_cast<Select *>(stack.pop());
-    stack.push(value->select(id));
+    auto value = counted_cast<Select *>(stack.pop());
+    stack.push(value->select(fieldIndex));
 }
 
-void Interpreter::visitIndexExpression()
+void Interpreter::visitIndexExpression(long& length, bool checked)
 {
+    // Proven in range, the validator made sure it is an array indexed by an int
+    if (!checked) {
+        COUNT("unchecked index");
+        auto index = static_cast<IntValue *>(stack.pop()->getValue())->getInt();
+        stack.push(static_cast<ArrayValue *>(stack.pop())->at(index));
+        return;
+    }
+
     auto index = stack.pop()->getValue();
-    auto value = dynamic_cast<Index *>(stack.pop());
+    auto value = counted_cast<Index *>(stack.pop());
     stack.push(value->index(index));
 }
 
@@ -433,7 +729,7 @@ void Interpreter::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared
     Value *high = highDeclared ? stack.pop()->getValue(): nullptr;
     Value *low = lowDeclared ? stack.pop()->getValue() : nullptr;
 
-    auto value = dynamic_cast<SimpleSlice *>(stack.pop());
+    auto value = counted_cast<SimpleSlice *>(stack.pop());
     stack.push(value->simpleSlice(low, high));
 }
 
@@ -443,191 +739,430 @@ void Interpreter::visitFullSliceExpression(bool lowDeclared)
     Value *high = stack.pop()->getValue();
     Value *low = lowDeclared ? stack.pop()->getValue() : nullptr;
 
-    auto value = dynamic_cast<FullSlice *>(stack.pop());
+    auto value = counted_cast<FullSlice *>(stack.pop());
     stack.push(value->fullSlice(low, high, max));
 }
 
-void Interpreter::visitCallExpression(long size)
+void Interpreter::visitCallExpression(long size, long line, bool tailCall)
 {
-    auto arguments = stack.pop(size);
-    std::reverse(arguments.begin(), arguments.end());
-    
-    for (int i = 0; i < arguments.size(); ++i) {
-        arguments[i] = arguments[i]->getValue();
+    // The arguments stay on the stack above the callee, they are bound from there
+    Arguments arguments{stack.window(size), size};
+
+    for (auto& argument : arguments) {
+        argument = argument->getValue();
     }
 
-    auto value = dynamic_cast<Call *>(stack.pop());
+    auto value = counted_cast<Call *>(stack.peek(size));
+
+    // Leave the call to whoever called the current function, its frame is done
+    if (tailCall) {
+        tailCallee = value;
+        tailArguments.assign(arguments.begin(), arguments.end());
+        stack.drop(size + 1);
+        stack.push(tailCallResult);
+        return;
+    }
+
+    auto result = call(value, arguments, line);
+    stack.drop(size + 1);
+    if (result != nullptr) stack.push(result);
+}
+
+Value *Interpreter::call(Call *callee, Arguments arguments, long line)
+{
+    char frame;
+    if (&frame < stackLimit) {
+        throw std::runtime_error{"stack overflow at " + file + ":" + std::to_string(line)};
+    }
 
     ret = false;
-    auto result = value->call(arguments);
+    auto result = callee->call(arguments);
     ret = false;
 
-    if (result != nullptr) stack.push(result);
+    while (tailCallee != nullptr) {
+        callee = tailCallee;
+        tailCallee = nullptr;
+
+        result = callee->call(Arguments{tailArguments.data(), static_cast<long>(tailArguments.size())});
+        ret = false;
+    }
+
+    return result;
+}
+
+void Interpreter::bindSignature(Arguments arguments)
+{
+    for (int i = 0; i < signatureParameters->size(); ++i) {
+        symbolTable.add((*signatureParameters)[i], held(arguments[i]));
+    }
+
+    returnsByCurrentFunction.push(signatureReturns);
 }
 
 void Interpreter::visitConversionExpression()
 {
-    // FIXME:
+    // The validator only accepts identity conversions and ones between integers
+    auto type = types.pop();
+    auto integer = counted_cast<Integer *>(type.zero);
+    if (integer == nullptr) return;
+
+    auto value = counted_cast<Integer *>(stack.pop()->getValue());
+    stack.push(integer->withInt(value->getInt()));
+}
+
+void Interpreter::visitNewExpression(AST::Visit visitType)
+{
+    visitType();
+    stack.push(new PointerValue{new Value *{held(builtZeroOf(types.pop()))}});
 }
 
 void Interpreter::visitUnaryPlusExpression()
 {
-    auto value = dynamic_cast<UnaryPlus *>(stack.pop());
+    auto value = counted_cast<UnaryPlus *>(stack.pop());
     stack.push(value->unaryPlus());
 }
 
 void Interpreter::visitUnaryNegateExpression()
 {
-    auto value = dynamic_cast<Negate *>(stack.pop());
+    auto value = counted_cast<Negate *>(stack.pop());
     stack.push(value->negate());
 }
 
 void Interpreter::visitUnaryLogicalNotExpression()
 {
-    auto value = dynamic_cast<LogicalNot *>(stack.pop());
+    auto value = counted_cast<LogicalNot *>(stack.pop());
     stack.push(value->logicalNot());
 }
 
 void Interpreter::visitUnaryBitwiseNotExpression()
 {
-    auto value = dynamic_cast<BitwiseNot *>(stack.pop());
+    auto value = counted_cast<BitwiseNot *>(stack.pop());
     stack.push(value->bitwiseNot());
 }
 
 void Interpreter::visitUnaryDereferenceExpression()
 {
-    auto value = dynamic_cast<Dereference *>(stack.pop());
+    auto value = counted_cast<Dereference *>(stack.pop());
     stack.push(value->dereference());
 }
 
-void Interpreter::visitUnaryReferenceExpression()
+void Interpreter::visitUnaryReferenceExpression(bool& escapes)
 {
-    auto value = dynamic_cast<Reference *>(stack.pop());
-    stack.push(value->reference());
+    auto location = locations.pop();
+
+    switch (location.kind)
+    {
+    case Location::Kind::Variable:
+        // A variable whose address can outlive its frame moves to the heap, the others are pointed at in place
+        stack.push(new PointerValue{escapes ? symbolTable.box(location.id) : symbolTable.slot(location.id)});
+        break;
+    case Location::Kind::Slot:
+        if (location.owner != nullptr) location.owner->pin();
+        stack.push(new PointerValue{location.address});
+        break;
+    case Location::Kind::Element:
+        throw std::runtime_error("Cannot take the address of an element of a packed slice");
+    case Location::Kind::Row:
+        throw std::runtime_error("Cannot take the address of a row of an array of arrays");
+    }
 }
 
 void Interpreter::visitBinaryLogicalOrExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<LogicalOr *>(stack.pop());
+    auto lhs = counted_cast<LogicalOr *>(stack.pop());
     stack.push(lhs->logicalOr(rhs));
 }
 
 void Interpreter::visitBinaryLogicalAndExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<LogicalAnd *>(stack.pop());
+    auto lhs = counted_cast<LogicalAnd *>(stack.pop());
     stack.push(lhs->logicalAnd(rhs));
 }
 
 void Interpreter::visitBinaryEqualExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Equal *>(stack.pop());
-    stack.push(lhs->equal(rhs));
+    auto lhs = counted_cast<Equal *>(stack.pop());
+    stack.push(BoolValue::of(lhs->equal(rhs)));
 }
 
 void Interpreter::visitBinaryNotEqualExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<NotEqual *>(stack.pop());
-    stack.push(lhs->notEqual(rhs));
+    auto lhs = counted_cast<NotEqual *>(stack.pop());
+    stack.push(BoolValue::of(lhs->notEqual(rhs)));
 }
 
 void Interpreter::visitBinaryLessThanExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<LessThan *>(stack.pop());
-    stack.push(lhs->lessThan(rhs));
+    auto lhs = counted_cast<LessThan *>(stack.pop());
+    stack.push(BoolValue::of(lhs->lessThan(rhs)));
 }
 
 void Interpreter::visitBinaryLessThanEqualExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<LessThanEqual *>(stack.pop());
-    stack.push(lhs->lessThanEqual(rhs));
+    auto lhs = counted_cast<LessThanEqual *>(stack.pop());
+    stack.push(BoolValue::of(lhs->lessThanEqual(rhs)));
 }
 
 void Interpreter::visitBinaryGreaterThanExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<GreaterThan *>(stack.pop());
-    stack.push(lhs->greaterThan(rhs));
+    auto lhs = counted_cast<GreaterThan *>(stack.pop());
+    stack.push(BoolValue::of(lhs->greaterThan(rhs)));
 }
 
 void Interpreter::visitBinaryGreaterThanEqualExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<GreaterThanEqual *>(stack.pop());
-    stack.push(lhs->greaterThanEqual(rhs));
+    auto lhs = counted_cast<GreaterThanEqual *>(stack.pop());
+    stack.push(BoolValue::of(lhs->greaterThanEqual(rhs)));
 }
 
 void Interpreter::visitBinaryShiftLeftExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<ShiftLeft *>(stack.pop());
+    auto lhs = counted_cast<ShiftLeft *>(stack.pop());
     stack.push(lhs->shiftLeft(rhs));
 }
 
 void Interpreter::visitBinaryShiftRightExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<ShiftRight *>(stack.pop());
+    auto lhs = counted_cast<ShiftRight *>(stack.pop());
     stack.push(lhs->shiftRight(rhs));
 }
 
 void Interpreter::visitBinaryAddExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Add *>(stack.pop());
+    auto lhs = counted_cast<Add *>(stack.pop());
     stack.push(lhs->add(rhs));
 }
 
 void Interpreter::visitBinarySubtractExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Subtract *>(stack.pop());
+    auto lhs = counted_cast<Subtract *>(stack.pop());
     stack.push(lhs->subtract(rhs));
 }
 
 void Interpreter::visitBinaryBitwiseOrExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<BitwiseOr *>(stack.pop());
+    auto lhs = counted_cast<BitwiseOr *>(stack.pop());
     stack.push(lhs->bitwiseOr(rhs));
 }
 
 void Interpreter::visitBinaryBitwiseXOrExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<BitwiseXOr *>(stack.pop());
+    auto lhs = counted_cast<BitwiseXOr *>(stack.pop());
     stack.push(lhs->bitwiseXOr(rhs));
 }
 
 void Interpreter::visitBinaryBitwiseAndExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<BitwiseAnd *>(stack.pop());
+    auto lhs = counted_cast<BitwiseAnd *>(stack.pop());
     stack.push(lhs->bitwiseAnd(rhs));
 }
 
 void Interpreter::visitBinaryMultiplyExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Multiply *>(stack.pop());
+    auto lhs = counted_cast<Multiply *>(stack.pop());
     stack.push(lhs->multiply(rhs));
 }
 
 void Interpreter::visitBinaryDivideExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Divide *>(stack.pop());
+    auto lhs = counted_cast<Divide *>(stack.pop());
     stack.push(lhs->divide(rhs));
 }
 
 void Interpreter::visitBinaryModuloExpression()
 {
     auto rhs = stack.pop();
-    auto lhs = dynamic_cast<Modulo *>(stack.pop());
+    auto lhs = counted_cast<Modulo *>(stack.pop());
     stack.push(lhs->modulo(rhs));
 }
+
+void Interpreter::visitIdentifierStore(Atom id)
+{
+    locations.push(Location::variable(id));
+}
+
+void Interpreter::visitSelectStore(Atom id, long& fieldIndex)
+{
+    auto location = locations.pop();
+    auto value = load(location);
+
+    // `p.f` writes to the struct in the cell `p` points at, an exact type check keeps struct stores cheap
+    if (typeid(*value) == typeid(PointerValue)) {
+        auto pointer = static_cast<PointerValue *>(value);
+
+        if (pointer->getCell() == nullptr) {
+            throw std::runtime_error("Nil pointer dereference");
+        }
+
+        location = Location::slot(pointer->getCell());
+    }
+
+    value = owned(location);
+    locations.push(Location::slot(counted_cast<Select *>(value)->selectSlot(fieldIndex), value));
+}
+
+void Interpreter::visitIndexStore(long& length, bool checked)
+{
+    auto index = stack.pop();
+    auto value = owned(locations.pop());
+
+    // An array indexed by an int, the validator resolved its length
+    if (length >= 0) {
+        auto array = static_cast<ArrayValue *>(value);
+        auto indexValue = static_cast<IntValue *>(index->getValue())->getInt();
+
+        if (checked) {
+            array->checked(indexValue);
+        } else {
+            COUNT("unchecked index");
+        }
+
+        auto slot = array->slotAt(indexValue);
+        locations.push(slot != nullptr ? Location::slot(slot, value) : Location::row(array, indexValue));
+        return;
+    }
+
+    auto container = counted_cast<Index *>(value);
+    auto slot = container->indexSlot(index);
+
+    locations.push(slot != nullptr ? Location::slot(slot, value) : Location::element(container, index, value));
+}
+
+void Interpreter::visitDereferenceStore()
+{
+    auto pointer = counted_cast<PointerValue *>(stack.pop());
+
+    if (pointer->getCell() == nullptr) {
+        throw std::runtime_error("Nil pointer dereference");
+    }
+
+    locations.push(Location::slot(pointer->getCell()));
+}
+
+void Interpreter::visitLiteralStore()
+{
+    // The literal is the only value of a new heap cell
+    locations.push(Location::slot(new Value *{held(stack.pop())}));
+}
+
+void Interpreter::visitValueStore()
+{
+    // A temporary cell, an array or struct in it is copied before it is written
+    locations.push(Location::slot(new Value *{held(stack.pop())}));
+}
+
+bool Interpreter::quickened(long& executions)
+{
+    // A negative count marks a node whose type guard failed, it stays unfused
+    if (executions < 0) return false;
+
+    if (executions < QUICKEN_THRESHOLD) {
+        ++executions;
+        return false;
+    }
+
+    return true;
+}
+
+void Interpreter::visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal)
+{
+    if (quickened(executions)) {
+        auto value = counted_cast<IntValue *>(symbolTable.get(id));
+
+        if (value != nullptr) {
+            symbolTable.set(id, new IntValue{value->getInt() + delta});
+            return;
+        }
+
+        executions = -1;
+    }
+
+    visitOriginal();
+}
+
+void Interpreter::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal)
+{
+    if (quickened(executions)) {
+        auto value = counted_cast<IntValue *>(symbolTable.get(id));
+
+        if (value != nullptr) {
+            stack.push(BoolValue::of(compare(value->getInt(), constant)));
+            return;
+        }
+
+        executions = -1;
+    }
+
+    visitOriginal();
+}
+
+void Interpreter::visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal)
+{
+    // The validator made sure it is an array of arrays indexed by ints, the row is checked before the column is evaluated
+    visitRow();
+    auto row = static_cast<IntValue *>(stack.pop()->getValue())->getInt();
+    auto array = static_cast<ArrayValue *>(stack.pop());
+    if (rowChecked) array->checked(row);
+
+    visitColumn();
+    auto column = static_cast<IntValue *>(stack.pop()->getValue())->getInt();
+
+    // Arrays of grids, or of rows of different lengths, are indexed one level at a time
+    if (array->getColumns() == 0) {
+        auto rowArray = static_cast<ArrayValue *>(array->at(row));
+        if (checked) rowArray->checked(column);
+        stack.push(rowArray->at(column));
+        return;
+    }
+
+    COUNT("grid index");
+    if (checked) array->checkedColumn(column);
+    stack.push(array->cellAt(row, column));
+}
+
+void Interpreter::visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal)
+{
+    if (!checked) {
+        COUNT("unchecked index");
+        visitIndex();
+        auto index = static_cast<IntValue *>(stack.pop()->getValue())->getInt();
+        stack.push(static_cast<ArrayValue *>(symbolTable.get(id))->at(index));
+        return;
+    }
+
+    if (quickened(executions)) {
+        visitIndex();
+        auto index = stack.pop()->getValue();
+        auto value = counted_cast<Index *>(symbolTable.get(id));
+
+        if (value != nullptr) {
+            stack.push(value->index(index));
+            return;
+        }
+
+        // The index has been evaluated already, finish the unfused form by hand
+        executions = -1;
+        visitIdentifierExpression(id);
+        stack.push(counted_cast<Index *>(stack.pop())->index(index));
+        return;
+    }
+
+    visitOriginal();
+}
@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "interpreter/layout.hpp"
+#include "interpreter/string_kernels.hpp"
+#include "utils/counters.hpp"
+
+namespace {
+
+    // FNV-1a over words, the hash of an aggregate streams its scalars through it
+    constexpr size_t HASH_OFFSET = 14695981039346656037ul;
+    constexpr size_t HASH_PRIME = 1099511628211ul;
+
+    size_t mix(size_t hash, size_t word)
+    {
+        return (hash ^ word) * HASH_PRIME;
+    }
+
+    /**
+     * Kernels of the values of one type. `element` is the layout of the
+     * values for Nested, which are aggregates themselves, and unused by the
+     * scalars. The validator made sure both operands are of the type.
+     */
+    struct Ints
+    {
+        static constexpr bool plain = true;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return static_cast<IntValue *>(lhs)->getInt() == static_cast<IntValue *>(rhs)->getInt(); }
+        static size_t hash(const Layout *element, Value *value) { return static_cast<size_t>(static_cast<IntValue *>(value)->getInt()); }
+    };
+
+    struct Runes
+    {
+        static constexpr bool plain = true;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return static_cast<RuneValue *>(lhs)->getChar() == static_cast<RuneValue *>(rhs)->getChar(); }
+        static size_t hash(const Layout *element, Value *value) { return static_cast<size_t>(static_cast<RuneValue *>(value)->getChar()); }
+    };
+
+    struct Bools
+    {
+        static constexpr bool plain = true;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return static_cast<BoolValue *>(lhs)->getBool() == static_cast<BoolValue *>(rhs)->getBool(); }
+        static size_t hash(const Layout *element, Value *value) { return static_cast<BoolValue *>(value)->getBool(); }
+    };
+
+    // NaN differs from itself, so floats are not plain
+    struct Floats
+    {
+        static constexpr bool plain = false;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return static_cast<Float32Value *>(lhs)->getFloat() == static_cast<Float32Value *>(rhs)->getFloat(); }
+
+        static size_t hash(const Layout *element, Value *value)
+        {
+            // 0 and -0 are equal
+            auto number = static_cast<Float32Value *>(value)->getFloat();
+            return number == 0 ? 0 : std::hash<float>{}(number);
+        }
+    };
+
+    struct Strings
+    {
+        static constexpr bool plain = true;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return StringValue::equals(static_cast<StringValue *>(lhs), static_cast<StringValue *>(rhs)); }
+        static size_t hash(const Layout *element, Value *value) { return static_cast<StringValue *>(value)->hash(); }
+    };
+
+    struct Pointers
+    {
+        static constexpr bool plain = true;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return static_cast<PointerValue *>(lhs)->getCell() == static_cast<PointerValue *>(rhs)->getCell(); }
+        static size_t hash(const Layout *element, Value *value) { return std::hash<Value **>{}(static_cast<PointerValue *>(value)->getCell()); }
+    };
+
+    // Ints stored into a sized element are not converted, they are read as T
+    template<typename T>
+    struct Sized
+    {
+        static constexpr bool plain = true;
+
+        static T get(Value *value)
+        {
+            if (typeid(*value) == typeid(SizedIntValue<T>)) return static_cast<SizedIntValue<T> *>(value)->get();
+            return static_cast<T>(counted_cast<Integer *>(value)->getInt());
+        }
+
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return get(lhs) == get(rhs); }
+        static size_t hash(const Layout *element, Value *value) { return static_cast<size_t>(get(value)); }
+    };
+
+    // Values of a type without a kernel, through their operations
+    struct Dynamic
+    {
+        static constexpr bool plain = false;
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return counted_cast<Equal *>(lhs)->equal(rhs); }
+        static size_t hash(const Layout *element, Value *value) { return counted_cast<Hash *>(value)->hash(); }
+    };
+
+    struct Nested
+    {
+        static bool equal(const Layout *element, Value *lhs, Value *rhs) { return element->equal(lhs, rhs); }
+        static size_t hash(const Layout *element, Value *value) { return element->hash(value); }
+    };
+
+}
+
+Layout::Layout(EqualKernel equalKernel, HashKernel hashKernel, EqualKernel arrayEqualKernel, HashKernel arrayHashKernel, bool plain, std::vector<const Layout *> parts)
+    : equalKernel{equalKernel}, hashKernel{hashKernel}, arrayEqualKernel{arrayEqualKernel}, arrayHashKernel{arrayHashKernel}, plain{plain}, parts{std::move(parts)}
+{}
+
+template<typename Scalar>
+const Layout *Layout::scalar()
+{
+    static const Layout layout{equalScalars<Scalar>, hashScalar<Scalar>, equalArrays<Scalar>, hashArray<Scalar>, Scalar::plain, {}};
+    return &layout;
+}
+
+const Layout *Layout::scalar(Value *zero)
+{
+    if (zero == nullptr) return scalar<Dynamic>();
+
+    const auto& type = typeid(*zero);
+
+    if (type == typeid(IntValue)) return scalar<Ints>();
+    if (type == typeid(RuneValue)) return scalar<Runes>();
+    if (type == typeid(BoolValue)) return scalar<Bools>();
+    if (type == typeid(Float32Value)) return scalar<Floats>();
+    if (type == typeid(StringValue)) return scalar<Strings>();
+    if (type == typeid(PointerValue)) return scalar<Pointers>();
+    if (type == typeid(SizedIntValue<int8_t>)) return scalar<Sized<int8_t>>();
+    if (type == typeid(SizedIntValue<int16_t>)) return scalar<Sized<int16_t>>();
+    if (type == typeid(SizedIntValue<int32_t>)) return scalar<Sized<int32_t>>();
+    if (type == typeid(SizedIntValue<int64_t>)) return scalar<Sized<int64_t>>();
+    if (type == typeid(SizedIntValue<uint8_t>)) return scalar<Sized<uint8_t>>();
+    if (type == typeid(SizedIntValue<uint16_t>)) return scalar<Sized<uint16_t>>();
+    if (type == typeid(SizedIntValue<uint32_t>)) return scalar<Sized<uint32_t>>();
+    if (type == typeid(SizedIntValue<uint64_t>)) return scalar<Sized<uint64_t>>();
+
+    return scalar<Dynamic>();
+}
+
+const Layout *Layout::array(const Layout *element)
+{
+    static std::unordered_map<const Layout *, const Layout *> arrays;
+
+    auto& layout = arrays[element];
+    if (layout == nullptr) {
+        COUNT("new Layout");
+        layout = new Layout{element->arrayEqualKernel, element->arrayHashKernel, equalArrays<Nested>, hashArray<Nested>, element->plain, {element}};
+    }
+
+    return layout;
+}
+
+const Layout *Layout::structure(const std::vector<const Layout *>& fields)
+{
+    static std::map<std::vector<const Layout *>, const Layout *> structures;
+
+    auto& layout = structures[fields];
+    if (layout == nullptr) {
+        COUNT("new Layout");
+        auto plain = !fields.empty() && std::all_of(fields.begin(), fields.end(), [](const Layout *field) { return field->plain; });
+        layout = new Layout{equalStructs, hashStruct, equalArrays<Nested>, hashArray<Nested>, plain, fields};
+    }
+
+    return layout;
+}
+
+bool Layout::equal(Value *lhs, Value *rhs) const
+{
+    return (plain && lhs == rhs) || equalKernel(this, lhs, rhs);
+}
+
+size_t Layout::hash(Value *value) const
+{
+    return hashKernel(this, value);
+}
+
+const Layout *Layout::element() const
+{
+    return parts.front();
+}
+
+template<typename Scalar>
+bool Layout::equalScalars(const Layout *layout, Value *lhs, Value *rhs)
+{
+    return Scalar::equal(nullptr, lhs, rhs);
+}
+
+template<typename Scalar>
+size_t Layout::hashScalar(const Layout *layout, Value *value)
+{
+    return Scalar::hash(nullptr, value);
+}
+
+template<typename Scalar>
+bool Layout::equalArrays(const Layout *layout, Value *lhs, Value *rhs)
+{
+    const auto& lhsValues = static_cast<ArrayValue *>(lhs)->getArray();
+    const auto& rhsValues = static_cast<ArrayValue *>(rhs)->getArray();
+
+    if (lhsValues.size() != rhsValues.size()) return false;
+
+    // Arrays a copy on write left sharing every element, one wide compare of their addresses
+    auto bytes = static_cast<long>(lhsValues.size() * sizeof(Value *));
+    if (layout->plain && StringKernels::equal(reinterpret_cast<const char *>(lhsValues.data()), reinterpret_cast<const char *>(rhsValues.data()), bytes)) {
+        return true;
+    }
+
+    auto element = layout->parts.front();
+
+    for (size_t i = 0; i < lhsValues.size(); ++i) {
+        if (layout->plain && lhsValues[i] == rhsValues[i]) continue;
+        if (!Scalar::equal(element, lhsValues[i], rhsValues[i])) return false;
+    }
+
+    return true;
+}
+
+template<typename Scalar>
+size_t Layout::hashArray(const Layout *layout, Value *value)
+{
+    auto element = layout->parts.front();
+    auto hash = HASH_OFFSET;
+
+    for (auto item : static_cast<ArrayValue *>(value)->getArray()) {
+        hash = mix(hash, Scalar::hash(element, item));
+    }
+
+    return hash;
+}
+
+bool Layout::equalStructs(const Layout *layout, Value *lhs, Value *rhs)
+{
+    const auto& lhsFields = static_cast<StructValue *>(lhs)->getFields();
+    const auto& rhsFields = static_cast<StructValue *>(rhs)->getFields();
+
+    if (lhsFields.size() != rhsFields.size()) return false;
+
+    for (size_t i = 0; i < lhsFields.size(); ++i) {
+        auto field = layout->parts.empty() ? scalar<Dynamic>() : layout->parts[i];
+        if (!field->equal(lhsFields[i], rhsFields[i])) return false;
+    }
+
+    return true;
+}
+
+size_t Layout::hashStruct(const Layout *layout, Value *value)
+{
+    const auto& fields = static_cast<StructValue *>(value)->getFields();
+    auto hash = HASH_OFFSET;
+
+    for (size_t i = 0; i < fields.size(); ++i) {
+        auto field = layout->parts.empty() ? scalar<Dynamic>() : layout->parts[i];
+        hash = mix(hash, field->hash(fields[i]));
+    }
+
+    return hash;
+}
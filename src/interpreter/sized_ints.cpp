@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+#include "interpreter/values.hpp"
+#include "utils/counters.hpp"
+
+namespace {
+
+    /**
+     * Type the kernels of T compute in: unsigned so overflow wraps instead
+     * of being undefined, and at least as wide as an int so the operands
+     * are not promoted back to a signed int first
+     */
+    template<typename T>
+    using Wide = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, std::make_unsigned_t<T>>;
+
+    template<typename T>
+    T wrap(Wide<T> value)
+    {
+        return static_cast<T>(value);
+    }
+
+}
+
+template<typename T>
+SizedIntValue<T>::SizedIntValue(T value)
+    : value{value}
+{
+    COUNT("new SizedIntValue");
+}
+
+template<typename T>
+T SizedIntValue<T>::get()
+{
+    return value;
+}
+
+template<typename T>
+SizedIntValue<T> *SizedIntValue<T>::of(T value)
+{
+    if constexpr (sizeof(T) == 1) {
+        static auto shared = []() {
+            std::array<SizedIntValue *, 256> values;
+            for (long i = 0; i < 256; ++i) values[i] = new SizedIntValue{static_cast<T>(i)};
+            return values;
+        }();
+
+        return shared[static_cast<uint8_t>(value)];
+    } else {
+        return new SizedIntValue{value};
+    }
+}
+
+template<typename T>
+T SizedIntValue<T>::operand(Value *other)
+{
+    other = other->getValue();
+
+    // Exact type checks, the common operands skip the cast through the class hierarchy
+    if (typeid(*other) == typeid(SizedIntValue)) return static_cast<SizedIntValue *>(other)->value;
+    if (typeid(*other) == typeid(IntValue)) return static_cast<T>(static_cast<IntValue *>(other)->getInt());
+
+    return static_cast<T>(counted_cast<Integer *>(other)->getInt());
+}
+
+template<typename T>
+long SizedIntValue<T>::getInt()
+{
+    return static_cast<long>(value);
+}
+
+template<typename T>
+Value *SizedIntValue<T>::withInt(long value)
+{
+    return of(static_cast<T>(value));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::packedSlice(const std::vector<Value *>& values)
+{
+    std::vector<T> packed;
+    packed.reserve(values.size());
+
+    for (auto value : values) packed.push_back(operand(value));
+
+    return new PackedSliceValue<T>{std::move(packed)};
+}
+
+template<typename T>
+Value *SizedIntValue<T>::unaryPlus()
+{
+    return this;
+}
+
+template<typename T>
+Value *SizedIntValue<T>::negate()
+{
+    return of(wrap<T>(-static_cast<Wide<T>>(value)));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::bitwiseNot()
+{
+    return of(wrap<T>(~static_cast<Wide<T>>(value)));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::increment(long delta)
+{
+    return of(wrap<T>(static_cast<Wide<T>>(value) + static_cast<Wide<T>>(delta)));
+}
+
+template<typename T>
+bool SizedIntValue<T>::equal(Value *other)
+{
+    return value == operand(other);
+}
+
+template<typename T>
+size_t SizedIntValue<T>::hash()
+{
+    return std::hash<T>{}(value);
+}
+
+template<typename T>
+bool SizedIntValue<T>::notEqual(Value *other)
+{
+    return value != operand(other);
+}
+
+template<typename T>
+bool SizedIntValue<T>::lessThan(Value *other)
+{
+    return value < operand(other);
+}
+
+template<typename T>
+bool SizedIntValue<T>::greaterThan(Value *other)
+{
+    return value > operand(other);
+}
+
+template<typename T>
+bool SizedIntValue<T>::lessThanEqual(Value *other)
+{
+    return value <= operand(other);
+}
+
+template<typename T>
+bool SizedIntValue<T>::greaterThanEqual(Value *other)
+{
+    return value >= operand(other);
+}
+
+template<typename T>
+Value *SizedIntValue<T>::shiftLeft(Value *other)
+{
+    // Counts of the width or more shift every bit out
+    auto count = static_cast<unsigned long>(counted_cast<Integer *>(other->getValue())->getInt());
+    if (count >= sizeof(T) * 8) return of(0);
+    return of(wrap<T>(static_cast<Wide<T>>(value) << count));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::shiftRight(Value *other)
+{
+    // Signed values shift in their sign bit
+    auto count = static_cast<unsigned long>(counted_cast<Integer *>(other->getValue())->getInt());
+    if (count >= sizeof(T) * 8) return of(value < 0 ? -1 : 0);
+    return of(static_cast<T>(value >> count));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::add(Value *other)
+{
+    return of(wrap<T>(static_cast<Wide<T>>(value) + static_cast<Wide<T>>(operand(other))));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::subtract(Value *other)
+{
+    return of(wrap<T>(static_cast<Wide<T>>(value) - static_cast<Wide<T>>(operand(other))));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::bitwiseOr(Value *other)
+{
+    return of(static_cast<T>(value | operand(other)));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::bitwiseXOr(Value *other)
+{
+    return of(static_cast<T>(value ^ operand(other)));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::bitwiseAnd(Value *other)
+{
+    return of(static_cast<T>(value & operand(other)));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::multiply(Value *other)
+{
+    return of(wrap<T>(static_cast<Wide<T>>(value) * static_cast<Wide<T>>(operand(other))));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::divide(Value *other)
+{
+    auto divisor = operand(other);
+    if (divisor == 0) throw std::runtime_error("Integer divide by zero");
+
+    // The most negative value divided by -1 wraps around to itself
+    if constexpr (std::is_signed_v<T>) {
+        if (divisor == -1) return negate();
+    }
+
+    return of(static_cast<T>(value / divisor));
+}
+
+template<typename T>
+Value *SizedIntValue<T>::modulo(Value *other)
+{
+    auto divisor = operand(other);
+    if (divisor == 0) throw std::runtime_error("Integer divide by zero");
+
+    if constexpr (std::is_signed_v<T>) {
+        if (divisor == -1) return of(0);
+    }
+
+    return of(static_cast<T>(value % divisor));
+}
+
+template<typename T>
+PackedSliceValue<T>::PackedSliceValue(std::vector<T> values)
+    : values{std::move(values)}
+{
+    COUNT("new PackedSliceValue");
+}
+
+template<typename T>
+long PackedSliceValue<T>::checked(Value *index)
+{
+    auto indexValue = counted_cast<Integer *>(index->getValue())->getInt();
+
+    if (indexValue < 0 || indexValue >= values.size()) {
+        throw std::runtime_error("Index out of bounds");
+    }
+
+    return indexValue;
+}
+
+template<typename T>
+Value *PackedSliceValue<T>::index(Value *index)
+{
+    return SizedIntValue<T>::of(values[checked(index)]);
+}
+
+template<typename T>
+void PackedSliceValue<T>::setIndex(Value *index, Value *newValue)
+{
+    values[checked(index)] = static_cast<T>(counted_cast<Integer *>(newValue->getValue())->getInt());
+}
+
+template<typename T>
+Value **PackedSliceValue<T>::indexSlot(Value *index)
+{
+    return nullptr;
+}
+
+template<typename T>
+Value *PackedSliceValue<T>::simpleSlice(Value *low, Value *high)
+{
+    long lowValue = 0;
+    long highValue = values.size();
+
+    if (low != nullptr) {
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
+    }
+
+    if (high != nullptr) {
+        highValue = counted_cast<Integer *>(high->getValue())->getInt();
+    }
+
+    return new PackedSliceValue{std::vector<T>(values.begin() + lowValue, values.begin() + highValue)};
+}
+
+template<typename T>
+Value *PackedSliceValue<T>::fullSlice(Value *low, Value *high, Value *max)
+{
+    long lowValue = 0;
+
+    if (low != nullptr) {
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
+    }
+
+    long highValue = counted_cast<Integer *>(high->getValue())->getInt();
+    long maxValue = counted_cast<Integer *>(max->getValue())->getInt();
+
+    return new PackedSliceValue{std::vector<T>(values.begin() + lowValue, values.begin() + std::min(highValue, lowValue + maxValue))};
+}
+
+template<typename T>
+bool PackedSliceValue<T>::equal(Value *other)
+{
+    return values == counted_cast<PackedSliceValue *>(other->getValue())->values;
+}
+
+template<typename T>
+bool PackedSliceValue<T>::notEqual(Value *other)
+{
+    return values != counted_cast<PackedSliceValue *>(other->getValue())->values;
+}
+
+template class SizedIntValue<int8_t>;
+template class SizedIntValue<int16_t>;
+template class SizedIntValue<int32_t>;
+template class SizedIntValue<int64_t>;
+template class SizedIntValue<uint8_t>;
+template class SizedIntValue<uint16_t>;
+template class SizedIntValue<uint32_t>;
+template class SizedIntValue<uint64_t>;
+
+template class PackedSliceValue<int8_t>;
+template class PackedSliceValue<int16_t>;
+template class PackedSliceValue<int32_t>;
+template class PackedSliceValue<int64_t>;
+template class PackedSliceValue<uint8_t>;
+template class PackedSliceValue<uint16_t>;
+template class PackedSliceValue<uint32_t>;
+template class PackedSliceValue<uint64_t>;
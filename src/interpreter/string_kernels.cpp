@@ -0,0 +1,271 @@
+#include <cstring>
+
+#include "interpreter/string_kernels.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+    int byteOrder(char lhs, char rhs)
+    {
+        return static_cast<unsigned char>(lhs) < static_cast<unsigned char>(rhs) ? -1 : 1;
+    }
+
+    struct Kernels
+    {
+        int (*compare)(const char *lhs, const char *rhs, long size);
+        bool (*equal)(const char *lhs, const char *rhs, long size);
+        long (*stripNul)(const char *source, long size, char *destination);
+        long (*find)(const char *haystack, long size, const char *needle, long needleSize);
+    };
+
+#if defined(__x86_64__)
+
+    // SSE2 is part of x86-64, these need no check
+
+    int compareSse2(const char *lhs, const char *rhs, long size)
+    {
+        long i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i));
+            unsigned differ = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) ^ 0xFFFF;
+
+            if (differ != 0) {
+                auto at = i + __builtin_ctz(differ);
+                return byteOrder(lhs[at], rhs[at]);
+            }
+        }
+
+        return StringKernels::Scalar::compare(lhs + i, rhs + i, size - i);
+    }
+
+    bool equalSse2(const char *lhs, const char *rhs, long size)
+    {
+        long i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF) return false;
+        }
+
+        return StringKernels::Scalar::equal(lhs + i, rhs + i, size - i);
+    }
+
+    long stripNulSse2(const char *source, long size, char *destination)
+    {
+        auto zero = _mm_setzero_si128();
+        long i = 0;
+        long copied = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, zero)) == 0) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + copied), block);
+                copied += 16;
+            } else {
+                copied += StringKernels::Scalar::stripNul(source + i, 16, destination + copied);
+            }
+        }
+
+        return copied + StringKernels::Scalar::stripNul(source + i, size - i, destination + copied);
+    }
+
+    // Candidates match the first and last byte of the needle, only those are compared in full
+    long findSse2(const char *haystack, long size, const char *needle, long needleSize)
+    {
+        if (needleSize == 0) return 0;
+
+        auto first = _mm_set1_epi8(needle[0]);
+        auto last = _mm_set1_epi8(needle[needleSize - 1]);
+        long i = 0;
+
+        for (; i + needleSize - 1 + 16 <= size; i += 16) {
+            auto blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i));
+            auto blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i + needleSize - 1));
+            unsigned candidates = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last)));
+
+            while (candidates != 0) {
+                auto at = i + __builtin_ctz(candidates);
+                if (std::memcmp(haystack + at, needle, needleSize) == 0) return at;
+                candidates &= candidates - 1;
+            }
+        }
+
+        auto rest = StringKernels::Scalar::find(haystack + i, size - i, needle, needleSize);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    __attribute__((target("avx2")))
+    int compareAvx2(const char *lhs, const char *rhs, long size)
+    {
+        long i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+            auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + i));
+            unsigned differ = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+
+            if (differ != 0) {
+                auto at = i + __builtin_ctz(differ);
+                return byteOrder(lhs[at], rhs[at]);
+            }
+        }
+
+        return compareSse2(lhs + i, rhs + i, size - i);
+    }
+
+    __attribute__((target("avx2")))
+    bool equalAvx2(const char *lhs, const char *rhs, long size)
+    {
+        long i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+            auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + i));
+
+            if (static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))) != 0xFFFFFFFF) return false;
+        }
+
+        return equalSse2(lhs + i, rhs + i, size - i);
+    }
+
+    __attribute__((target("avx2")))
+    long stripNulAvx2(const char *source, long size, char *destination)
+    {
+        auto zero = _mm256_setzero_si256();
+        long i = 0;
+        long copied = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, zero)) == 0) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + copied), block);
+                copied += 32;
+            } else {
+                copied += StringKernels::Scalar::stripNul(source + i, 32, destination + copied);
+            }
+        }
+
+        return copied + stripNulSse2(source + i, size - i, destination + copied);
+    }
+
+    __attribute__((target("avx2")))
+    long findAvx2(const char *haystack, long size, const char *needle, long needleSize)
+    {
+        if (needleSize == 0) return 0;
+
+        auto first = _mm256_set1_epi8(needle[0]);
+        auto last = _mm256_set1_epi8(needle[needleSize - 1]);
+        long i = 0;
+
+        for (; i + needleSize - 1 + 32 <= size; i += 32) {
+            auto blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+            auto blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i + needleSize - 1));
+            unsigned candidates = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last)));
+
+            while (candidates != 0) {
+                auto at = i + __builtin_ctz(candidates);
+                if (std::memcmp(haystack + at, needle, needleSize) == 0) return at;
+                candidates &= candidates - 1;
+            }
+        }
+
+        auto rest = findSse2(haystack + i, size - i, needle, needleSize);
+        return rest < 0 ? -1 : i + rest;
+    }
+
+    Kernels select()
+    {
+        if (__builtin_cpu_supports("avx2")) {
+            return {compareAvx2, equalAvx2, stripNulAvx2, findAvx2};
+        }
+
+        return {compareSse2, equalSse2, stripNulSse2, findSse2};
+    }
+
+#else
+
+    Kernels select()
+    {
+        using namespace StringKernels;
+        return {Scalar::compare, Scalar::equal, Scalar::stripNul, Scalar::find};
+    }
+
+#endif
+
+    const Kernels& kernels()
+    {
+        static const Kernels selected = select();
+        return selected;
+    }
+
+}
+
+int StringKernels::compare(const char *lhs, const char *rhs, long size)
+{
+    return kernels().compare(lhs, rhs, size);
+}
+
+bool StringKernels::equal(const char *lhs, const char *rhs, long size)
+{
+    return kernels().equal(lhs, rhs, size);
+}
+
+long StringKernels::stripNul(const char *source, long size, char *destination)
+{
+    return kernels().stripNul(source, size, destination);
+}
+
+long StringKernels::find(const char *haystack, long size, const char *needle, long needleSize)
+{
+    return kernels().find(haystack, size, needle, needleSize);
+}
+
+int StringKernels::Scalar::compare(const char *lhs, const char *rhs, long size)
+{
+    for (long i = 0; i < size; ++i) {
+        if (lhs[i] != rhs[i]) return byteOrder(lhs[i], rhs[i]);
+    }
+
+    return 0;
+}
+
+bool StringKernels::Scalar::equal(const char *lhs, const char *rhs, long size)
+{
+    for (long i = 0; i < size; ++i) {
+        if (lhs[i] != rhs[i]) return false;
+    }
+
+    return true;
+}
+
+long StringKernels::Scalar::stripNul(const char *source, long size, char *destination)
+{
+    long copied = 0;
+
+    for (long i = 0; i < size; ++i) {
+        if (source[i] != '\0') destination[copied++] = source[i];
+    }
+
+    return copied;
+}
+
+long StringKernels::Scalar::find(const char *haystack, long size, const char *needle, long needleSize)
+{
+    for (long i = 0; i + needleSize <= size; ++i) {
+        long matched = 0;
+        while (matched < needleSize && haystack[i + matched] == needle[matched]) ++matched;
+
+        if (matched == needleSize) return i;
+    }
+
+    return -1;
+}
@@ -1,53 +1,110 @@
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
 #include "interpreter/values.hpp"
+#include "interpreter/layout.hpp"
+#include "interpreter/string_kernels.hpp"
+#include "utils/counters.hpp"
+
+namespace {
+
+    // `value` as the sized integer type of `other`, for an int on the left of a sized integer
+    template<typename Operation>
+    Operation *promoted(long value, Value *other)
+    {
+        return counted_cast<Operation *>(counted_cast<Integer *>(other->getValue())->withInt(value));
+    }
+
+}
 
 Value *Value::getValue()
 {
     return this;
 }
 
+Value *Value::hold()
+{
+    return this;
+}
+
+void Value::release()
+{}
+
+Value *Value::owned(Value *parent)
+{
+    return this;
+}
+
+void Value::pin()
+{}
+
 BoolValue::BoolValue(bool value)
     : value{value}
-{}
+{
+    COUNT("new BoolValue");
+}
 
 bool BoolValue::getBool()
 {
     return value;
 }
 
+BoolValue *BoolValue::of(bool value)
+{
+    static BoolValue trueValue{true};
+    static BoolValue falseValue{false};
+
+    return value ? &trueValue : &falseValue;
+}
+
 Value *BoolValue::logicalNot()
 {
-    return new BoolValue{!value};
+    return of(!value);
 }
 
 Value *BoolValue::logicalOr(Value *other)
 {
-    return new BoolValue{value || dynamic_cast<BoolValue *>(other->getValue())->value};
+    return of(value || static_cast<BoolValue *>(other->getValue())->value);
 }
 
 Value *BoolValue::logicalAnd(Value *other)
 {
-    return new BoolValue{value && dynamic_cast<BoolValue *>(other->getValue())->value};
+    return of(value && static_cast<BoolValue *>(other->getValue())->value);
 }
 
-Value *BoolValue::equal(Value *other)
+bool BoolValue::equal(Value *other)
 {
-    return new BoolValue{value == dynamic_cast<BoolValue *>(other->getValue())->value};
+    return value == counted_cast<BoolValue *>(other->getValue())->value;
 }
 
-Value *BoolValue::notEqual(Value *other)
+size_t BoolValue::hash()
 {
-    return new BoolValue{value != dynamic_cast<BoolValue *>(other->getValue())->value};
+    return value;
+}
+
+bool BoolValue::notEqual(Value *other)
+{
+    return value != counted_cast<BoolValue *>(other->getValue())->value;
 }
 
 IntValue::IntValue(long value)
     : value{value}
-{}
+{
+    COUNT("new IntValue");
+}
 
 long IntValue::getInt()
 {
     return value;
 }
 
+Value *IntValue::withInt(long value)
+{
+    return new IntValue{value};
+}
+
 Value *IntValue::unaryPlus()
 {
     return new IntValue{value};
@@ -63,89 +120,129 @@ Value *IntValue::bitwiseNot()
     return new IntValue{~value};
 }
 
-Value *IntValue::equal(Value *other)
+Value *IntValue::increment(long delta)
+{
+    return new IntValue{value + delta};
+}
+
+bool IntValue::equal(Value *other)
+{
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Equal>(value, other)->equal(other);
+    return value == integer->value;
+}
+
+size_t IntValue::hash()
 {
-    return new BoolValue{value == dynamic_cast<IntValue *>(other->getValue())->value};
+    return std::hash<long>{}(value);
 }
 
-Value *IntValue::notEqual(Value *other)
+bool IntValue::notEqual(Value *other)
 {
-    return new BoolValue{value != dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<NotEqual>(value, other)->notEqual(other);
+    return value != integer->value;
 }
 
-Value *IntValue::lessThan(Value *other)
+bool IntValue::lessThan(Value *other)
 {
-    return new BoolValue{value < dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<LessThan>(value, other)->lessThan(other);
+    return value < integer->value;
 }
 
-Value *IntValue::greaterThan(Value *other)
+bool IntValue::greaterThan(Value *other)
 {
-    return new BoolValue{value > dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<GreaterThan>(value, other)->greaterThan(other);
+    return value > integer->value;
 }
 
-Value *IntValue::lessThanEqual(Value *other)
+bool IntValue::lessThanEqual(Value *other)
 {
-    return new BoolValue{value <= dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<LessThanEqual>(value, other)->lessThanEqual(other);
+    return value <= integer->value;
 }
 
-Value *IntValue::greaterThanEqual(Value *other)
+bool IntValue::greaterThanEqual(Value *other)
 {
-    return new BoolValue{value >= dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<GreaterThanEqual>(value, other)->greaterThanEqual(other);
+    return value >= integer->value;
 }
 
 Value *IntValue::shiftLeft(Value *other)
 {
-    return new IntValue{value << dynamic_cast<IntValue *>(other->getValue())->value};
+    return new IntValue{value << counted_cast<Integer *>(other->getValue())->getInt()};
 }
 
 Value *IntValue::shiftRight(Value *other)
 {
-    return new IntValue{value >> dynamic_cast<IntValue *>(other->getValue())->value};
+    return new IntValue{value >> counted_cast<Integer *>(other->getValue())->getInt()};
 }
 
 Value *IntValue::add(Value *other)
 {
-    return new IntValue{value + dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Add>(value, other)->add(other);
+    return new IntValue{value + integer->value};
 }
 
 Value *IntValue::subtract(Value *other)
 {
-    return new IntValue{value - dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Subtract>(value, other)->subtract(other);
+    return new IntValue{value - integer->value};
 }
 
 Value *IntValue::bitwiseOr(Value *other)
 {
-    return new IntValue{value | dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<BitwiseOr>(value, other)->bitwiseOr(other);
+    return new IntValue{value | integer->value};
 }
 
 Value *IntValue::bitwiseXOr(Value *other)
 {
-    return new IntValue{value ^ dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<BitwiseXOr>(value, other)->bitwiseXOr(other);
+    return new IntValue{value ^ integer->value};
 }
 
 Value *IntValue::bitwiseAnd(Value *other)
 {
-    return new IntValue{value & dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<BitwiseAnd>(value, other)->bitwiseAnd(other);
+    return new IntValue{value & integer->value};
 }
 
 Value *IntValue::multiply(Value *other)
 {
-    return new IntValue{value * dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Multiply>(value, other)->multiply(other);
+    return new IntValue{value * integer->value};
 }
 
 Value *IntValue::divide(Value *other)
 {
-    return new IntValue{value / dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Divide>(value, other)->divide(other);
+    return new IntValue{value / integer->value};
 }
 
 Value *IntValue::modulo(Value *other)
 {
-    return new IntValue{value % dynamic_cast<IntValue *>(other->getValue())->value};
+    auto integer = counted_cast<IntValue *>(other->getValue());
+    if (integer == nullptr) return promoted<Modulo>(value, other)->modulo(other);
+    return new IntValue{value % integer->value};
 }
 
 Float32Value::Float32Value(float value)
     : value{value}
-{}
+{
+    COUNT("new Float32Value");
+}
 
 float Float32Value::getFloat()
 {
@@ -162,144 +259,205 @@ Value *Float32Value::negate()
     return new Float32Value{-value};
 }
 
-Value *Float32Value::equal(Value *other)
+Value *Float32Value::increment(long delta)
 {
-    return new BoolValue{value == dynamic_cast<Float32Value *>(other->getValue())->value};
+    return new Float32Value{value + delta};
 }
 
-Value *Float32Value::notEqual(Value *other)
+bool Float32Value::equal(Value *other)
 {
-    return new BoolValue{value != dynamic_cast<Float32Value *>(other->getValue())->value};
+    return value == counted_cast<Float32Value *>(other->getValue())->value;
 }
 
-Value *Float32Value::lessThan(Value *other)
+size_t Float32Value::hash()
 {
-    return new BoolValue{value < dynamic_cast<Float32Value *>(other->getValue())->value};
+    return std::hash<float>{}(value);
 }
 
-Value *Float32Value::greaterThan(Value *other)
+bool Float32Value::notEqual(Value *other)
 {
-    return new BoolValue{value > dynamic_cast<Float32Value *>(other->getValue())->value};
+    return value != counted_cast<Float32Value *>(other->getValue())->value;
 }
 
-Value *Float32Value::lessThanEqual(Value *other)
+bool Float32Value::lessThan(Value *other)
 {
-    return new BoolValue{value <= dynamic_cast<Float32Value *>(other->getValue())->value};
+    return value < counted_cast<Float32Value *>(other->getValue())->value;
 }
 
-Value *Float32Value::greaterThanEqual(Value *other)
+bool Float32Value::greaterThan(Value *other)
 {
-    return new BoolValue{value >= dynamic_cast<Float32Value *>(other->getValue())->value};
+    return value > counted_cast<Float32Value *>(other->getValue())->value;
+}
+
+bool Float32Value::lessThanEqual(Value *other)
+{
+    return value <= counted_cast<Float32Value *>(other->getValue())->value;
+}
+
+bool Float32Value::greaterThanEqual(Value *other)
+{
+    return value >= counted_cast<Float32Value *>(other->getValue())->value;
 }
 
 Value *Float32Value::add(Value *other)
 {
-    return new Float32Value{value + dynamic_cast<Float32Value *>(other->getValue())->value};
+    return new Float32Value{value + counted_cast<Float32Value *>(other->getValue())->value};
 }
 
 Value *Float32Value::subtract(Value *other)
 {
-    return new Float32Value{value - dynamic_cast<Float32Value *>(other->getValue())->value};
+    return new Float32Value{value - counted_cast<Float32Value *>(other->getValue())->value};
 }
 
 Value *Float32Value::multiply(Value *other)
 {
-    return new Float32Value{value * dynamic_cast<Float32Value *>(other->getValue())->value};
+    return new Float32Value{value * counted_cast<Float32Value *>(other->getValue())->value};
 }
 
 Value *Float32Value::divide(Value *other)
 {
-    return new Float32Value{value / dynamic_cast<Float32Value *>(other->getValue())->value};
+    return new Float32Value{value / counted_cast<Float32Value *>(other->getValue())->value};
 }
 
 RuneValue::RuneValue(char value)
     : value{value}
-{}
+{
+    COUNT("new RuneValue");
+}
 
 char RuneValue::getChar()
 {
     return value;
 }
 
-Value *RuneValue::equal(Value *other)
+long RuneValue::getInt()
+{
+    return value;
+}
+
+Value *RuneValue::withInt(long value)
+{
+    return new RuneValue{static_cast<char>(value)};
+}
+
+Value *RuneValue::increment(long delta)
 {
-    return new BoolValue{value == dynamic_cast<RuneValue *>(other->getValue())->value};
+    return new RuneValue{static_cast<char>(value + delta)};
 }
 
-Value *RuneValue::notEqual(Value *other)
+bool RuneValue::equal(Value *other)
 {
-    return new BoolValue{value != dynamic_cast<RuneValue *>(other->getValue())->value};
+    return value == counted_cast<RuneValue *>(other->getValue())->value;
 }
 
-Value *RuneValue::lessThan(Value *other)
+size_t RuneValue::hash()
 {
-    return new BoolValue{value < dynamic_cast<RuneValue *>(other->getValue())->value};
+    return std::hash<char>{}(value);
 }
 
-Value *RuneValue::greaterThan(Value *other)
+bool RuneValue::notEqual(Value *other)
 {
-    return new BoolValue{value > dynamic_cast<RuneValue *>(other->getValue())->value};
+    return value != counted_cast<RuneValue *>(other->getValue())->value;
 }
 
-Value *RuneValue::lessThanEqual(Value *other)
+bool RuneValue::lessThan(Value *other)
 {
-    return new BoolValue{value <= dynamic_cast<RuneValue *>(other->getValue())->value};
+    return value < counted_cast<RuneValue *>(other->getValue())->value;
 }
 
-Value *RuneValue::greaterThanEqual(Value *other)
+bool RuneValue::greaterThan(Value *other)
 {
-    return new BoolValue{value >= dynamic_cast<RuneValue *>(other->getValue())->value};
+    return value > counted_cast<RuneValue *>(other->getValue())->value;
+}
+
+bool RuneValue::lessThanEqual(Value *other)
+{
+    return value <= counted_cast<RuneValue *>(other->getValue())->value;
+}
+
+bool RuneValue::greaterThanEqual(Value *other)
+{
+    return value >= counted_cast<RuneValue *>(other->getValue())->value;
 }
 
 Value *RuneValue::add(Value *other)
 {
-    return new RuneValue{static_cast<char>( value + dynamic_cast<RuneValue *>(other->getValue())->value)};
+    return new RuneValue{static_cast<char>( value + counted_cast<RuneValue *>(other->getValue())->value)};
 }
 
 Value *RuneValue::subtract(Value *other)
 {
-    return new RuneValue{static_cast<char>( value - dynamic_cast<RuneValue *>(other->getValue())->value)};
+    return new RuneValue{static_cast<char>( value - counted_cast<RuneValue *>(other->getValue())->value)};
 }
 
 Value *RuneValue::multiply(Value *other)
 {
-    return new RuneValue{static_cast<char>( value * dynamic_cast<RuneValue *>(other->getValue())->value)};
+    return new RuneValue{static_cast<char>( value * counted_cast<RuneValue *>(other->getValue())->value)};
 }
 
 Value *RuneValue::divide(Value *other)
 {
-    return new RuneValue{static_cast<char>( value / dynamic_cast<RuneValue *>(other->getValue())->value)};
+    return new RuneValue{static_cast<char>( value / counted_cast<RuneValue *>(other->getValue())->value)};
 }
 
-StringValue::StringValue(char *value, long size)
-    : value{value}, size{size}
+StringValue::StringValue(const char *value, long size)
+    : size{size}, buffer{nullptr}
 {
-    this->value = new char[size];
+    COUNT("new StringValue");
 
-    for (int i = 0; i < size; ++i) {
-        this->value[i] = value[i];
+    if (size <= INLINE_SIZE) {
+        std::copy_n(value, size, inlined);
+        return;
     }
+
+    buffer = new Buffer{1, size, size, new char[size]};
+    offset = 0;
+    std::copy_n(value, size, buffer->bytes);
+}
+
+StringValue::StringValue(Buffer *buffer, long offset, long size)
+    : size{size}, buffer{buffer}
+{
+    COUNT("new StringValue");
+
+    this->offset = offset;
+    ++buffer->references;
 }
 
 StringValue::~StringValue()
 {
-    delete value;
+    if (buffer != nullptr && --buffer->references == 0) {
+        delete[] buffer->bytes;
+        delete buffer;
+    }
 }
 
 StringValue::String StringValue::getString()
 {
-    return {value, size};
+    return {data(), size};
+}
+
+StringValue *StringValue::intern(const char *value, long size)
+{
+    static std::map<std::string, StringValue *> interned{};
+
+    auto& string = interned[std::string{value, static_cast<size_t>(size)}];
+    if (string == nullptr) string = new StringValue{value, size};
+
+    return string;
+}
+
+const char *StringValue::data() const
+{
+    return buffer == nullptr ? inlined : buffer->bytes + offset;
 }
 
 long StringValue::compare(StringValue *lhs, StringValue *rhs)
 {
+    auto common = StringKernels::compare(lhs->data(), rhs->data(), std::min(lhs->size, rhs->size));
 
-    for (int i = 0; i < lhs->size && i < rhs->size; ++i) {
-        if (lhs->value[i] < rhs->value[i]) {
-            return -1;
-        } else if (lhs->value[i] > rhs->value[i]) {
-            return 1;
-        }
+    if (common != 0) {
+        return common;
     }
 
     if (lhs->size < rhs->size) {
@@ -311,181 +469,358 @@ long StringValue::compare(StringValue *lhs, StringValue *rhs)
     }
 }
 
+bool StringValue::equals(StringValue *lhs, StringValue *rhs)
+{
+    return lhs->size == rhs->size && StringKernels::equal(lhs->data(), rhs->data(), lhs->size);
+}
+
 Value *StringValue::index(Value *index)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    auto indexValue = counted_cast<Integer *>(index->getValue())->getInt();
 
-    if (indexValue >= size) {
+    if (indexValue < 0 || indexValue >= size) {
         throw std::runtime_error("Index out of bounds");
     }
 
-    return new RuneValue{value[indexValue]};
+    return new RuneValue{data()[indexValue]};
 }
 
 void StringValue::setIndex(Value *index, Value *newValue)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    throw std::runtime_error("Strings are immutable");
+}
 
-    if (indexValue >= size) {
-        throw std::runtime_error("Index out of bounds");
+Value **StringValue::indexSlot(Value *index)
+{
+    throw std::runtime_error("Strings are immutable");
+}
+
+Value *StringValue::slice(long low, long high)
+{
+    if (low < 0 || high < low || high > size) {
+        throw std::runtime_error("Slice bounds out of range");
+    }
+
+    // Short slices are copied so they don't keep a large buffer alive
+    if (buffer == nullptr || high - low <= INLINE_SIZE) {
+        return new StringValue{data() + low, high - low};
     }
 
-    value[indexValue] = dynamic_cast<RuneValue *>(newValue->getValue())->getChar();
+    return new StringValue{buffer, offset + low, high - low};
 }
 
 Value *StringValue::simpleSlice(Value *low, Value *high)
 {
-    // TODO: out of range
-    auto lowValue = 0;
-    auto newSize = size;
+    long lowValue = 0;
+    long highValue = size;
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
     if (high != nullptr) {
-        newSize = dynamic_cast<IntValue *>(high->getValue())->getInt() - lowValue;
+        highValue = counted_cast<Integer *>(high->getValue())->getInt();
     }
 
-    auto newValue = new char[newSize];
-    
-    for (int i = 0; i < newSize; ++i) {
-        newValue[i] = value[i + lowValue];
-    }
-
-    return new StringValue{newValue, newSize};
+    return slice(lowValue, highValue);
 }
 
 Value *StringValue::fullSlice(Value *low, Value *high, Value *max)
 {
-    // TODO: out of range
-    auto lowValue = 0;
+    long lowValue = 0;
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
-    auto highSize = dynamic_cast<IntValue *>(high->getValue())->getInt() - lowValue;
-    auto maxSize = dynamic_cast<IntValue *>(max->getValue())->getInt();
+    long highSize = counted_cast<Integer *>(high->getValue())->getInt() - lowValue;
+    long maxSize = counted_cast<Integer *>(max->getValue())->getInt();
 
-    auto newSize = highSize < maxSize ? highSize : maxSize;
+    return slice(lowValue, lowValue + (highSize < maxSize ? highSize : maxSize));
+}
 
-    auto newValue = new char[newSize];
-    
-    for (int i = 0; i < newSize; ++i) {
-        newValue[i] = value[i + lowValue];
-    }
+bool StringValue::equal(Value *other)
+{
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return equals(this, otherString);
+}
 
-    return new StringValue{newValue, newSize};
+size_t StringValue::hash()
+{
+    return std::hash<std::string_view>{}(std::string_view{data(), static_cast<size_t>(size)});
 }
 
+bool StringValue::notEqual(Value *other)
+{
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return !equals(this, otherString);
+}
 
+bool StringValue::lessThan(Value *other)
+{
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return compare(this, otherString) < 0;
+}
 
-Value *StringValue::equal(Value *other)
+bool StringValue::greaterThan(Value *other)
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) == 0};
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return compare(this, otherString) > 0;
 }
 
-Value *StringValue::notEqual(Value *other)
+bool StringValue::lessThanEqual(Value *other)
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) != 0};
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return compare(this, otherString) <= 0;
 }
 
-Value *StringValue::lessThan(Value *other)
+bool StringValue::greaterThanEqual(Value *other)
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) < 0};
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    return compare(this, otherString) >= 0;
 }
 
-Value *StringValue::greaterThan(Value *other)
+Value *StringValue::add(Value *other)
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) > 0};
+    auto otherString = counted_cast<StringValue *>(other->getValue());
+    auto newSize = size + otherString->size;
+
+    if (newSize <= INLINE_SIZE) {
+        char bytes[INLINE_SIZE];
+        std::copy_n(data(), size, bytes);
+        std::copy_n(otherString->data(), otherString->size, bytes + size);
+        return new StringValue{bytes, newSize};
+    }
+
+    // Nothing was appended after this string yet, so grow it in place
+    if (buffer != nullptr && offset + size == buffer->used && buffer->used + otherString->size <= buffer->capacity) {
+        std::copy_n(otherString->data(), otherString->size, buffer->bytes + buffer->used);
+        buffer->used += otherString->size;
+        return new StringValue{buffer, offset, newSize};
+    }
+
+    // Leave room to append, so building a string in a loop is linear
+    auto grown = new Buffer{0, newSize, 2 * newSize, new char[2 * newSize]};
+    std::copy_n(data(), size, grown->bytes);
+    std::copy_n(otherString->data(), otherString->size, grown->bytes + size);
+
+    return new StringValue{grown, 0, newSize};
 }
 
-Value *StringValue::lessThanEqual(Value *other)
+Value *Aggregate::hold()
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) <= 0};
+    // A pointer into this value must not see the new holder's writes
+    auto value = pinned ? copy() : this;
+    ++value->holders;
+    return value;
 }
 
-Value *StringValue::greaterThanEqual(Value *other)
+void Aggregate::release()
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    return new BoolValue{compare(this, otherString) >= 0};
+    --holders;
 }
 
-Value *StringValue::add(Value *other)
+Value *Aggregate::owned(Value *parent)
 {
-    auto otherString = dynamic_cast<StringValue *>(other->getValue());
-    auto newValue = new char[this->size + otherString->size + 1];
+    Aggregate *owned = this;
 
-    for (int i = 0; i < this->size; ++i) {
-        newValue[i] = this->value[i];
+    if (holders > 1) {
+        COUNT("copy on write");
+        owned = copy();
     }
 
-    for (int j = 0; j < otherString->size; ++j) {
-        newValue[this->size + j] = otherString->value[j];
+    owned->parent = parent;
+    return owned;
+}
+
+void Aggregate::pin()
+{
+    pinned = true;
+    if (parent != nullptr) parent->pin();
+}
+
+Aggregate::Aggregate(Value *parent)
+    : pinned{true}, parent{parent}
+{}
+
+bool Aggregate::isHeld()
+{
+    return holders > 0;
+}
+
+std::vector<Value *> Aggregate::held(std::span<Value * const> values)
+{
+    std::vector<Value *> result;
+    result.reserve(values.size());
+
+    // Fields of a function type may have no value yet
+    for (auto value : values) result.push_back(value != nullptr ? value->hold() : nullptr);
+
+    return result;
+}
+
+ArrayValue::ArrayValue(std::vector<Value *> values, const Layout *layout)
+    :   values{std::move(values)}, elements{this->values.data()}, size{static_cast<long>(this->values.size())}, layout{layout}
+{
+    COUNT("new ArrayValue");
+}
+
+ArrayValue::ArrayValue(std::vector<Value *> cells, long columns, const Layout *layout)
+    :   values(cells.size() / columns, nullptr), cells{std::move(cells)}, elements{values.data()}, size{static_cast<long>(values.size())}, columns{columns}, layout{layout}
+{
+    COUNT("new ArrayValue");
+}
+
+ArrayValue::ArrayValue(ArrayValue *grid, long row)
+    :   Aggregate{grid}, elements{grid->cells.data() + row * grid->columns}, size{grid->columns}, layout{grid->layout->element()}
+{
+    COUNT("new row view");
+}
+
+ArrayValue *ArrayValue::of(std::vector<Value *> values, const Layout *layout)
+{
+    // Rows of one length, an array of grids stays an array of its grids
+    auto rows = !values.empty() && std::all_of(values.begin(), values.end(), [&values](Value *value) {
+        if (typeid(*value) != typeid(ArrayValue)) return false;
+        auto row = static_cast<ArrayValue *>(value);
+        return row->columns == 0 && row->size != 0 && row->size == static_cast<ArrayValue *>(values[0])->size;
+    });
+
+    if (!rows) return new ArrayValue{std::move(values), layout};
+
+    auto columns = static_cast<ArrayValue *>(values[0])->size;
+    std::vector<Value *> cells;
+    cells.reserve(values.size() * columns);
+
+    for (auto value : values) {
+        auto row = static_cast<ArrayValue *>(value);
+        row->release();
+
+        // The grid takes over the holds of a row nothing else stores
+        for (auto element : row->getArray()) {
+            cells.push_back(row->isHeld() && element != nullptr ? element->hold() : element);
+        }
     }
 
-    newValue[this->size + otherString->size] = '\0';
+    return new ArrayValue{std::move(cells), columns, layout};
+}
 
-    return new StringValue{newValue, this->size + otherString->size};
+std::span<Value *> ArrayValue::getArray()
+{
+    // The rows of a grid are its elements
+    if (columns != 0) {
+        for (long i = 0; i < size; ++i) row(i);
+    }
+
+    return {elements, static_cast<size_t>(size)};
 }
 
-ArrayValue::ArrayValue(std::vector<Value *> values)
-    :   values{std::move(values)}
-{}
+long ArrayValue::getColumns()
+{
+    return columns;
+}
 
-std::vector<Value *> ArrayValue::getArray()
+long ArrayValue::checked(long index)
 {
-    return values;
+    return checked(index, size);
 }
 
-Value *ArrayValue::index(Value *index)
+long ArrayValue::checkedColumn(long index)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    return checked(index, columns);
+}
 
-    if (indexValue >= values.size()) {
+long ArrayValue::checked(long index, long size)
+{
+    if (index < 0 || index >= size) {
         throw std::runtime_error("Index out of bounds");
     }
 
-    return values[indexValue];
+    return index;
+}
+
+long ArrayValue::checked(Value *index)
+{
+    return checked(counted_cast<Integer *>(index->getValue())->getInt(), size);
+}
+
+Value *ArrayValue::at(long index)
+{
+    return columns != 0 ? row(index) : elements[index];
+}
+
+Value **ArrayValue::slotAt(long index)
+{
+    return columns != 0 ? nullptr : &elements[index];
+}
+
+Value *ArrayValue::cellAt(long row, long column)
+{
+    return cells[row * columns + column];
+}
+
+Value *ArrayValue::row(long index)
+{
+    auto& view = values[index];
+    if (view == nullptr) view = new ArrayValue{this, index};
+    return view;
+}
+
+Value *ArrayValue::index(Value *index)
+{
+    return at(checked(index));
 }
 
 void ArrayValue::setIndex(Value *index, Value *newValue)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    auto indexValue = checked(index);
 
-    if (indexValue >= values.size()) {
-        throw std::runtime_error("Index out of bounds");
+    if (columns != 0) {
+        setRow(indexValue, newValue);
+        return;
     }
 
-    values[indexValue] = newValue->getValue();
+    elements[indexValue] = newValue->getValue();
+}
+
+void ArrayValue::setRow(long row, Value *newValue)
+{
+    // Each cell takes the new element before it lets go of the old one, which may be the same
+    auto newRow = static_cast<ArrayValue *>(newValue->getValue())->getArray();
+    auto cell = cells.begin() + row * columns;
+
+    for (long i = 0; i < columns && i < static_cast<long>(newRow.size()); ++i, ++cell) {
+        auto old = *cell;
+        *cell = newRow[i] != nullptr ? newRow[i]->hold() : nullptr;
+        if (old != nullptr) old->release();
+    }
+}
+
+Value **ArrayValue::indexSlot(Value *index)
+{
+    return slotAt(checked(index));
 }
 
 Value *ArrayValue::simpleSlice(Value *low, Value *high)
 {
     long lowValue = 0;
-    long highValue = values.size();
+    long highValue = size;
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
     if (high != nullptr) {
-        highValue = dynamic_cast<IntValue *>(high->getValue())->getInt();
+        highValue = counted_cast<Integer *>(high->getValue())->getInt();
     }
 
     std::vector<Value *> newArray;
 
-    for (int i = lowValue; i < highValue; ++i) {
-        newArray.push_back(values[i]->getValue());
+    for (long i = lowValue; i < highValue; ++i) {
+        newArray.push_back(at(i)->hold());
     }
 
-    return new SliceValue{newArray};
+    return slice(newArray);
 }
 
 Value *ArrayValue::fullSlice(Value *low, Value *high, Value *max)
@@ -493,60 +828,59 @@ Value *ArrayValue::fullSlice(Value *low, Value *high, Value *max)
     long lowValue = 0;
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
-    long highValue = dynamic_cast<IntValue *>(high->getValue())->getInt();
-    long maxValue = dynamic_cast<IntValue *>(max->getValue())->getInt();
+    long highValue = counted_cast<Integer *>(high->getValue())->getInt();
+    long maxValue = counted_cast<Integer *>(max->getValue())->getInt();
 
     std::vector<Value *> newArray;
 
-    for (int i = lowValue; i < highValue && i-lowValue < maxValue; ++i) {
-        newArray.push_back(values[i]->getValue());
+    for (long i = lowValue; i < highValue && i-lowValue < maxValue; ++i) {
+        newArray.push_back(at(i)->hold());
     }
 
-    return new SliceValue{newArray};
+    return slice(newArray);
 }
 
-Value *ArrayValue::equal(Value *other)
+Aggregate *ArrayValue::copy()
 {
-    auto otherArray = dynamic_cast<ArrayValue *>(other->getValue());
+    if (columns != 0) return new ArrayValue{held(cells), columns, layout};
 
-    if (values.size() != otherArray->values.size()) {
-        return new BoolValue{false};
-    }
+    // A copy of a row is an array of its own
+    return new ArrayValue{held({elements, static_cast<size_t>(size)}), layout};
+}
 
-    for (int i = 0; i < values.size(); i++)
-    {
-        if (!dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue()))->getBool()) {
-            return new BoolValue{false};
-        }
+Value *ArrayValue::slice(const std::vector<Value *>& elements)
+{
+    // Sized integers are packed, whatever their array held
+    if (size != 0) {
+        if (auto packed = dynamic_cast<Packed *>(this->elements[0]->getValue())) return packed->packedSlice(elements);
     }
 
-    return new BoolValue{true};
+    return new SliceValue{elements};
 }
 
-Value *ArrayValue::notEqual(Value *other)
+bool ArrayValue::equal(Value *other)
 {
-    auto otherArray = dynamic_cast<ArrayValue *>(other->getValue());
-
-    if (values.size() != otherArray->values.size()) {
-        return new BoolValue{true};
-    }
+    return layout->equal(this, other->getValue());
+}
 
-    for (int i = 0; i < values.size(); i++)
-    {
-        if (!dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue()))->getBool()) {
-            return new BoolValue{true};
-        }
-    }
+size_t ArrayValue::hash()
+{
+    return layout->hash(this);
+}
 
-    return new BoolValue{false};
+bool ArrayValue::notEqual(Value *other)
+{
+    return !layout->equal(this, other->getValue());
 }
 
 SliceValue::SliceValue(std::vector<Value *> values)
     : values{std::move(values)}
-{}
+{
+    COUNT("new SliceValue");
+}
 
 std::vector<Value *> SliceValue::getSlice()
 {
@@ -555,7 +889,7 @@ std::vector<Value *> SliceValue::getSlice()
 
 Value *SliceValue::index(Value *index)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    auto indexValue = counted_cast<Integer *>(index->getValue())->getInt();
 
     if (indexValue >= values.size()) {
         throw std::runtime_error("Index out of bounds");
@@ -566,13 +900,18 @@ Value *SliceValue::index(Value *index)
 
 void SliceValue::setIndex(Value *index, Value *newValue)
 {
-    auto indexValue = dynamic_cast<IntValue *>(index->getValue())->getInt();
+    *indexSlot(index) = newValue->getValue();
+}
+
+Value **SliceValue::indexSlot(Value *index)
+{
+    auto indexValue = counted_cast<Integer *>(index->getValue())->getInt();
 
     if (indexValue >= values.size()) {
         throw std::runtime_error("Index out of bounds");
     }
 
-    values[indexValue] = newValue;
+    return &values[indexValue];
 }
 
 Value *SliceValue::simpleSlice(Value *low, Value *high)
@@ -581,17 +920,17 @@ Value *SliceValue::simpleSlice(Value *low, Value *high)
     long highValue = values.size();
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
     if (high != nullptr) {
-        highValue = dynamic_cast<IntValue *>(high->getValue())->getInt();
+        highValue = counted_cast<Integer *>(high->getValue())->getInt();
     }
 
     std::vector<Value *> newArray;
 
     for (int i = lowValue; i < highValue; ++i) {
-        newArray.push_back(values[i]->getValue());
+        newArray.push_back(values[i]->hold());
     }
 
     return new SliceValue{newArray};
@@ -602,378 +941,206 @@ Value *SliceValue::fullSlice(Value *low, Value *high, Value *max)
     long lowValue = 0;
 
     if (low != nullptr) {
-        lowValue = dynamic_cast<IntValue *>(low->getValue())->getInt();
+        lowValue = counted_cast<Integer *>(low->getValue())->getInt();
     }
 
-    long highValue = dynamic_cast<IntValue *>(high->getValue())->getInt();
-    long maxValue = dynamic_cast<IntValue *>(max->getValue())->getInt();
+    long highValue = counted_cast<Integer *>(high->getValue())->getInt();
+    long maxValue = counted_cast<Integer *>(max->getValue())->getInt();
 
     std::vector<Value *> newArray;
 
     for (int i = lowValue; i < highValue && i-lowValue < maxValue; ++i) {
-        newArray.push_back(values[i]->getValue());
+        newArray.push_back(values[i]->hold());
     }
 
     return new SliceValue{newArray};
 }
 
-Value *SliceValue::equal(Value *other)
+bool SliceValue::equal(Value *other)
 {
-    auto otherArray = dynamic_cast<SliceValue *>(other->getValue());
+    auto otherArray = counted_cast<SliceValue *>(other->getValue());
 
     if (values.size() != otherArray->values.size()) {
-        return new BoolValue{false};
+        return false;
     }
 
     for (int i = 0; i < values.size(); i++)
     {
-        if (!dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue()))->getBool()) {
-            return new BoolValue{false};
+        if (!counted_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue())) {
+            return false;
         }
     }
 
-    return new BoolValue{true};
+    return true;
 }
 
-Value *SliceValue::notEqual(Value *other)
+bool SliceValue::notEqual(Value *other)
 {
-    auto otherArray = dynamic_cast<SliceValue *>(other->getValue());
+    auto otherArray = counted_cast<SliceValue *>(other->getValue());
 
     if (values.size() != otherArray->values.size()) {
-        return new BoolValue{true};
+        return true;
     }
 
     for (int i = 0; i < values.size(); i++)
     {
-        if (!dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue()))->getBool()) {
-            return new BoolValue{true};
-        }
-    }
-
-    return new BoolValue{false};
-}
-
-StructValue::StructValue(std::map<std::string, Value *> fields)
-    : fields{fields}
-{}
-
-Value *StructValue::select(std::string id)
-{
-    return fields[id];
-}
-
-void StructValue::setSelect(std::string id, Value *newValue)
-{
-    fields[id] = newValue->getValue();
-}
-
-Value *StructValue::equal(Value *other)
-{
-    auto otherStruct = dynamic_cast<StructValue *>(other->getValue());
-
-    std::vector<std::string> thisKeys{};
-    std::vector<std::string> otherKeys{};
-
-    std::vector<Value *> thisValues{};
-    std::vector<Value *> otherValues{};
-
-    for (const auto thisPair : fields) {
-        thisKeys.push_back(thisPair.first);
-        thisValues.push_back(thisPair.second);
-    }
-
-    for (const auto otherPair : otherStruct->fields) {
-        thisKeys.push_back(otherPair.first);
-        thisValues.push_back(otherPair.second);
-    }
-
-    return new BoolValue{std::equal(thisKeys.begin(), thisKeys.end(), otherKeys.begin()) && std::equal(thisValues.begin(), thisValues.end(), otherValues.begin(), [](Value *first, Value *second) {
-        return dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(first->getValue())->equal(second->getValue()))->getBool();
-    })};
-}
-
-Value *StructValue::notEqual(Value *other)
-{
-    auto otherStruct = dynamic_cast<StructValue *>(other->getValue());
-
-    std::vector<std::string> thisKeys{};
-    std::vector<std::string> otherKeys{};
-
-    std::vector<Value *> thisValues{};
-    std::vector<Value *> otherValues{};
-
-    for (const auto thisPair : fields) {
-        thisKeys.push_back(thisPair.first);
-        thisValues.push_back(thisPair.second);
-    }
-
-    for (const auto otherPair : otherStruct->fields) {
-        thisKeys.push_back(otherPair.first);
-        thisValues.push_back(otherPair.second);
-    }
-
-    return new BoolValue{!std::equal(thisKeys.begin(), thisKeys.end(), otherKeys.begin()) && std::equal(thisValues.begin(), thisValues.end(), otherValues.begin(), [](Value *first, Value *second) {
-        return dynamic_cast<BoolValue *>(dynamic_cast<Equal *>(first->getValue())->equal(second->getValue()))->getBool();
-    })};
-}
-
-FunctionValue::FunctionValue(const std::map<std::string, Value *>& closure, const std::function<Value *(std::map<std::string, Value *> closure, std::vector<Value *> arguments)>& call)
-    : _closure{std::move(closure)}, _call{std::move(call)}
-{}
-
-Value *FunctionValue::call(std::vector<Value *> arguments) 
-{
-    return _call(_closure, arguments);
-}
-
-MapValue::MapValue(std::vector<std::pair<Value *, Value *>> fields)
-    : fields{std::move(fields)}
-{}
-
-Value *MapValue::index(Value *index) 
-{
-    for (const auto& field : fields) {
-        auto fieldIndex = dynamic_cast<Equal *>(field.first);
-
-        if (dynamic_cast<BoolValue *>(fieldIndex->equal(index->getValue()))->getBool()) {
-            return field.second;
-        }
-    }
-    
-    throw std::runtime_error("Index out of bounds");
-}
-
-void MapValue::setIndex(Value *index, Value *newValue)
-{
-    for (int i = 0; i < fields.size(); ++i) {
-        auto fieldIndex = dynamic_cast<Equal *>(fields[i].first);
-
-        if (dynamic_cast<BoolValue *>(fieldIndex->equal(index->getValue()))->getBool()) {
-            fields[i] = std::make_pair(fields[i].first, newValue->getValue());
+        if (!counted_cast<Equal *>(values[i]->getValue())->equal(otherArray->values[i]->getValue())) {
+            return true;
         }
     }
 
-    throw std::runtime_error("Index out of bounds");
+    return false;
 }
 
-ReferenceValue::ReferenceValue(const std::function<Value* ()> getter, const std::function<void (Value *)> setter)
-    : getter{getter}, setter{setter}
-{}
-
-Value *ReferenceValue::getValue()
+StructValue::StructValue(std::vector<Value *> fields, const Layout *layout)
+    : fields{std::move(fields)}, layout{layout}
 {
-    return getter();
+    COUNT("new StructValue");
 }
 
-void ReferenceValue::setValue(Value *value)
+const std::vector<Value *>& StructValue::getFields()
 {
-    setter(value);
+    return fields;
 }
 
-Value *ReferenceValue::index(Value *index)
+Value *StructValue::select(long index)
 {
-    return new ReferenceValue{
-        [this, index]() {
-            auto value = dynamic_cast<Index *>(this->getValue());
-            return value->index(index->getValue());
-        },
-        [this, index](Value *newValue) {
-            auto value = dynamic_cast<Index *>(this->getValue());
-
-            value->setIndex(index->getValue(), newValue->getValue());
-
-            setValue(dynamic_cast<Value *>(value));
-        }
-    };
+    return fields[index];
 }
 
-void ReferenceValue::setIndex(Value *index, Value *newValue)
+Value **StructValue::selectSlot(long index)
 {
-    // TODO:
-    throw std::exception{};
+    return &fields[index];
 }
 
-Value *ReferenceValue::select(std::string id)
+bool StructValue::equal(Value *other)
 {
-    return new ReferenceValue{
-        [this, id]() {
-            auto value = dynamic_cast<Select *>(this->getValue());
-            return value->select(id);
-        },
-        [this, id](Value * newValue) {
-            auto value = dynamic_cast<Select *>(this->getValue());
-
-            value->setSelect(id, newValue->getValue());
-
-            setValue(dynamic_cast<Value *>(value));
-        }
-    };
+    return layout->equal(this, other->getValue());
 }
 
-void ReferenceValue::setSelect(std::string id, Value *newValue)
+size_t StructValue::hash()
 {
-    // TODO:
-    throw std::exception{};
+    return layout->hash(this);
 }
 
-Value *ReferenceValue::simpleSlice(Value *low, Value *high)
+bool StructValue::notEqual(Value *other)
 {
-    auto value = dynamic_cast<SimpleSlice *>(this->getValue());
-    return value->simpleSlice(low->getValue(), high->getValue());
+    return !layout->equal(this, other->getValue());
 }
 
-Value *ReferenceValue::fullSlice(Value *low, Value *high, Value *max)
+Aggregate *StructValue::copy()
 {
-    auto value = dynamic_cast<FullSlice *>(this->getValue());
-    return value->fullSlice(low->getValue(), high->getValue(), max->getValue());
+    return new StructValue{held(fields), layout};
 }
 
-Value *ReferenceValue::call(std::vector<Value *> parameters)
+PointerValue::PointerValue(Value **cell)
+    : cell{cell}
 {
-    auto value = dynamic_cast<Call *>(this->getValue());
-    return value->call(parameters);
+    COUNT("new PointerValue");
 }
 
-Value *ReferenceValue::unaryPlus()
+Value **PointerValue::getCell()
 {
-    auto value = dynamic_cast<UnaryPlus *>(this->getValue());
-    return value->unaryPlus();
+    return cell;
 }
 
-Value *ReferenceValue::negate()
+PointerValue *PointerValue::nil()
 {
-    auto value = dynamic_cast<Negate *>(this->getValue());
-    return value->negate();
+    static auto nil = new PointerValue{nullptr};
+    return nil;
 }
 
-Value *ReferenceValue::logicalNot()
+Value *PointerValue::dereference()
 {
-    auto value = dynamic_cast<LogicalNot *>(this->getValue());
-    return value->logicalNot();
-}
-
-Value *ReferenceValue::bitwiseNot()
-{
-    auto value = dynamic_cast<BitwiseNot *>(this->getValue());
-    return value->bitwiseNot();
-}
-
-Value *ReferenceValue::dereference()
-{
-    auto value = dynamic_cast<Dereference *>(this->getValue());
-    return value->dereference();
-}
+    if (cell == nullptr) {
+        throw std::runtime_error("Nil pointer dereference");
+    }
 
-Value *ReferenceValue::reference()
-{
-    auto value = dynamic_cast<Reference *>(this->getValue());
-    return value->reference();
+    return *cell;
 }
 
-Value *ReferenceValue::logicalOr(Value *other)
+Value *PointerValue::select(long index)
 {
-    auto value = dynamic_cast<LogicalOr *>(this->getValue());
-    return value->logicalOr(other->getValue());
+    return counted_cast<Select *>(dereference())->select(index);
 }
 
-Value *ReferenceValue::logicalAnd(Value *other)
+Value **PointerValue::selectSlot(long index)
 {
-    auto value = dynamic_cast<LogicalAnd *>(this->getValue());
-    return value->logicalAnd(other->getValue());
+    return counted_cast<Select *>(dereference())->selectSlot(index);
 }
 
-Value *ReferenceValue::equal(Value *other)
+bool PointerValue::equal(Value *other)
 {
-    auto value = dynamic_cast<Equal *>(this->getValue());
-    return value->equal(other->getValue());
+    return cell == counted_cast<PointerValue *>(other->getValue())->cell;
 }
 
-Value *ReferenceValue::notEqual(Value *other)
+size_t PointerValue::hash()
 {
-    auto value = dynamic_cast<NotEqual *>(this->getValue());
-    return value->notEqual(other->getValue());
+    return std::hash<Value **>{}(cell);
 }
 
-Value *ReferenceValue::lessThan(Value *other)
+bool PointerValue::notEqual(Value *other)
 {
-    auto value = dynamic_cast<LessThan *>(this->getValue());
-    return value->lessThan(other->getValue());
+    return !equal(other);
 }
 
-Value *ReferenceValue::greaterThan(Value *other)
+FunctionValue::FunctionValue(const std::map<Atom, Value *>& closure, const std::function<Value *(const std::map<Atom, Value *>& closure, Arguments arguments)>& call)
+    : _closure{std::move(closure)}, _call{std::move(call)}
 {
-    auto value = dynamic_cast<GreaterThan *>(this->getValue());
-    return value->greaterThan(other->getValue());
+    COUNT("new FunctionValue");
 }
 
-Value *ReferenceValue::lessThanEqual(Value *other)
+Value *FunctionValue::call(Arguments arguments) 
 {
-    auto value = dynamic_cast<LessThanEqual *>(this->getValue());
-    return value->lessThanEqual(other->getValue());
+    return _call(_closure, arguments);
 }
 
-Value *ReferenceValue::greaterThanEqual(Value *other)
+MapValue::MapValue(Value *zero)
+    : zero{zero}, entries{}
 {
-    auto value = dynamic_cast<GreaterThanEqual *>(this->getValue());
-    return value->greaterThanEqual(other->getValue());
+    COUNT("new MapValue");
 }
 
-Value *ReferenceValue::shiftLeft(Value *other)
+size_t MapValue::KeyHash::operator()(Value *key) const
 {
-    auto value = dynamic_cast<ShiftLeft *>(this->getValue());
-    return value->shiftLeft(other->getValue());
+    return counted_cast<Hash *>(key)->hash();
 }
 
-Value *ReferenceValue::shiftRight(Value *other)
+bool MapValue::KeyEqual::operator()(Value *lhs, Value *rhs) const
 {
-    auto value = dynamic_cast<ShiftRight *>(this->getValue());
-    return value->shiftRight(other->getValue());
+    return counted_cast<Equal *>(lhs)->equal(rhs);
 }
 
-Value *ReferenceValue::add(Value *other)
+Value *MapValue::index(Value *index) 
 {
-    auto value = dynamic_cast<Add *>(this->getValue());
-    return value->add(other->getValue());
-}
+    auto entry = entries.find(index->getValue());
 
-Value *ReferenceValue::subtract(Value *other)
-{
-    auto value = dynamic_cast<Subtract *>(this->getValue());
-    return value->subtract(other->getValue());
-}
+    if (entry != entries.end()) {
+        return entry->second;
+    }
 
-Value *ReferenceValue::bitwiseOr(Value *other)
-{
-    auto value = dynamic_cast<BitwiseOr *>(this->getValue());
-    return value->bitwiseOr(other->getValue());
-}
+    if (zero == nullptr) {
+        throw std::runtime_error("Index out of bounds");
+    }
 
-Value *ReferenceValue::bitwiseXOr(Value *other)
-{
-    auto value = dynamic_cast<BitwiseXOr *>(this->getValue());
-    return value->bitwiseXOr(other->getValue());
+    return zero;
 }
 
-Value *ReferenceValue::bitwiseAnd(Value *other)
+void MapValue::setIndex(Value *index, Value *newValue)
 {
-    auto value = dynamic_cast<BitwiseAnd *>(this->getValue());
-    return value->bitwiseAnd(other->getValue());
+    *indexSlot(index) = newValue->getValue();
 }
 
-Value *ReferenceValue::multiply(Value *other)
+Value **MapValue::indexSlot(Value *index)
 {
-    auto value = dynamic_cast<Multiply *>(this->getValue());
-    return value->multiply(other->getValue());
-}
+    auto key = index->getValue();
+    auto entry = entries.find(key);
 
-Value *ReferenceValue::divide(Value *other)
-{
-    auto value = dynamic_cast<Divide *>(this->getValue());
-    return value->divide(other->getValue());
-}
+    // The map holds its keys, an array or struct key is not written through another holder,
+    // and the entry holds its zero value, which the store that follows releases
+    if (entry == entries.end()) {
+        entry = entries.emplace(key->hold(), zero != nullptr ? zero->hold() : nullptr).first;
+    }
 
-Value *ReferenceValue::modulo(Value *other)
-{
-    auto value = dynamic_cast<Modulo *>(this->getValue());
-    return value->modulo(other->getValue());
+    return &entry->second;
 }
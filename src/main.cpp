@@ -1,17 +1,58 @@
 #include <iostream>
 #include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
 
 #include "main.hpp"
 
 int main(int argc, char *argv[]) {
-    if (argc != 2) {
-        std::cout << "Usage: GoInterpreter <file>" << std::endl;
+    bool dumpOptimized = false;
+    bool opcodeHistogram = false;
+    long maxStack = 512; // MiB
+    bool lazyValidation = false;
+    bool counters = false;
+    std::string trace{};
+    char *file = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--dump-optimized") {
+            dumpOptimized = true;
+        } else if (std::string(argv[i]) == "--opcode-histogram") {
+            opcodeHistogram = true;
+        } else if (std::string(argv[i]) == "--lazy-validation") {
+            lazyValidation = true;
+        } else if (std::string(argv[i]) == "--counters") {
+            counters = true;
+        } else if (std::string(argv[i]).starts_with("--trace=")) {
+            trace = argv[i] + std::string("--trace=").size();
+        } else if (std::string(argv[i]).starts_with("--max-stack=")) {
+            maxStack = std::atol(argv[i] + std::string("--max-stack=").size());
+            if (maxStack <= 0) {
+                file = nullptr;
+                break;
+            }
+        } else if (file == nullptr) {
+            file = argv[i];
+        } else {
+            file = nullptr;
+            break;
+        }
+    }
+
+    if ((counters || !trace.empty()) && !Counters::enabled) {
+        std::cerr << "Counters are not compiled in, configure with -DGOINTERPRETER_COUNTERS=ON" << std::endl;
         return EXIT_FAILURE;
     }
 
-    yyin = fopen(argv[1], "r");
+    if (file == nullptr) {
+        std::cout << "Usage: GoInterpreter [--dump-optimized] [--opcode-histogram] [--lazy-validation] [--max-stack=<MiB>] [--counters] [--trace=<json>] <file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    yyin = fopen(file, "r");
     if (yyin == NULL) {
-        std::cerr << "Cant open file: " << argv[1] << std::endl;   
+        std::cerr << "Cant open file: " << file << std::endl;   
         return EXIT_FAILURE;
     }
 
@@ -22,8 +63,9 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
-    // Validate program
-    Validator validator{};
+    // Validate program, lazily only the signatures and global declarations
+    lazyValidation = lazyValidation && !dumpOptimized;
+    Validator validator{lazyValidation};
     tree->accept(&validator);
 
     for (auto error : validator.getErrors())
@@ -31,14 +73,85 @@ int main(int argc, char *argv[]) {
         std::cerr << error << std::endl;
     }
 
-    // Run if no errors
-    if (validator.getErrors().empty()) {
-        Interpreter interpreter{};
-        tree->accept(&interpreter);
+    if (!validator.getErrors().empty()) {
+        return EXIT_FAILURE;
+    }
+
+    // Keep the variables whose address does not outlive their frame in it
+    EscapeAnalysis escapeAnalysis{};
+    tree->accept(&escapeAnalysis);
+
+    // Optimize program, the original tree is no longer needed afterwards.
+    // The optimizer needs bodies validated, lazy runs optimize each one on
+    // its first call and keep the tree until then.
+    Optimizer optimizer{lazyValidation};
+    tree->accept(&optimizer);
+    AST::Node *program = optimizer.getProgram();
+
+    if (!lazyValidation) {
+        delete tree;
+    }
+
+    if (dumpOptimized) {
+        AST::Printer printer{};
+        program->accept(&printer);
+
+        std::cout << "// " << optimizer.getConstantCount() << " pooled constants" << std::endl;
+        std::cout << "// " << optimizer.getRemovedBoundsChecks() << " bounds checks removed" << std::endl;
+        std::cout << printer.getOutput() << std::endl;
 
+        delete program;
         return EXIT_SUCCESS;
-    } else {
-        return EXIT_FAILURE;
     }
 
+    // Run program, recursion depth is bounded by the stack it gets
+    long stackSize = maxStack * 1024 * 1024;
+    Interpreter interpreter{file, stackSize};
+
+    if (lazyValidation) {
+        interpreter.setFirstCallHook([&validator, &optimizer](Atom id) {
+            auto checked = validator.getErrors().size();
+            validator.validateFunction(id);
+
+            // A valid body runs optimized, like in eager runs
+            auto errors = validator.getErrors();
+            if (errors.size() == checked) return optimizer.optimizeFunction(id);
+
+            std::string message = "In function " + id + ":";
+            for (auto error = errors.begin() + checked; error != errors.end(); ++error) {
+                message += "\n" + *error;
+            }
+
+            throw std::runtime_error{message};
+        });
+    }
+
+    // Counters and the trace are reported for programs stopped by an error too
+    auto status = EXIT_SUCCESS;
+
+    try {
+        runWithStack(stackSize, [&]() {
+            if (opcodeHistogram) {
+                OpcodeHistogram histogram{&interpreter};
+                program->accept(&histogram);
+                histogram.print(std::cerr);
+            } else {
+                program->accept(&interpreter);
+            }
+        });
+    } catch (const std::runtime_error& error) {
+        std::cerr << error.what() << std::endl;
+        status = EXIT_FAILURE;
+    }
+
+    if (counters) {
+        Counters::printSummary(std::cerr);
+    }
+
+    if (!trace.empty()) {
+        std::ofstream out{trace};
+        Counters::writeTrace(out);
+    }
+
+    return status;
 }
@@ -0,0 +1,57 @@
+#include <iostream>
+
+#include "natives/natives.hpp"
+#include "interpreter/string_kernels.hpp"
+
+NativeFunctionValue::NativeFunctionValue(Thunk thunk, void (*function)())
+    : thunk{thunk}, function{function}
+{}
+
+Value *NativeFunctionValue::call(Arguments arguments)
+{
+    return thunk(function, arguments);
+}
+
+std::vector<Natives::Native>& Natives::registry()
+{
+    static std::vector<Native> natives;
+    return natives;
+}
+
+const std::vector<Natives::Native>& Natives::all()
+{
+    static bool builtinsRegistered = false;
+
+    if (!builtinsRegistered) {
+        builtinsRegistered = true;
+        registerBuiltins();
+    }
+
+    return registry();
+}
+
+void Natives::registerBuiltins()
+{
+    registerNative<void(long)>("printInt", [](long value) {
+        std::cout << value;
+    });
+
+    registerNative<void(char)>("printRune", [](char value) {
+        std::cout << value;
+    });
+
+    registerNative<void(float)>("printFloat32", [](float value) {
+        std::cout << value;
+    });
+
+    registerNative<void(StringValue::String)>("printString", [](StringValue::String value) {
+        auto converted = std::string(value.size, '\0');
+        converted.resize(StringKernels::stripNul(value.value, value.size, converted.data()));
+        std::cout << converted;
+    });
+
+    // strings.Index
+    registerNative<long(StringValue::String, StringValue::String)>("indexString", [](StringValue::String string, StringValue::String substring) {
+        return StringKernels::find(string.value, string.size, substring.value, substring.size);
+    });
+}
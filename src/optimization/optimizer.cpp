@@ -0,0 +1,1351 @@
+#include <climits>
+#include <cstring>
+
+#include "optimization/optimizer.hpp"
+#include "ast/literals.hpp"
+
+namespace {
+
+    typedef Optimizer::Constant Constant;
+    typedef Optimizer::Constant::Kind Kind;
+
+    Constant makeBool(bool value)
+    {
+        auto constant = Constant::none();
+        constant.kind = Kind::Bool;
+        constant.boolean = value;
+        return constant;
+    }
+
+    // Ints wrap at 64 bits, folded the way the runtime computes them
+    long wrapping(unsigned long value)
+    {
+        return static_cast<long>(value);
+    }
+
+    Constant makeInt(long value)
+    {
+        auto constant = Constant::none();
+        constant.kind = Kind::Int;
+        constant.integer = value;
+        return constant;
+    }
+
+    Constant makeFloat32(float value)
+    {
+        auto constant = Constant::none();
+        constant.kind = Kind::Float32;
+        constant.floating = value;
+        return constant;
+    }
+
+    Constant makeRune(char value)
+    {
+        auto constant = Constant::none();
+        constant.kind = Kind::Rune;
+        constant.rune = value;
+        return constant;
+    }
+
+    Constant makeString(std::string value)
+    {
+        auto constant = Constant::none();
+        constant.kind = Kind::String;
+        constant.string = value;
+        return constant;
+    }
+
+    // Same ordering as StringValue::compare
+    long compareStrings(const std::string& lhs, const std::string& rhs)
+    {
+        return lhs.compare(rhs);
+    }
+
+    Constant fold(AST::UnaryExpression::Operation operation, const Constant& operand)
+    {
+        typedef AST::UnaryExpression::Operation Operation;
+
+        switch (operation) {
+        case Operation::PLUS:
+            if (operand.kind == Kind::Int || operand.kind == Kind::Float32) return operand;
+            break;
+        case Operation::NEGATE:
+            if (operand.kind == Kind::Int) return makeInt(wrapping(0ul - operand.integer));
+            if (operand.kind == Kind::Float32) return makeFloat32(-operand.floating);
+            break;
+        case Operation::L_NOT:
+            if (operand.kind == Kind::Bool) return makeBool(!operand.boolean);
+            break;
+        case Operation::BW_NOT:
+            if (operand.kind == Kind::Int) return makeInt(~operand.integer);
+            break;
+        default:
+            break;
+        }
+
+        return Constant::none();
+    }
+
+    // Mirrors the runtime semantics of the values in interpreter/values.cpp,
+    // anything that would fail or overflow at runtime is not folded
+    Constant fold(AST::BinaryExpression::Operation operation, const Constant& lhs, const Constant& rhs)
+    {
+        typedef AST::BinaryExpression::Operation Operation;
+
+        if (lhs.kind == Kind::None || lhs.kind != rhs.kind) {
+            return Constant::none();
+        }
+
+        switch (operation) {
+        case Operation::EQ:
+            return makeBool(lhs.equals(rhs));
+        case Operation::NEQ:
+            return makeBool(!lhs.equals(rhs));
+        default:
+            break;
+        }
+
+        switch (lhs.kind) {
+        case Kind::Bool:
+            switch (operation) {
+            case Operation::L_OR: return makeBool(lhs.boolean || rhs.boolean);
+            case Operation::L_AND: return makeBool(lhs.boolean && rhs.boolean);
+            default: break;
+            }
+            break;
+        case Kind::Int:
+            switch (operation) {
+            case Operation::LT: return makeBool(lhs.integer < rhs.integer);
+            case Operation::LTE: return makeBool(lhs.integer <= rhs.integer);
+            case Operation::GT: return makeBool(lhs.integer > rhs.integer);
+            case Operation::GTE: return makeBool(lhs.integer >= rhs.integer);
+            case Operation::ADD: return makeInt(wrapping(static_cast<unsigned long>(lhs.integer) + rhs.integer));
+            case Operation::SUB: return makeInt(wrapping(static_cast<unsigned long>(lhs.integer) - rhs.integer));
+            case Operation::MULT: return makeInt(wrapping(static_cast<unsigned long>(lhs.integer) * rhs.integer));
+            case Operation::BW_OR: return makeInt(lhs.integer | rhs.integer);
+            case Operation::BW_XOR: return makeInt(lhs.integer ^ rhs.integer);
+            case Operation::BW_AND: return makeInt(lhs.integer & rhs.integer);
+            case Operation::DIV:
+                if (rhs.integer != 0 && !(lhs.integer == LONG_MIN && rhs.integer == -1)) return makeInt(lhs.integer / rhs.integer);
+                break;
+            case Operation::MOD:
+                if (rhs.integer != 0 && !(lhs.integer == LONG_MIN && rhs.integer == -1)) return makeInt(lhs.integer % rhs.integer);
+                break;
+            case Operation::SHIFT_LEFT:
+                if (rhs.integer >= 0 && rhs.integer < 64) return makeInt(wrapping(static_cast<unsigned long>(lhs.integer) << rhs.integer));
+                break;
+            case Operation::SHIFT_RIGHT:
+                if (rhs.integer >= 0 && rhs.integer < 64) return makeInt(lhs.integer >> rhs.integer);
+                break;
+            default: break;
+            }
+            break;
+        case Kind::Float32:
+            switch (operation) {
+            case Operation::LT: return makeBool(lhs.floating < rhs.floating);
+            case Operation::LTE: return makeBool(lhs.floating <= rhs.floating);
+            case Operation::GT: return makeBool(lhs.floating > rhs.floating);
+            case Operation::GTE: return makeBool(lhs.floating >= rhs.floating);
+            case Operation::ADD: return makeFloat32(lhs.floating + rhs.floating);
+            case Operation::SUB: return makeFloat32(lhs.floating - rhs.floating);
+            case Operation::MULT: return makeFloat32(lhs.floating * rhs.floating);
+            case Operation::DIV:
+                if (rhs.floating != 0) return makeFloat32(lhs.floating / rhs.floating);
+                break;
+            default: break;
+            }
+            break;
+        case Kind::Rune:
+            switch (operation) {
+            case Operation::LT: return makeBool(lhs.rune < rhs.rune);
+            case Operation::LTE: return makeBool(lhs.rune <= rhs.rune);
+            case Operation::GT: return makeBool(lhs.rune > rhs.rune);
+            case Operation::GTE: return makeBool(lhs.rune >= rhs.rune);
+            case Operation::ADD: return makeRune(static_cast<char>(lhs.rune + rhs.rune));
+            case Operation::SUB: return makeRune(static_cast<char>(lhs.rune - rhs.rune));
+            case Operation::MULT: return makeRune(static_cast<char>(lhs.rune * rhs.rune));
+            case Operation::DIV:
+                if (rhs.rune != 0) return makeRune(static_cast<char>(lhs.rune / rhs.rune));
+                break;
+            default: break;
+            }
+            break;
+        case Kind::String:
+            switch (operation) {
+            case Operation::LT: return makeBool(compareStrings(lhs.string, rhs.string) < 0);
+            case Operation::LTE: return makeBool(compareStrings(lhs.string, rhs.string) <= 0);
+            case Operation::GT: return makeBool(compareStrings(lhs.string, rhs.string) > 0);
+            case Operation::GTE: return makeBool(compareStrings(lhs.string, rhs.string) >= 0);
+            case Operation::ADD: return makeString(lhs.string + rhs.string);
+            default: break;
+            }
+            break;
+        default:
+            break;
+        }
+
+        return Constant::none();
+    }
+
+    AST::Expression *makeLiteral(const Constant& constant)
+    {
+        switch (constant.kind) {
+        case Kind::Bool:
+            return new AST::BoolExpression{constant.boolean};
+        case Kind::Int:
+            return new AST::IntExpression{constant.integer};
+        case Kind::Float32:
+            return new AST::Float32Expression{constant.floating};
+        case Kind::Rune:
+            return new AST::RuneExpression{constant.rune};
+        case Kind::String: {
+            auto value = new char[constant.string.size() + 1];
+            std::memcpy(value, constant.string.data(), constant.string.size());
+            value[constant.string.size()] = '\0';
+            return new AST::StringExpression{value, static_cast<long>(constant.string.size())};
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+    // Key used to deduplicate the constant pool
+    std::string poolKey(const Constant& constant)
+    {
+        switch (constant.kind) {
+        case Kind::Bool:
+            return constant.boolean ? "b1" : "b0";
+        case Kind::Int:
+            return "i" + std::to_string(constant.integer);
+        case Kind::Float32:
+            return "f" + std::string(reinterpret_cast<const char *>(&constant.floating), sizeof(float));
+        case Kind::Rune:
+            return "r" + std::string(1, constant.rune);
+        case Kind::String:
+            return "s" + constant.string;
+        default:
+            return "";
+        }
+    }
+
+    bool lessThan(long lhs, long rhs) { return lhs < rhs; }
+    bool lessThanEqual(long lhs, long rhs) { return lhs <= rhs; }
+    bool greaterThan(long lhs, long rhs) { return lhs > rhs; }
+    bool greaterThanEqual(long lhs, long rhs) { return lhs >= rhs; }
+    bool equal(long lhs, long rhs) { return lhs == rhs; }
+    bool notEqual(long lhs, long rhs) { return lhs != rhs; }
+
+    bool (*comparator(AST::BinaryExpression::Operation operation))(long, long)
+    {
+        typedef AST::BinaryExpression::Operation Operation;
+
+        switch (operation) {
+        case Operation::LT: return lessThan;
+        case Operation::LTE: return lessThanEqual;
+        case Operation::GT: return greaterThan;
+        case Operation::GTE: return greaterThanEqual;
+        case Operation::EQ: return equal;
+        case Operation::NEQ: return notEqual;
+        default: return nullptr;
+        }
+    }
+
+} // namespace
+
+Optimizer::Constant Optimizer::Constant::none()
+{
+    return Constant{Kind::None, false, 0, 0, '\0', ""};
+}
+
+bool Optimizer::Constant::equals(const Constant& other) const
+{
+    if (kind != other.kind) return false;
+
+    switch (kind) {
+    case Kind::Bool: return boolean == other.boolean;
+    case Kind::Int: return integer == other.integer;
+    case Kind::Float32: return floating == other.floating;
+    case Kind::Rune: return rune == other.rune;
+    case Kind::String: return string == other.string;
+    default: return false;
+    }
+}
+
+Optimizer::Optimizer(bool lazy)
+    :
+    lazy{lazy},
+    functionDeclarationOptimizers{},
+    program{nullptr},
+    pool{},
+    types{},
+    expressions{},
+    constants{},
+    shapes{},
+    statements{},
+    declarations{},
+    blocks{},
+    blockSizes{},
+    clauses{},
+    frames{},
+    signatureLocals{},
+    entry{},
+    effect{},
+    removedBoundsChecks{0}
+{}
+
+Optimizer::~Optimizer()
+{}
+
+AST::Program *Optimizer::getProgram() const
+{
+    return program;
+}
+
+AST::FunctionDeclaration *Optimizer::optimizeFunction(Atom id)
+{
+    auto functionOptimizer = functionDeclarationOptimizers.find(id);
+    if (functionOptimizer == functionDeclarationOptimizers.end()) return nullptr;
+
+    auto optimize = functionOptimizer->second;
+    functionDeclarationOptimizers.erase(functionOptimizer);
+    optimize();
+
+    return static_cast<AST::FunctionDeclaration *>(declarations.pop());
+}
+
+long Optimizer::getConstantCount() const
+{
+    return pool.size();
+}
+
+long Optimizer::getRemovedBoundsChecks() const
+{
+    return removedBoundsChecks;
+}
+
+void Optimizer::pushExpression(AST::Expression *expression, const Shape& shape)
+{
+    expressions.push(expression);
+    constants.push(Constant::none());
+    shapes.push(shape);
+}
+
+void Optimizer::pushConstant(const Constant& constant)
+{
+    // Constants stay off the tree until a consumer can't fold them any further
+    expressions.push(nullptr);
+    constants.push(constant);
+    shapes.push(Shape{"", "", 0});
+}
+
+AST::Expression *Optimizer::materialise(AST::Expression *expression, const Constant& constant)
+{
+    if (expression != nullptr) {
+        return expression;
+    }
+
+    auto key = poolKey(constant);
+    auto entry = pool.find(key);
+    long index;
+
+    if (entry == pool.end()) {
+        index = pool.size();
+        pool[key] = index;
+    } else {
+        index = entry->second;
+    }
+
+    return new AST::ConstantExpression{index, makeLiteral(constant)};
+}
+
+AST::Expression *Optimizer::popExpression()
+{
+    auto expression = expressions.pop();
+    shapes.pop();
+    return materialise(expression, constants.pop());
+}
+
+std::vector<AST::Expression *> Optimizer::popExpressions(long size)
+{
+    std::vector<AST::Expression *> result;
+    for (long i = 0; i < size; ++i) {
+        result.push_back(popExpression());
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+AST::SimpleStatement *Optimizer::popSimpleStatement()
+{
+    auto statement = dynamic_cast<AST::SimpleStatement *>(statements.pop());
+
+    if (statement == nullptr) {
+        return new AST::EmptyStatement{};
+    }
+
+    return statement;
+}
+
+std::vector<AST::Statement *> Optimizer::collectStatements(AST::Visits visitStatements)
+{
+    std::vector<AST::Statement *> result;
+    Effect previous{};
+
+    for (const auto& visitStatement : visitStatements) {
+        auto statementCount = statements.size();
+        auto declarationCount = declarations.size();
+
+        entry = previous;
+        effect = Effect{};
+        visitStatement();
+        previous = effect;
+
+        if (statements.size() > statementCount) {
+            auto statement = statements.pop();
+            if (statement != nullptr) {
+                result.push_back(statement);
+            }
+        } else if (declarations.size() > declarationCount) {
+            result.push_back(new AST::DeclarationStatement{dynamic_cast<AST::Declaration *>(declarations.pop())});
+        }
+    }
+
+    // Whatever the last statement did is no effect of the statement holding the block
+    effect = Effect{};
+
+    return result;
+}
+
+void Optimizer::beginFrame()
+{
+    frames.push_back(Frame{});
+    frames.back().locals.insert(signatureLocals.begin(), signatureLocals.end());
+}
+
+void Optimizer::endFrame()
+{
+    // A store through a pointer can move any index whose address is taken
+    for (const auto& access : frames.back().accesses) {
+        if (frames.back().addressed.contains(access.index)) {
+            access.check();
+        } else {
+            ++removedBoundsChecks;
+        }
+    }
+
+    frames.pop_back();
+}
+
+bool Optimizer::beginRange(const Effect& start, const Shape& condition, const Effect& step)
+{
+    auto local = condition.bounded;
+
+    if (frames.empty() || local.empty() || !frames.back().locals.contains(local)) return false;
+    if (start.local != local || !start.assigned) return false;
+    if (step.local != local || step.assigned || step.value == 0) return false;
+
+    // Counting up from the start until the condition fails, or down
+    auto low = step.value > 0 ? start.value : condition.low;
+    auto high = step.value > 0 ? condition.high : start.value + 1;
+
+    if (low == LONG_MIN || high == LONG_MAX) return false;
+
+    frames.back().ranges.push_back(Range{local, low, high, false, {}});
+    return true;
+}
+
+void Optimizer::endRange()
+{
+    auto& frame = frames.back();
+    auto range = frame.ranges.back();
+    frame.ranges.pop_back();
+
+    for (const auto& access : range.accesses) {
+        if (range.stored) {
+            access.check();
+        } else {
+            frame.accesses.push_back(access);
+        }
+    }
+}
+
+void Optimizer::store(Atom local)
+{
+    if (frames.empty()) return;
+
+    for (auto& range : frames.back().ranges) {
+        if (range.local == local) range.stored = true;
+    }
+}
+
+bool Optimizer::inBounds(long length, Range *&range)
+{
+    range = nullptr;
+
+    if (length < 0) return false;
+
+    auto constant = constants.top();
+    if (constant.kind == Kind::Int) {
+        return constant.integer >= 0 && constant.integer < length;
+    }
+
+    auto local = shapes.top().local;
+    if (local.empty() || frames.empty()) return false;
+
+    auto& ranges = frames.back().ranges;
+    for (auto loop = ranges.rbegin(); loop != ranges.rend(); ++loop) {
+        if (loop->local != local) continue;
+        if (loop->stored || loop->low < 0 || loop->high > length) return false;
+
+        range = &*loop;
+        return true;
+    }
+
+    return false;
+}
+
+void Optimizer::removeBoundsCheck(Range *range, std::function<void()> check)
+{
+    // Constant indices need no loop to hold
+    if (range == nullptr) {
+        ++removedBoundsChecks;
+        return;
+    }
+
+    range->accesses.push_back(Access{range->local, check});
+}
+
+void Optimizer::foldUnary(AST::UnaryExpression::Operation operation)
+{
+    auto expression = expressions.pop();
+    auto constant = constants.pop();
+    shapes.pop();
+    auto result = fold(operation, constant);
+
+    if (result.kind != Kind::None) {
+        pushConstant(result);
+    } else {
+        pushExpression(new AST::UnaryExpression{operation, materialise(expression, constant)});
+    }
+}
+
+void Optimizer::foldBinary(AST::BinaryExpression::Operation operation)
+{
+    auto rhs = expressions.pop();
+    auto rhsConstant = constants.pop();
+    shapes.pop();
+    auto lhs = expressions.pop();
+    auto lhsConstant = constants.pop();
+    auto local = shapes.pop().local;
+    auto result = fold(operation, lhsConstant, rhsConstant);
+
+    if (result.kind != Kind::None) {
+        pushConstant(result);
+        return;
+    }
+
+    auto expression = new AST::BinaryExpression{operation, materialise(lhs, lhsConstant), materialise(rhs, rhsConstant)};
+
+    if (local.empty() || rhsConstant.kind != Kind::Int) {
+        pushExpression(expression);
+        return;
+    }
+
+    // `local + constant` is remembered for a later `local = local + constant`
+    auto step = rhsConstant.integer;
+    if (operation == AST::BinaryExpression::Operation::ADD) {
+        pushExpression(expression, Shape{"", local, step});
+    } else if (operation == AST::BinaryExpression::Operation::SUB) {
+        pushExpression(expression, Shape{"", local, -step});
+    } else if (auto compare = comparator(operation)) {
+        auto bounds = Shape{"", "", 0, local, LONG_MIN, LONG_MAX};
+        if (operation == AST::BinaryExpression::Operation::LT) bounds.high = step;
+        if (operation == AST::BinaryExpression::Operation::LTE) bounds.high = step + 1;
+        if (operation == AST::BinaryExpression::Operation::GT) bounds.low = step + 1;
+        if (operation == AST::BinaryExpression::Operation::GTE) bounds.low = step;
+
+        pushExpression(new AST::CompareLocalExpression{local, step, compare, expression}, bounds);
+    } else {
+        pushExpression(expression);
+    }
+}
+
+void Optimizer::visitProgram(long size)
+{
+    auto topLevelDeclarations = declarations.pop(size);
+    std::reverse(topLevelDeclarations.begin(), topLevelDeclarations.end());
+    program = new AST::Program{topLevelDeclarations};
+}
+
+void Optimizer::visitBoolType()
+{
+    types.push(new AST::BoolType{});
+}
+
+void Optimizer::visitIntType()
+{
+    types.push(new AST::IntType{});
+}
+
+void Optimizer::visitFloat32Type()
+{
+    types.push(new AST::Float32Type{});
+}
+
+void Optimizer::visitRuneType()
+{
+    types.push(new AST::RuneType{});
+}
+
+void Optimizer::visitStringType()
+{
+    types.push(new AST::StringType{});
+}
+
+void Optimizer::visitArrayType(long size)
+{
+    types.push(new AST::ArrayType{size, types.pop()});
+}
+
+void Optimizer::visitSliceType()
+{
+    types.push(new AST::SliceType{types.pop()});
+}
+
+void Optimizer::visitStructType(std::vector<Atom> fields)
+{
+    auto fieldTypes = types.pop(fields.size());
+    std::reverse(fieldTypes.begin(), fieldTypes.end());
+
+    std::vector<std::pair<Atom, AST::Type *>> pairs;
+    for (int i = 0; i < fields.size(); ++i) {
+        pairs.push_back(std::make_pair(fields[i], fieldTypes[i]));
+    }
+
+    types.push(new AST::StructType{pairs});
+}
+
+void Optimizer::visitPointerType()
+{
+    types.push(new AST::PointerType{types.pop()});
+}
+
+void Optimizer::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
+{
+    auto returnTypes = types.pop(returns.size());
+    std::reverse(returnTypes.begin(), returnTypes.end());
+    auto parameterTypes = types.pop(parameters.size());
+    std::reverse(parameterTypes.begin(), parameterTypes.end());
+
+    std::vector<std::pair<Atom, AST::Type *>> parameterPairs;
+    for (int i = 0; i < parameters.size(); ++i) {
+        parameterPairs.push_back(std::make_pair(parameters[i], parameterTypes[i]));
+    }
+
+    std::vector<std::pair<Atom, AST::Type *>> returnPairs;
+    for (int i = 0; i < returns.size(); ++i) {
+        returnPairs.push_back(std::make_pair(returns[i], returnTypes[i]));
+    }
+
+    types.push(new AST::FunctionType{parameterPairs, returnPairs});
+
+    signatureLocals = parameters;
+    signatureLocals.insert(signatureLocals.end(), returns.begin(), returns.end());
+}
+
+void Optimizer::visitMapType()
+{
+    auto elementType = types.pop();
+    auto keyType = types.pop();
+    types.push(new AST::MapType{keyType, elementType});
+}
+
+void Optimizer::visitCustomType(Atom id)
+{
+    types.push(new AST::CustomType{id});
+}
+
+void Optimizer::visitBlock(AST::Visits visitStatements)
+{
+    auto body = collectStatements(visitStatements);
+    blocks.push(new AST::Block{body});
+    blockSizes.push(body.size());
+}
+
+void Optimizer::visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody)
+{
+    auto optimize = [this, id, visitSignature, visitBody]() {
+        visitSignature();
+        auto signature = types.pop();
+        beginFrame();
+        visitBody();
+        endFrame();
+        blockSizes.pop();
+        declarations.push(new AST::FunctionDeclaration{id, signature, blocks.pop()});
+    };
+
+    if (!lazy) {
+        optimize();
+        return;
+    }
+
+    // The body may not be valid yet, the program declares the function without it
+    functionDeclarationOptimizers.insert(std::make_pair(id, optimize));
+    visitSignature();
+    declarations.push(new AST::FunctionDeclaration{id, types.pop(), nullptr});
+}
+
+void Optimizer::visitTypeAliasDeclaration(Atom id, AST::Visit visitType)
+{
+    visitType();
+    declarations.push(new AST::TypeAliasDeclaration{id, types.pop()});
+}
+
+void Optimizer::visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType)
+{
+    visitType();
+    declarations.push(new AST::TypeDefinitionDeclaration{id, types.pop()});
+}
+
+void Optimizer::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
+{
+    if (!frames.empty()) {
+        for (auto id : ids) {
+            store(id);
+            frames.back().locals.insert(id);
+        }
+
+        if (ids.size() == 1 && expression_count == 1 && constants.top().kind == Kind::Int) {
+            effect = Effect{ids[0], true, constants.top().integer};
+        }
+    }
+
+    auto values = popExpressions(expression_count);
+    auto type = typeDeclared ? types.pop() : nullptr;
+    declarations.push(new AST::VariableDeclaration{ids, type, values});
+}
+
+void Optimizer::visitExpressionStatement()
+{
+    // A constant expression has no side effects
+    if (constants.top().kind != Kind::None) {
+        expressions.pop();
+        constants.pop();
+        shapes.pop();
+        statements.push(nullptr);
+        return;
+    }
+
+    statements.push(new AST::ExpressionStatement{popExpression()});
+}
+
+void Optimizer::visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs)
+{
+    auto lhsSize = visitLhs();
+    auto local = lhsSize == 1 ? shapes.top().local : "";
+    auto lhs = popExpressions(lhsSize);
+
+    auto rhsSize = visitRhs();
+    auto rhsShape = rhsSize == 1 ? shapes.top() : Shape{"", "", 0};
+    auto rhsConstant = rhsSize == 1 ? constants.top() : Constant::none();
+    auto rhs = popExpressions(rhsSize);
+
+    auto assignment = new AST::AssignmentStatement{lhs, rhs};
+
+    if (!local.empty() && rhsShape.stepped == local) {
+        statements.push(new AST::IncrementStatement{local, rhsShape.step, assignment});
+        effect = Effect{local, false, rhsShape.step};
+    } else {
+        statements.push(assignment);
+        if (!local.empty() && rhsConstant.kind == Kind::Int) effect = Effect{local, true, rhsConstant.integer};
+    }
+}
+
+void Optimizer::visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate)
+{
+    visitTarget();
+    auto local = shapes.top().local;
+
+    visitUpdate();
+    auto updateShape = shapes.top();
+    auto update = popExpression();
+    auto target = popExpression();
+
+    auto assignment = new AST::CompoundAssignmentStatement{target, update};
+
+    if (!local.empty() && updateShape.stepped == local) {
+        statements.push(new AST::IncrementStatement{local, updateShape.step, assignment});
+        effect = Effect{local, false, updateShape.step};
+    } else {
+        statements.push(assignment);
+    }
+}
+
+void Optimizer::visitIncDecStatement(AST::Visit visitTarget, long delta)
+{
+    visitTarget();
+    auto local = shapes.top().local;
+
+    auto statement = new AST::IncDecStatement{popExpression(), delta};
+
+    if (!local.empty()) {
+        statements.push(new AST::IncrementStatement{local, delta, statement});
+        effect = Effect{local, false, delta};
+    } else {
+        statements.push(statement);
+    }
+}
+
+void Optimizer::visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse)
+{
+    auto condition = expressions.pop();
+    auto constant = constants.pop();
+    shapes.pop();
+
+    if (constant.kind != Kind::Bool) {
+        condition = materialise(condition, constant);
+        visitTrue();
+        blockSizes.pop();
+        auto trueBody = blocks.pop();
+        visitFalse();
+        blockSizes.pop();
+        auto falseBody = blocks.pop();
+        statements.push(new AST::IfStatement{condition, trueBody, falseBody});
+        return;
+    }
+
+    // Only the taken branch is kept, as a nested block to preserve its scope
+    if (constant.boolean) {
+        visitTrue();
+    } else {
+        visitFalse();
+    }
+
+    if (blockSizes.pop() == 0) {
+        delete blocks.pop();
+        statements.push(nullptr);
+    } else {
+        statements.push(new AST::BlockStatement{blocks.pop()});
+    }
+}
+
+AST::SwitchTable *Optimizer::makeSwitchTable(const std::vector<Clause>& clauses)
+{
+    std::vector<std::pair<long, long>> integers;
+    std::vector<std::pair<std::string, long>> strings;
+    long defaultClause = AST::SwitchTable::NO_CLAUSE;
+
+    for (long i = 0; i < clauses.size(); ++i) {
+        if (clauses[i].isDefault) {
+            defaultClause = i;
+            continue;
+        }
+
+        for (const auto& label : clauses[i].labels) {
+            switch (label.kind) {
+                case Kind::Int: integers.emplace_back(label.integer, i); break;
+                case Kind::Rune: integers.emplace_back(label.rune, i); break;
+                case Kind::String: strings.emplace_back(label.string, i); break;
+                default: return nullptr;
+            }
+        }
+    }
+
+    if (!integers.empty() && strings.empty()) return new AST::SwitchTable{integers, defaultClause};
+    if (!strings.empty() && integers.empty()) return new AST::SwitchTable{strings, defaultClause};
+
+    return nullptr;
+}
+
+void Optimizer::visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table)
+{
+    visitExpression();
+    auto expression = expressions.pop();
+    auto constant = constants.pop();
+    shapes.pop();
+
+    for (const auto& visitClause : visitClauses) {
+        visitClause();
+    }
+
+    auto visited = clauses.pop(visitClauses.size());
+    std::reverse(visited.begin(), visited.end());
+
+    std::vector<Clause> kept;
+
+    if (constant.kind == Kind::None) {
+        kept = visited;
+    } else {
+        // Find the clause that will be taken, as long as that can be decided
+        // from the labels preceding it
+        long taken = -1;
+        long defaultClause = -1;
+        bool decidable = true;
+
+        for (long i = 0; i < visited.size() && decidable && taken < 0; ++i) {
+            if (visited[i].isDefault) {
+                defaultClause = i;
+                continue;
+            }
+
+            for (const auto& label : visited[i].labels) {
+                if (label.kind == Kind::None) {
+                    decidable = false;
+                } else if (decidable && label.equals(constant)) {
+                    taken = i;
+                    break;
+                }
+            }
+        }
+
+        if (decidable && taken < 0) {
+            for (long i = 0; i < visited.size(); ++i) {
+                if (visited[i].isDefault) defaultClause = i;
+            }
+            taken = defaultClause;
+        }
+
+        for (long i = 0; i < visited.size(); ++i) {
+            auto& clause = visited[i];
+            bool keep;
+
+            if (decidable) {
+                keep = i == taken;
+                // The taken clause runs unconditionally
+                clause.isDefault = true;
+            } else {
+                // Clauses whose labels are all constant and different can never match
+                keep = clause.isDefault;
+                for (const auto& label : clause.labels) {
+                    keep = keep || label.kind == Kind::None || label.equals(constant);
+                }
+            }
+
+            if (keep) {
+                kept.push_back(clause);
+                continue;
+            }
+
+            for (const auto label : clause.expressions) delete label;
+            for (const auto statement : clause.statements) delete statement;
+        }
+
+        if (kept.empty()) {
+            statements.push(nullptr);
+            return;
+        }
+    }
+
+    std::vector<AST::SwitchStatement::SwitchClause *> switchClauses;
+
+    for (const auto& clause : kept) {
+        if (clause.isDefault) {
+            for (const auto label : clause.expressions) delete label;
+            switchClauses.push_back(new AST::SwitchStatement::SwitchDefaultClause{clause.statements});
+        } else {
+            std::vector<AST::Expression *> labels;
+            for (int i = 0; i < clause.expressions.size(); ++i) {
+                labels.push_back(materialise(clause.expressions[i], clause.labels[i]));
+            }
+            switchClauses.push_back(new AST::SwitchStatement::SwitchExpressionClause{labels, clause.statements});
+        }
+    }
+
+    auto dispatch = constant.kind == Kind::None ? makeSwitchTable(kept) : nullptr;
+    statements.push(new AST::SwitchStatement{materialise(expression, constant), switchClauses, dispatch});
+}
+
+void Optimizer::visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements)
+{
+    for (const auto& visitExpression : visitExpressions) {
+        visitExpression();
+    }
+
+    shapes.pop(visitExpressions.size());
+    auto labels = constants.pop(visitExpressions.size());
+    std::reverse(labels.begin(), labels.end());
+    auto labelExpressions = expressions.pop(visitExpressions.size());
+    std::reverse(labelExpressions.begin(), labelExpressions.end());
+
+    clauses.push(Clause{false, labelExpressions, labels, collectStatements(visitStatements)});
+}
+
+void Optimizer::visitSwitchDefaultClause(AST::Visits visitStatements)
+{
+    clauses.push(Clause{true, {}, {}, collectStatements(visitStatements)});
+}
+
+void Optimizer::visitReturnStatement(long size)
+{
+    auto expressions = popExpressions(size);
+
+    // `return f(...)` can reuse the frame of the returning function
+    if (size == 1) {
+        if (auto call = dynamic_cast<AST::CallExpression *>(expressions[0])) {
+            call->markTailCall();
+        }
+    }
+
+    statements.push(new AST::ReturnStatement{expressions});
+}
+
+void Optimizer::visitBreakStatement()
+{
+    statements.push(new AST::BreakStatement{});
+}
+
+void Optimizer::visitContinueStatement()
+{
+    statements.push(new AST::ContinueStatement{});
+}
+
+void Optimizer::visitEmptyStatement()
+{
+    statements.push(new AST::EmptyStatement{});
+}
+
+void Optimizer::visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody)
+{
+    // Without init statement the counter starts where the statement before left it
+    auto start = entry;
+    effect = Effect{};
+
+    visitInit();
+    auto init = popSimpleStatement();
+    if (dynamic_cast<AST::EmptyStatement *>(init) == nullptr) start = effect;
+
+    visitCondition();
+    auto condition = expressions.pop();
+    auto constant = constants.pop();
+    auto bounds = shapes.pop();
+
+    // The body never runs, only the init statement remains
+    if (constant.kind == Kind::Bool && !constant.boolean) {
+        statements.push(init);
+        return;
+    }
+
+    condition = materialise(condition, constant);
+
+    effect = Effect{};
+    visitPost();
+    auto post = popSimpleStatement();
+
+    auto counted = beginRange(start, bounds, effect);
+    visitBody();
+    if (counted) endRange();
+    blockSizes.pop();
+
+    statements.push(new AST::ForConditionStatement{init, condition, post, blocks.pop()});
+}
+
+void Optimizer::visitBoolExpression(bool value)
+{
+    pushConstant(makeBool(value));
+}
+
+void Optimizer::visitIntExpression(long value)
+{
+    pushConstant(makeInt(value));
+}
+
+void Optimizer::visitFloat32Expression(float value)
+{
+    pushConstant(makeFloat32(value));
+}
+
+void Optimizer::visitRuneExpression(char value)
+{
+    pushConstant(makeRune(value));
+}
+
+void Optimizer::visitStringExpression(char *value, long length)
+{
+    pushConstant(makeString(std::string(value, length)));
+}
+
+void Optimizer::visitConstantExpression(long index, AST::Visit visitLiteral)
+{
+    // Pool indices are reassigned for the rebuilt program
+    visitLiteral();
+}
+
+void Optimizer::visitIdentifierExpression(Atom id)
+{
+    pushExpression(new AST::IdentifierExpression{id}, Shape{id, "", 0});
+}
+
+void Optimizer::visitTargetExpression()
+{
+    // Reads the target visited just before the update, so `x += 1` can be fused like `x = x + 1`
+    pushExpression(new AST::TargetExpression{}, Shape{shapes.top().local, "", 0});
+}
+
+void Optimizer::visitCompositLiteralExpression(std::vector<Atom> keys)
+{
+    auto values = popExpressions(keys.size());
+    auto type = types.pop();
+
+    std::vector<std::pair<Atom, AST::Expression *>> elements;
+    for (int i = 0; i < keys.size(); ++i) {
+        elements.push_back(std::make_pair(keys[i], values[i]));
+    }
+
+    pushExpression(new AST::CompositLiteralExpression{type, elements});
+}
+
+void Optimizer::VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody)
+{
+    visitSignature();
+    auto signature = types.pop();
+    beginFrame();
+    visitBody();
+    endFrame();
+    blockSizes.pop();
+    pushExpression(new AST::FunctionLiteralExpression{signature, blocks.pop()});
+}
+
+void Optimizer::visitSelectExpression(Atom id, long& fieldIndex)
+{
+    pushExpression(new AST::SelectExpression{popExpression(), id, fieldIndex});
+}
+
+void Optimizer::visitIndexExpression(long& length, bool checked)
+{
+    Range *range;
+    auto proven = inBounds(length, range);
+
+    auto index = popExpression();
+    auto local = shapes.top().local;
+    auto expression = popExpression();
+    auto row = dynamic_cast<AST::ElementExpression *>(expression);
+
+    if (!local.empty()) {
+        delete expression;
+        auto access = new AST::IndexLocalExpression{local, index, length, !proven};
+        if (proven) removeBoundsCheck(range, [access]() { access->setChecked(true); });
+        pushExpression(access);
+    } else if (length >= 0 && row != nullptr && row->getLength() >= 0) {
+        // An element of an array of arrays, the row access keeps its node and its own check
+        auto access = new AST::IndexGridExpression{row, index, length, !proven};
+        if (proven) removeBoundsCheck(range, [access]() { access->setChecked(true); });
+        pushExpression(access);
+    } else {
+        auto access = new AST::IndexExpression{expression, index, length, !proven};
+        if (proven) removeBoundsCheck(range, [access]() { access->setChecked(true); });
+        pushExpression(access);
+    }
+}
+
+void Optimizer::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared)
+{
+    auto high = highDeclared ? popExpressions(1)[0] : nullptr;
+    auto low = lowDeclared ? popExpressions(1)[0] : nullptr;
+    auto expression = popExpressions(1)[0];
+    pushExpression(new AST::SimpleSliceExpression{expression, low, high});
+}
+
+void Optimizer::visitFullSliceExpression(bool lowDeclared)
+{
+    auto max = popExpressions(1)[0];
+    auto high = popExpressions(1)[0];
+    auto low = lowDeclared ? popExpressions(1)[0] : nullptr;
+    auto expression = popExpressions(1)[0];
+    pushExpression(new AST::FullSliceExpression{expression, low, high, max});
+}
+
+void Optimizer::visitCallExpression(long size, long line, bool tailCall)
+{
+    auto arguments = popExpressions(size);
+    auto expression = popExpressions(1)[0];
+    pushExpression(new AST::CallExpression{expression, arguments, line, tailCall});
+}
+
+void Optimizer::visitConversionExpression()
+{
+    auto expression = popExpressions(1)[0];
+    pushExpression(new AST::ConversionExpression{types.pop(), expression});
+}
+
+void Optimizer::visitNewExpression(AST::Visit visitType)
+{
+    visitType();
+    pushExpression(new AST::NewExpression{types.pop()});
+}
+
+void Optimizer::visitUnaryPlusExpression()
+{
+    foldUnary(AST::UnaryExpression::Operation::PLUS);
+}
+
+void Optimizer::visitUnaryNegateExpression()
+{
+    foldUnary(AST::UnaryExpression::Operation::NEGATE);
+}
+
+void Optimizer::visitUnaryLogicalNotExpression()
+{
+    foldUnary(AST::UnaryExpression::Operation::L_NOT);
+}
+
+void Optimizer::visitUnaryBitwiseNotExpression()
+{
+    foldUnary(AST::UnaryExpression::Operation::BW_NOT);
+}
+
+void Optimizer::visitUnaryDereferenceExpression()
+{
+    foldUnary(AST::UnaryExpression::Operation::DEREFERENCE);
+}
+
+void Optimizer::visitUnaryReferenceExpression(bool& escapes)
+{
+    // The operand was visited as a store, it is no constant
+    auto local = shapes.top().local;
+    if (!local.empty() && !frames.empty()) frames.back().addressed.insert(local);
+
+    pushExpression(new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, popExpression(), escapes});
+}
+
+void Optimizer::visitBinaryLogicalOrExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::L_OR);
+}
+
+void Optimizer::visitBinaryLogicalAndExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::L_AND);
+}
+
+void Optimizer::visitBinaryEqualExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::EQ);
+}
+
+void Optimizer::visitBinaryNotEqualExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::NEQ);
+}
+
+void Optimizer::visitBinaryLessThanExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::LT);
+}
+
+void Optimizer::visitBinaryLessThanEqualExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::LTE);
+}
+
+void Optimizer::visitBinaryGreaterThanExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::GT);
+}
+
+void Optimizer::visitBinaryGreaterThanEqualExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::GTE);
+}
+
+void Optimizer::visitBinaryShiftLeftExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::SHIFT_LEFT);
+}
+
+void Optimizer::visitBinaryShiftRightExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::SHIFT_RIGHT);
+}
+
+void Optimizer::visitBinaryAddExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::ADD);
+}
+
+void Optimizer::visitBinarySubtractExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::SUB);
+}
+
+void Optimizer::visitBinaryBitwiseOrExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::BW_OR);
+}
+
+void Optimizer::visitBinaryBitwiseXOrExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::BW_XOR);
+}
+
+void Optimizer::visitBinaryBitwiseAndExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::BW_AND);
+}
+
+void Optimizer::visitBinaryMultiplyExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::MULT);
+}
+
+void Optimizer::visitBinaryDivideExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::DIV);
+}
+
+void Optimizer::visitBinaryModuloExpression()
+{
+    foldBinary(AST::BinaryExpression::Operation::MOD);
+}
+
+void Optimizer::visitIdentifierStore(Atom id)
+{
+    store(id);
+    pushExpression(new AST::IdentifierExpression{id}, Shape{id, "", 0});
+}
+
+void Optimizer::visitSelectStore(Atom id, long& fieldIndex)
+{
+    pushExpression(new AST::SelectExpression{popExpression(), id, fieldIndex});
+}
+
+void Optimizer::visitIndexStore(long& length, bool checked)
+{
+    Range *range;
+    auto proven = inBounds(length, range);
+
+    auto index = popExpression();
+    auto access = new AST::IndexExpression{popExpression(), index, length, !proven};
+    if (proven) removeBoundsCheck(range, [access]() { access->setChecked(true); });
+    pushExpression(access);
+}
+
+void Optimizer::visitDereferenceStore()
+{
+    pushExpression(new AST::UnaryExpression{AST::UnaryExpression::Operation::DEREFERENCE, popExpression()});
+}
+
+void Optimizer::visitLiteralStore()
+{}
+
+void Optimizer::visitValueStore()
+{}
+
+void Optimizer::visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Optimizer::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Optimizer::visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Optimizer::visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.12-4996.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.7.12-4996"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,227 +66,278 @@
 
 
 
-/* Copy the first part of user declarations.  */
 
-/* Line 371 of yacc.c  */
-#line 68 "src/parsing/parser.cpp"
-
-# ifndef YY_NULL
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULL nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULL 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+#include "parsing/parser.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_BOOL = 3,                       /* BOOL  */
+  YYSYMBOL_INT = 4,                        /* INT  */
+  YYSYMBOL_FLOAT32 = 5,                    /* FLOAT32  */
+  YYSYMBOL_RUNE = 6,                       /* RUNE  */
+  YYSYMBOL_STRING = 7,                     /* STRING  */
+  YYSYMBOL_STRUCT = 8,                     /* STRUCT  */
+  YYSYMBOL_FUNC = 9,                       /* FUNC  */
+  YYSYMBOL_MAP = 10,                       /* MAP  */
+  YYSYMBOL_TYPE = 11,                      /* TYPE  */
+  YYSYMBOL_VAR = 12,                       /* VAR  */
+  YYSYMBOL_SHORT_VAR_DECL = 13,            /* SHORT_VAR_DECL  */
+  YYSYMBOL_IF = 14,                        /* IF  */
+  YYSYMBOL_ELSE = 15,                      /* ELSE  */
+  YYSYMBOL_SWITCH = 16,                    /* SWITCH  */
+  YYSYMBOL_CASE = 17,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 18,                   /* DEFAULT  */
+  YYSYMBOL_RETURN = 19,                    /* RETURN  */
+  YYSYMBOL_BREAK = 20,                     /* BREAK  */
+  YYSYMBOL_CONTINUE = 21,                  /* CONTINUE  */
+  YYSYMBOL_FOR = 22,                       /* FOR  */
+  YYSYMBOL_INC = 23,                       /* INC  */
+  YYSYMBOL_DEC = 24,                       /* DEC  */
+  YYSYMBOL_ELLIPSIS = 25,                  /* ELLIPSIS  */
+  YYSYMBOL_OR = 26,                        /* OR  */
+  YYSYMBOL_AND = 27,                       /* AND  */
+  YYSYMBOL_EQ = 28,                        /* EQ  */
+  YYSYMBOL_NEQ = 29,                       /* NEQ  */
+  YYSYMBOL_LTE = 30,                       /* LTE  */
+  YYSYMBOL_GTE = 31,                       /* GTE  */
+  YYSYMBOL_SHIFT_LEFT = 32,                /* SHIFT_LEFT  */
+  YYSYMBOL_SHIFT_RIGHT = 33,               /* SHIFT_RIGHT  */
+  YYSYMBOL_BODY = 34,                      /* BODY  */
+  YYSYMBOL_IDENTIFIER = 35,                /* IDENTIFIER  */
+  YYSYMBOL_INT_LITERAL = 36,               /* INT_LITERAL  */
+  YYSYMBOL_FLOAT_LITERAL = 37,             /* FLOAT_LITERAL  */
+  YYSYMBOL_BOOL_LITERAL = 38,              /* BOOL_LITERAL  */
+  YYSYMBOL_RUNE_LITERAL = 39,              /* RUNE_LITERAL  */
+  YYSYMBOL_STRING_LITERAL = 40,            /* STRING_LITERAL  */
+  YYSYMBOL_41_ = 41,                       /* '<'  */
+  YYSYMBOL_42_ = 42,                       /* '>'  */
+  YYSYMBOL_43_ = 43,                       /* '+'  */
+  YYSYMBOL_44_ = 44,                       /* '-'  */
+  YYSYMBOL_45_ = 45,                       /* '|'  */
+  YYSYMBOL_46_ = 46,                       /* '^'  */
+  YYSYMBOL_47_ = 47,                       /* '*'  */
+  YYSYMBOL_48_ = 48,                       /* '/'  */
+  YYSYMBOL_49_ = 49,                       /* '%'  */
+  YYSYMBOL_50_ = 50,                       /* '&'  */
+  YYSYMBOL_51_ = 51,                       /* '('  */
+  YYSYMBOL_52_ = 52,                       /* ')'  */
+  YYSYMBOL_53_ = 53,                       /* '['  */
+  YYSYMBOL_54_ = 54,                       /* ']'  */
+  YYSYMBOL_55_ = 55,                       /* '{'  */
+  YYSYMBOL_56_ = 56,                       /* '}'  */
+  YYSYMBOL_57_ = 57,                       /* ','  */
+  YYSYMBOL_58_ = 58,                       /* ';'  */
+  YYSYMBOL_59_ = 59,                       /* '='  */
+  YYSYMBOL_60_ = 60,                       /* ':'  */
+  YYSYMBOL_61_ = 61,                       /* '!'  */
+  YYSYMBOL_62_ = 62,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 63,                  /* $accept  */
+  YYSYMBOL_start = 64,                     /* start  */
+  YYSYMBOL_type = 65,                      /* type  */
+  YYSYMBOL_literal_type = 66,              /* literal_type  */
+  YYSYMBOL_composite_type = 67,            /* composite_type  */
+  YYSYMBOL_array_length = 68,              /* array_length  */
+  YYSYMBOL_function_signature = 69,        /* function_signature  */
+  YYSYMBOL_function_result = 70,           /* function_result  */
+  YYSYMBOL_function_parameters = 71,       /* function_parameters  */
+  YYSYMBOL_function_parameter_list = 72,   /* function_parameter_list  */
+  YYSYMBOL_struct_field_decls = 73,        /* struct_field_decls  */
+  YYSYMBOL_block = 74,                     /* block  */
+  YYSYMBOL_body = 75,                      /* body  */
+  YYSYMBOL_top_level_declaration = 76,     /* top_level_declaration  */
+  YYSYMBOL_top_level_declaration_list = 77, /* top_level_declaration_list  */
+  YYSYMBOL_function_declaration = 78,      /* function_declaration  */
+  YYSYMBOL_declaration = 79,               /* declaration  */
+  YYSYMBOL_type_decl = 80,                 /* type_decl  */
+  YYSYMBOL_type_spec = 81,                 /* type_spec  */
+  YYSYMBOL_type_spec_list = 82,            /* type_spec_list  */
+  YYSYMBOL_var_decl = 83,                  /* var_decl  */
+  YYSYMBOL_var_spec = 84,                  /* var_spec  */
+  YYSYMBOL_var_spec_list = 85,             /* var_spec_list  */
+  YYSYMBOL_statement = 86,                 /* statement  */
+  YYSYMBOL_simple_statement = 87,          /* simple_statement  */
+  YYSYMBOL_statement_list = 88,            /* statement_list  */
+  YYSYMBOL_if_statement = 89,              /* if_statement  */
+  YYSYMBOL_switch_statement = 90,          /* switch_statement  */
+  YYSYMBOL_switch_clause = 91,             /* switch_clause  */
+  YYSYMBOL_switch_clause_list = 92,        /* switch_clause_list  */
+  YYSYMBOL_return_statement = 93,          /* return_statement  */
+  YYSYMBOL_for_statement = 94,             /* for_statement  */
+  YYSYMBOL_for_condition_statement = 95,   /* for_condition_statement  */
+  YYSYMBOL_expression = 96,                /* expression  */
+  YYSYMBOL_optional_expression = 97,       /* optional_expression  */
+  YYSYMBOL_unary_expression = 98,          /* unary_expression  */
+  YYSYMBOL_operand = 99,                   /* operand  */
+  YYSYMBOL_literal = 100,                  /* literal  */
+  YYSYMBOL_basic_literal = 101,            /* basic_literal  */
+  YYSYMBOL_expression_list = 102,          /* expression_list  */
+  YYSYMBOL_composite_literal = 103,        /* composite_literal  */
+  YYSYMBOL_element_list = 104,             /* element_list  */
+  YYSYMBOL_keyed_element = 105,            /* keyed_element  */
+  YYSYMBOL_primary_expression = 106,       /* primary_expression  */
+  YYSYMBOL_identifier_list = 107           /* identifier_list  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* In a future release of Bison, this section will be replaced
-   by #include "parser.hpp".  */
-#ifndef YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED
-# define YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-/* "%code requires" blocks.  */
-/* Line 387 of yacc.c  */
-#line 13 "src/parsing/parser.y"
 
-    #include <string>
-    #include <map>
-    #include <vector>
-    #include "ast/ast.hpp"
-    #include "utils/linked_list.hpp"
-
-    typedef struct str {
-        char *string;
-        int length;
-    } str;
-
-
-/* Line 387 of yacc.c  */
-#line 114 "src/parsing/parser.cpp"
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     BOOL = 258,
-     INT = 259,
-     FLOAT32 = 260,
-     RUNE = 261,
-     STRING = 262,
-     STRUCT = 263,
-     FUNC = 264,
-     MAP = 265,
-     TYPE = 266,
-     VAR = 267,
-     SHORT_VAR_DECL = 268,
-     IF = 269,
-     ELSE = 270,
-     SWITCH = 271,
-     CASE = 272,
-     DEFAULT = 273,
-     RETURN = 274,
-     BREAK = 275,
-     CONTINUE = 276,
-     FOR = 277,
-     INC = 278,
-     DEC = 279,
-     ELLIPSIS = 280,
-     OR = 281,
-     AND = 282,
-     EQ = 283,
-     NEQ = 284,
-     LTE = 285,
-     GTE = 286,
-     SHIFT_LEFT = 287,
-     SHIFT_RIGHT = 288,
-     IDENTIFIER = 289,
-     INT_LITERAL = 290,
-     FLOAT_LITERAL = 291,
-     BOOL_LITERAL = 292,
-     RUNE_LITERAL = 293,
-     STRING_LITERAL = 294
-   };
-#endif
 
+/* Unqualified %code blocks.  */
+#line 5 "src/parsing/parser.y"
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-{
-/* Line 387 of yacc.c  */
-#line 26 "src/parsing/parser.y"
+    #include <algorithm>
+    #include <iostream>
+    #include <iterator>
+    #include <string>
+    #include "lexing/lexer.hpp"
+    AST::Program *tree;
 
-    int integer;
-    float floating;
-    bool boolean;
-    char rune;
-    char *identifier;
-    str string;
+    void yyerror(char *s);
 
-    AST::Block *block;
+    // Set by the lexer when the next `{` opens the body of an if, for or switch statement
+    extern bool bodyNext;
+
+    // Predeclared type names the lexer reads as identifiers
+    bool isSizedInt(Atom id)
+    {
+        static const Atom names[] = {"int8", "int16", "int32", "int64", "uint8", "uint16", "uint32", "uint64", "byte"};
+        return std::find(std::begin(names), std::end(names), id) != std::end(names);
+    }
 
-    AST::Type *type;
+    // `new(T)` parses as a call, the argument names the type, and so do conversions to sized integers
+    AST::Expression *makeCall(AST::Expression *callee, std::vector<AST::Expression *> arguments, long line)
+    {
+        auto function = dynamic_cast<AST::IdentifierExpression *>(callee);
 
-    AST::Declaration *declaration;
-    LinkedList<AST::Declaration *> *declarations;
-    AST::TopLevelDeclaration *top_level_declaration;
-    LinkedList<AST::TopLevelDeclaration *> *top_level_declarations;
+        if (function != nullptr && arguments.size() == 1 && isSizedInt(function->getId())) {
+            auto expression = new AST::ConversionExpression{new AST::CustomType{function->getId()}, arguments[0]};
+            delete callee;
+            return expression;
+        }
 
-    AST::SimpleStatement *simple_statement;
-    AST::Statement *statement;
-    LinkedList<AST::Statement *> *statements;
-    AST::SwitchStatement::SwitchClause *switch_clause;
-    LinkedList<AST::SwitchStatement::SwitchClause *> *switch_clauses;
+        auto type = arguments.size() == 1 ? dynamic_cast<AST::IdentifierExpression *>(arguments[0]) : nullptr;
 
-    AST::Expression *expression;
-    LinkedList<AST::Expression *> *expressions;
-    LinkedList<std::pair<std::string, AST::Expression *>> *keyed_expressions;
+        if (function == nullptr || type == nullptr || !(function->getId() == Atom{"new"})) {
+            return new AST::CallExpression{callee, arguments, line};
+        }
 
-    LinkedList<std::string> *id_list;
-    LinkedList<std::pair<std::string, AST::Type *>> *fields;
+        auto expression = new AST::NewExpression{new AST::CustomType{type->getId()}};
+        delete callee;
+        delete type;
+        return expression;
+    }
 
+#line 255 "src/parsing/parser.cpp"
 
-/* Line 387 of yacc.c  */
-#line 200 "src/parsing/parser.cpp"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifdef short
+# undef short
 #endif
 
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-extern YYSTYPE yylval;
-extern YYLTYPE yylloc;
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
-int yyparse ();
+typedef signed char yytype_int8;
 #endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-int yyparse ();
+typedef short yytype_int16;
 #endif
-#endif /* ! YYPARSE_PARAM */
-
-#endif /* !YY_YY_INCLUDE_PARSING_PARSER_HPP_INCLUDED  */
 
-/* Copy the second part of user declarations.  */
-
-/* Line 390 of yacc.c  */
-#line 241 "src/parsing/parser.cpp"
-/* Unqualified %code blocks.  */
-/* Line 391 of yacc.c  */
-#line 4 "src/parsing/parser.y"
-
-    #include <iostream>
-    #include <string>
-    #include "lexing/lexer.hpp"
-    AST::Program *tree;
-
-    void yyerror(char *s);
-
-
-/* Line 391 of yacc.c  */
-#line 255 "src/parsing/parser.cpp"
-
-#ifdef short
-# undef short
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
 typedef unsigned char yytype_uint8;
-#endif
-
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
 #else
-typedef short int yytype_int8;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef int yytype_uint16;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
-#else
-typedef short int yytype_int16;
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -289,16 +345,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -312,41 +380,71 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef __attribute__
-/* This feature is available in gcc versions 2.5 and later.  */
-# if (! defined __GNUC__ || __GNUC__ < 2 \
-      || (__GNUC__ == 2 && __GNUC_MINOR__ < 5))
-#  define __attribute__(Spec) /* empty */
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(N) (N)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -363,8 +461,7 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
       /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
@@ -376,8 +473,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -393,7 +490,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -401,42 +498,40 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
-	     && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -446,16 +541,16 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
@@ -465,16 +560,16 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
-      while (YYID (0))
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -482,40 +577,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  19
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   919
+#define YYLAST   1553
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  62
+#define YYNTOKENS  63
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  43
+#define YYNNTS  45
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  132
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  246
+#define YYNRULES  152
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  294
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   294
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   295
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    60,     2,     2,     2,    48,    49,     2,
-      50,    51,    46,    42,    56,    43,    61,    47,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    59,    57,
-      40,    58,    41,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    61,     2,     2,     2,    49,    50,     2,
+      51,    52,    47,    43,    57,    44,    62,    48,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    60,    58,
+      41,    59,    42,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    52,     2,    53,    45,     2,     2,     2,     2,     2,
+       2,    53,     2,    54,    46,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    54,    44,    55,     2,     2,     2,     2,
+       2,     2,     2,    55,    45,    56,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -532,545 +632,612 @@ static const yytype_uint8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39
+      35,    36,    37,    38,    39,    40
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     9,    11,    13,    15,    17,    19,
-      22,    25,    27,    29,    34,    38,    43,    49,    51,    54,
-      55,    57,    59,    62,    66,    71,    73,    76,    80,    85,
-      89,    94,    98,   100,   102,   103,   107,   112,   114,   116,
-     119,   124,   128,   131,   134,   138,   141,   146,   149,   154,
-     158,   161,   165,   167,   169,   171,   173,   175,   177,   179,
-     181,   182,   184,   188,   189,   193,   197,   203,   209,   215,
-     220,   224,   225,   228,   231,   233,   241,   245,   248,   250,
-     254,   258,   262,   266,   270,   274,   278,   282,   286,   290,
-     294,   298,   302,   306,   310,   314,   318,   322,   324,   325,
-     327,   330,   333,   336,   339,   342,   345,   347,   349,   353,
-     355,   357,   361,   363,   365,   367,   369,   371,   373,   377,
-     382,   384,   388,   392,   394,   396,   400,   405,   412,   421,
-     425,   430,   432
+       0,   191,   191,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   208,   209,   214,   215,   216,   217,   221,   225,
+     234,   235,   236,   245,   246,   248,   253,   259,   270,   277,
+     291,   302,   317,   322,   327,   336,   346,   347,   360,   367,
+     368,   372,   378,   382,   383,   387,   393,   403,   409,   413,
+     414,   416,   421,   427,   437,   443,   449,   455,   461,   466,
+     471,   477,   489,   490,   491,   499,   500,   502,   503,   504,
+     505,   506,   507,   508,   509,   510,   511,   515,   518,   532,
+     533,   535,   540,   548,   554,   562,   565,   575,   579,   583,
+     587,   591,   599,   611,   612,   613,   614,   615,   616,   617,
+     618,   619,   620,   621,   622,   623,   624,   625,   626,   627,
+     628,   629,   633,   634,   638,   639,   640,   641,   642,   643,
+     644,   645,   649,   650,   651,   655,   656,   657,   661,   662,
+     663,   664,   665,   669,   675,   684,   690,   692,   699,   703,
+     704,   717,   722,   730,   731,   732,   733,   735,   737,   739,
+     741,   747,   752
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      63,     0,    -1,    74,    -1,    50,    64,    51,    -1,     3,
-      -1,     4,    -1,     5,    -1,     6,    -1,     7,    -1,    46,
-      64,    -1,     9,    67,    -1,    65,    -1,    34,    -1,    52,
-      66,    53,    64,    -1,    52,    53,    64,    -1,     8,    54,
-      71,    55,    -1,    10,    52,    64,    53,    64,    -1,    35,
-      -1,    69,    68,    -1,    -1,    69,    -1,    64,    -1,    50,
-      51,    -1,    50,    70,    51,    -1,    50,    70,    56,    51,
-      -1,    64,    -1,   104,    64,    -1,    64,    56,    70,    -1,
-     104,    64,    56,    70,    -1,   104,    64,    57,    -1,   104,
-      64,    57,    71,    -1,    54,    85,    55,    -1,    76,    -1,
-      75,    -1,    -1,    73,    57,    74,    -1,     9,    34,    67,
-      72,    -1,    77,    -1,    80,    -1,    11,    78,    -1,    11,
-      50,    79,    51,    -1,    34,    58,    64,    -1,    34,    64,
-      -1,    78,    57,    -1,    78,    57,    79,    -1,    12,    81,
-      -1,    12,    50,    82,    51,    -1,   104,    64,    -1,   104,
-      64,    58,    99,    -1,   104,    58,    99,    -1,    81,    57,
-      -1,    81,    57,    82,    -1,    84,    -1,    86,    -1,    87,
-      -1,    90,    -1,    20,    -1,    21,    -1,    91,    -1,    76,
-      -1,    -1,    93,    -1,    99,    58,    99,    -1,    -1,    83,
-      57,    85,    -1,    14,    93,    72,    -1,    14,    93,    72,
-      15,    86,    -1,    14,    93,    72,    15,    72,    -1,    16,
-      93,    54,    89,    55,    -1,    17,    99,    59,    85,    -1,
-      18,    59,    85,    -1,    -1,    88,    89,    -1,    19,    99,
-      -1,    92,    -1,    22,    84,    57,    93,    57,    84,    72,
-      -1,    22,    93,    72,    -1,    22,    72,    -1,    95,    -1,
-      93,    26,    93,    -1,    93,    27,    93,    -1,    93,    28,
-      93,    -1,    93,    29,    93,    -1,    93,    30,    93,    -1,
-      93,    31,    93,    -1,    93,    32,    93,    -1,    93,    33,
-      93,    -1,    93,    40,    93,    -1,    93,    41,    93,    -1,
-      93,    42,    93,    -1,    93,    43,    93,    -1,    93,    44,
-      93,    -1,    93,    45,    93,    -1,    93,    49,    93,    -1,
-      93,    46,    93,    -1,    93,    47,    93,    -1,    93,    48,
-      93,    -1,    93,    -1,    -1,   103,    -1,    42,    95,    -1,
-      43,    95,    -1,    60,    95,    -1,    45,    95,    -1,    46,
-      95,    -1,    49,    95,    -1,    97,    -1,    34,    -1,    50,
-      93,    51,    -1,    98,    -1,   100,    -1,     9,    67,    72,
-      -1,    37,    -1,    35,    -1,    36,    -1,    38,    -1,    39,
-      -1,    93,    -1,    93,    56,    99,    -1,    65,    54,   101,
-      55,    -1,   102,    -1,   102,    56,   101,    -1,    34,    59,
-      93,    -1,    93,    -1,    96,    -1,   103,    61,    34,    -1,
-     103,    52,    93,    53,    -1,   103,    52,    94,    59,    94,
-      53,    -1,   103,    52,    94,    59,    93,    59,    93,    53,
-      -1,   103,    50,    51,    -1,   103,    50,    99,    51,    -1,
-      34,    -1,    34,    56,   104,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   152,   152,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   169,   170,   171,   172,   173,   177,   181,   190,
-     191,   192,   201,   202,   204,   209,   215,   226,   233,   247,
-     258,   273,   278,   287,   297,   298,   311,   318,   319,   323,
-     329,   333,   334,   338,   344,   354,   360,   364,   365,   367,
-     372,   378,   388,   394,   400,   406,   412,   417,   422,   428,
-     440,   441,   442,   453,   456,   470,   471,   473,   478,   486,
-     492,   500,   503,   513,   520,   524,   528,   536,   548,   549,
-     550,   551,   552,   553,   554,   555,   556,   557,   558,   559,
-     560,   561,   562,   563,   564,   565,   566,   570,   571,   575,
-     576,   577,   578,   579,   580,   581,   585,   586,   587,   591,
-     592,   593,   597,   598,   599,   600,   601,   605,   611,   620,
-     629,   630,   643,   648,   656,   657,   658,   659,   661,   663,
-     665,   672,   678
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "BOOL", "INT", "FLOAT32", "RUNE",
-  "STRING", "STRUCT", "FUNC", "MAP", "TYPE", "VAR", "SHORT_VAR_DECL", "IF",
-  "ELSE", "SWITCH", "CASE", "DEFAULT", "RETURN", "BREAK", "CONTINUE",
-  "FOR", "INC", "DEC", "ELLIPSIS", "OR", "AND", "EQ", "NEQ", "LTE", "GTE",
-  "SHIFT_LEFT", "SHIFT_RIGHT", "IDENTIFIER", "INT_LITERAL",
-  "FLOAT_LITERAL", "BOOL_LITERAL", "RUNE_LITERAL", "STRING_LITERAL", "'<'",
-  "'>'", "'+'", "'-'", "'|'", "'^'", "'*'", "'/'", "'%'", "'&'", "'('",
-  "')'", "'['", "']'", "'{'", "'}'", "','", "';'", "'='", "':'", "'!'",
-  "'.'", "$accept", "start", "type", "literal_type", "array_length",
-  "function_signature", "function_result", "function_parameters",
-  "function_parameter_list", "struct_field_decls", "block",
-  "top_level_declaration", "top_level_declaration_list",
-  "function_declaration", "declaration", "type_decl", "type_spec",
-  "type_spec_list", "var_decl", "var_spec", "var_spec_list", "statement",
-  "simple_statement", "statement_list", "if_statement", "switch_statement",
-  "switch_clause", "switch_clause_list", "return_statement",
-  "for_statement", "for_condition_statement", "expression",
-  "optional_expression", "unary_expression", "operand", "literal",
-  "basic_literal", "expression_list", "composite_literal", "element_list",
-  "keyed_element", "primary_expression", "identifier_list", YY_NULL
+  "\"end of file\"", "error", "\"invalid token\"", "BOOL", "INT",
+  "FLOAT32", "RUNE", "STRING", "STRUCT", "FUNC", "MAP", "TYPE", "VAR",
+  "SHORT_VAR_DECL", "IF", "ELSE", "SWITCH", "CASE", "DEFAULT", "RETURN",
+  "BREAK", "CONTINUE", "FOR", "INC", "DEC", "ELLIPSIS", "OR", "AND", "EQ",
+  "NEQ", "LTE", "GTE", "SHIFT_LEFT", "SHIFT_RIGHT", "BODY", "IDENTIFIER",
+  "INT_LITERAL", "FLOAT_LITERAL", "BOOL_LITERAL", "RUNE_LITERAL",
+  "STRING_LITERAL", "'<'", "'>'", "'+'", "'-'", "'|'", "'^'", "'*'", "'/'",
+  "'%'", "'&'", "'('", "')'", "'['", "']'", "'{'", "'}'", "','", "';'",
+  "'='", "':'", "'!'", "'.'", "$accept", "start", "type", "literal_type",
+  "composite_type", "array_length", "function_signature",
+  "function_result", "function_parameters", "function_parameter_list",
+  "struct_field_decls", "block", "body", "top_level_declaration",
+  "top_level_declaration_list", "function_declaration", "declaration",
+  "type_decl", "type_spec", "type_spec_list", "var_decl", "var_spec",
+  "var_spec_list", "statement", "simple_statement", "statement_list",
+  "if_statement", "switch_statement", "switch_clause",
+  "switch_clause_list", "return_statement", "for_statement",
+  "for_condition_statement", "expression", "optional_expression",
+  "unary_expression", "operand", "literal", "basic_literal",
+  "expression_list", "composite_literal", "element_list", "keyed_element",
+  "primary_expression", "identifier_list", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-      60,    62,    43,    45,   124,    94,    42,    47,    37,    38,
-      40,    41,    91,    93,   123,   125,    44,    59,    61,    58,
-      33,    46
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    62,    63,    64,    64,    64,    64,    64,    64,    64,
-      64,    64,    65,    65,    65,    65,    65,    66,    67,    68,
-      68,    68,    69,    69,    69,    70,    70,    70,    70,    71,
-      71,    72,    73,    73,    74,    74,    75,    76,    76,    77,
-      77,    78,    78,    79,    79,    80,    80,    81,    81,    81,
-      82,    82,    83,    83,    83,    83,    83,    83,    83,    83,
-      84,    84,    84,    85,    85,    86,    86,    86,    87,    88,
-      88,    89,    89,    90,    91,    92,    92,    92,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    94,    94,    95,
-      95,    95,    95,    95,    95,    95,    96,    96,    96,    97,
-      97,    97,    98,    98,    98,    98,    98,    99,    99,   100,
-     101,   101,   102,   102,   103,   103,   103,   103,   103,   103,
-     103,   104,   104
-};
+#define YYPACT_NINF (-170)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-134)
+
+#define yytable_value_is_error(Yyn) \
+  0
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     3,     1,     1,     1,     1,     1,     2,
-       2,     1,     1,     4,     3,     4,     5,     1,     2,     0,
-       1,     1,     2,     3,     4,     1,     2,     3,     4,     3,
-       4,     3,     1,     1,     0,     3,     4,     1,     1,     2,
-       4,     3,     2,     2,     3,     2,     4,     2,     4,     3,
-       2,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     1,     3,     0,     3,     3,     5,     5,     5,     4,
-       3,     0,     2,     2,     1,     7,     3,     2,     1,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     1,     0,     1,
-       2,     2,     2,     2,     2,     2,     1,     1,     3,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     3,     4,
-       1,     3,     3,     1,     1,     3,     4,     6,     8,     3,
-       4,     1,     3
+      60,     2,   -11,    -7,    32,     3,  -170,  -170,  -170,  -170,
+    -170,    -4,   384,    38,  -170,    20,    44,  -170,   582,  -170,
+      60,    11,    31,   678,  -170,  -170,  -170,  -170,  -170,    56,
+      -4,    61,  -170,   774,   774,   -13,   774,  -170,  -170,  -170,
+      55,    64,    44,    66,    70,  1049,    67,  -170,   -27,  -170,
+      82,   -26,   774,   251,  -170,    11,  -170,  -170,  -170,    44,
+    -170,   774,  -170,    88,  -170,   774,    87,  -170,    38,  -170,
+    -170,    44,  -170,    92,    -4,  1049,    89,  -170,  -170,  -170,
+    -170,  -170,  1049,  1049,  1049,  1049,  1049,  1049,  1049,    90,
+     112,  1262,  -170,  -170,  -170,  -170,  -170,  -170,    -8,  1049,
+     870,  -170,    95,    93,  1049,  1049,  1049,  -170,  -170,   371,
+    -170,    94,  -170,   100,  -170,  -170,  -170,  -170,  -170,  1170,
+      98,   -23,   102,   774,    97,  -170,  -170,   774,  -170,  -170,
+    1049,    31,  -170,  -170,  -170,  -170,  -170,  -170,  1352,  -170,
+     419,   469,  1049,  1049,  1049,  1049,  1049,  1049,  1049,  1049,
+    1049,  1049,  1049,  1049,  1049,  1049,  1049,  1049,  1049,  1049,
+    1049,   519,  1049,   113,  -170,  -170,  -170,   870,  1406,  1431,
+    -170,   251,  -170,   103,  1133,   316,  -170,  -170,  -170,   569,
+     617,   665,   713,   761,   809,   857,   905,   953,  1001,  1049,
+    -170,   105,   774,  -170,  1379,  -170,  -170,     5,  -170,  1456,
+     104,   116,  -170,   120,  1480,  1503,   122,   122,   122,   122,
+    -170,  -170,   122,   122,   189,   189,   189,   189,  -170,  -170,
+    -170,  -170,  -170,  -170,   127,  1294,   121,  -170,  -170,   179,
+      91,   139,  1049,  -170,  -170,  1049,  1049,  1049,  1049,  1049,
+    1049,  1049,  1049,  1049,  1049,  -170,    44,  -170,  -170,  1049,
+    -170,  1097,  -170,  -170,  -170,  1049,    -5,  1049,   138,    91,
+     144,  -170,  1229,  1456,  1456,  1456,  1456,  1456,  1456,  1456,
+    1456,  1456,  1456,  -170,  1456,  -170,  1204,   147,  -170,  -170,
+     145,   316,  -170,  -170,  1049,  1049,  -170,   316,  -170,   174,
+    1323,  -170,  -170,  -170
 };
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-      34,     0,     0,     0,     0,     0,     2,    33,    32,    37,
-      38,     0,     0,     0,    39,   131,     0,    45,     0,     1,
-      34,     0,     0,    19,     4,     5,     6,     7,     8,     0,
-       0,     0,    12,     0,     0,     0,     0,    42,    11,     0,
-       0,     0,     0,     0,     0,    47,    35,   131,    22,    25,
-       0,     0,    60,    36,     0,    21,    18,    20,     0,    10,
-       0,     9,     0,    17,     0,     0,    41,    43,    40,   132,
-      50,    46,     0,   107,   113,   114,   112,   115,   116,     0,
-       0,     0,     0,     0,     0,     0,     0,   117,    78,   124,
-     106,   109,    49,   110,    99,     0,     0,    23,     0,    26,
-       0,     0,     0,    56,    57,    60,    59,     0,    52,     0,
-      53,    54,    55,    58,    74,    61,     0,     0,     0,     0,
-       0,     3,    14,     0,    44,    51,     0,   100,   101,   103,
-     104,   105,     0,   102,     0,     0,     0,     0,     0,     0,
+      36,     0,     0,     0,     0,     0,     2,    35,    34,    39,
+      40,     0,     0,     0,    41,   151,     0,    47,     0,     1,
+      36,     0,     0,    20,     4,     5,     6,     7,     8,     0,
+       0,     0,    12,     0,     0,     0,     0,    44,    11,    13,
+       0,     0,     0,     0,     0,     0,    49,    37,   151,    23,
+      26,     0,     0,    62,    38,     0,    22,    19,    21,     0,
+      10,     0,     9,     0,    18,     0,     0,    43,    45,    42,
+     152,    52,    48,     0,     0,     0,   123,   129,   130,   128,
+     131,   132,     0,     0,     0,     0,     0,     0,     0,     0,
+      13,   133,    93,   143,   122,   125,    51,   126,   114,     0,
+       0,    24,     0,    27,     0,     0,    88,    58,    59,    62,
+      61,     0,    54,     0,    55,    56,    57,    60,    89,    63,
+       0,     0,     0,     0,     0,     3,    15,     0,    46,    53,
+       0,     0,   121,   115,   116,   118,   119,   120,     0,   117,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    98,     0,    48,    27,    24,
-       0,     0,     0,    73,    77,     0,    61,    63,    31,     0,
-      15,     0,     0,    13,   111,   108,   107,   123,     0,   120,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,    94,    95,    96,    93,   118,   129,
-       0,    97,     0,   125,    28,    65,    71,     0,    76,    64,
-      62,    29,    16,     0,   119,     0,   130,   126,    98,     0,
-       0,     0,    71,     0,     0,    30,   122,   121,    97,     0,
-      67,    66,     0,    63,    72,    68,    60,     0,   127,    63,
-      70,     0,     0,    69,    75,   128
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     4,    49,    86,    65,    22,    56,    23,    50,   118,
-      53,     5,     6,     7,   106,     9,    39,    40,    10,    42,
-      43,   107,   108,   109,   110,   111,   222,   223,   112,   113,
-     114,    87,   202,    88,    89,    90,    91,   116,    93,   178,
-     179,    94,    51
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   113,     0,    50,    28,    25,     0,     0,     0,
+      87,    62,    92,     0,    63,    77,    32,    65,    66,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      16,     0,     0,    14,     0,   127,   124,   123,   136,   142,
+       0,   139,   138,     0,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   109,   110,
+     111,   108,   134,   148,     0,   112,     0,   144,    29,    79,
+      85,     0,     0,    91,    78,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    64,    30,    17,   150,     0,
+     135,     0,   137,   149,   145,   113,     0,     0,     0,    85,
+       0,    33,     0,    75,    76,    67,    68,    69,    70,    72,
+      73,    74,    71,    31,   141,   140,   112,     0,    81,    80,
+       0,    77,    86,    82,    62,     0,   146,    77,    84,     0,
+       0,    83,    90,   147
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -162
-static const yytype_int16 yypact[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
 {
-      94,   -23,   -20,   -19,    21,   -45,  -162,  -162,  -162,  -162,
-    -162,   -14,   186,     9,  -162,     2,    32,  -162,   195,  -162,
-      94,   322,    16,   469,  -162,  -162,  -162,  -162,  -162,    19,
-     -14,    28,  -162,   477,   477,   -25,   477,  -162,  -162,    24,
-      31,    32,    52,    63,   411,    57,  -162,     1,  -162,    54,
-       5,   477,   247,  -162,   322,  -162,  -162,  -162,    32,  -162,
-     477,  -162,    67,  -162,   477,    66,  -162,     9,  -162,  -162,
-      32,  -162,   -14,    68,  -162,  -162,  -162,  -162,  -162,   411,
-     411,   411,   411,   411,   411,   411,    71,   654,  -162,  -162,
-    -162,  -162,  -162,  -162,   -15,   411,   527,  -162,    69,    65,
-     411,   411,   411,  -162,  -162,   345,  -162,    72,  -162,    73,
-    -162,  -162,  -162,  -162,  -162,   589,    74,    12,    76,   477,
-      80,  -162,  -162,   477,  -162,  -162,    16,  -162,  -162,  -162,
-    -162,  -162,   799,  -162,   456,   411,   411,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-     411,   411,   411,   411,   392,   411,   102,  -162,  -162,  -162,
-     527,   685,   714,  -162,  -162,    81,   556,   300,  -162,   411,
-    -162,    83,   477,  -162,  -162,  -162,    20,   825,    82,    86,
-     848,   870,   179,   179,   179,   179,  -162,  -162,   179,   179,
-      -7,    -7,    -7,    -7,  -162,  -162,  -162,  -162,  -162,  -162,
-      92,   743,    87,  -162,  -162,   130,    59,   411,  -162,  -162,
-    -162,    32,  -162,   411,  -162,   456,  -162,  -162,   411,    -6,
-     411,    88,    59,    93,   622,  -162,   825,  -162,   522,    96,
-    -162,  -162,    98,   300,  -162,  -162,   411,   411,  -162,   300,
-    -162,    16,   771,  -162,  -162,  -162
+    -170,  -170,   192,    15,   141,  -170,   -19,  -170,   186,   -92,
+     -35,  -119,  -164,  -170,   193,  -170,    22,  -170,   210,   146,
+    -170,   213,   148,  -170,  -106,  -169,   -38,  -170,  -170,   -39,
+    -170,  -170,  -170,   -52,   -32,    -1,  -170,  -170,  -170,   -40,
+    -170,  -134,  -170,  -170,    -3
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
 {
-    -162,  -162,    90,    11,  -162,   -21,  -162,   128,   -91,   -59,
-    -102,  -162,   133,  -162,     7,  -162,   153,    91,  -162,   156,
-      95,  -162,  -101,  -161,   -58,  -162,  -162,   -62,  -162,  -162,
-    -162,   -51,   -55,   -63,  -162,  -162,  -162,   -42,  -162,   -49,
-    -162,  -162,    -3
+       0,     4,    50,    89,    90,    66,    22,    57,    23,    51,
+     122,    54,   172,     5,     6,     7,   110,     9,    40,    41,
+      10,    43,    44,   111,   112,   113,   114,   115,   259,   260,
+     116,   117,   118,    91,   226,    92,    93,    94,    95,   120,
+      97,   200,   201,    98,    52
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -118
 static const yytype_int16 yytable[] =
 {
-      18,   115,    92,   164,   165,   158,   209,     8,   100,    59,
-      63,    11,    20,    18,    12,    15,   127,   128,   129,   130,
-     131,    19,   133,    38,   174,   141,   142,     8,    64,    38,
-      13,    16,    38,   132,    38,   154,    21,   155,    69,   149,
-     150,   151,   152,    12,    38,    38,   156,    38,    52,   161,
-     162,   126,   -12,   157,   166,   119,    97,    41,    41,   205,
-     163,    98,    38,   121,   208,    38,    15,    18,    96,   204,
-      52,    38,   240,    58,   -12,    38,   220,   221,   243,   213,
-      60,    67,    68,   177,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
-     196,   197,    37,     1,   201,     2,     3,    38,    45,    70,
-      96,   198,   200,    55,    71,    95,   115,   230,   121,   123,
-     159,   160,   -12,    61,    62,   134,    66,   210,   168,   167,
-      38,   170,   169,   172,    38,   241,   203,   214,   207,   244,
-     211,    99,   215,   216,   117,   219,   218,   233,   235,   238,
-     120,    57,   225,    46,   122,    14,   224,   239,   124,    17,
-     234,   231,   226,   229,   177,   125,   227,   228,     0,     0,
-       0,    38,     0,     0,     0,     0,     0,     0,   232,     0,
-       0,     0,   115,    38,     0,   115,   242,     0,   115,    24,
-      25,    26,    27,    28,    29,    30,    31,     0,    24,    25,
-      26,    27,    28,    29,    30,    31,     0,     0,   119,   171,
-       0,   141,   142,   173,     0,     0,     0,     0,     0,     0,
-      32,   145,   146,   147,   148,   149,   150,   151,   152,    32,
-       0,     0,    33,     0,     0,     0,    34,     0,    35,     0,
-       0,    33,     0,     0,    36,    34,     0,    35,     0,     0,
-       0,     0,     0,    44,     0,    29,    72,    31,     2,     3,
-       0,   100,   212,   101,     0,     0,   102,   103,   104,   105,
+      18,   119,   231,   173,   229,    96,   234,   203,   165,   104,
+     233,    60,   195,    18,    24,    25,    26,    27,    28,    29,
+      30,    31,     8,    64,    12,   -12,   101,    38,    15,   125,
+      42,   102,    19,    38,   100,   138,    38,    11,    38,    70,
+      13,    65,     8,   161,    16,   162,    48,    21,    38,    38,
+      53,    38,   168,   169,   163,   131,   123,   174,    33,   164,
+     -12,    20,    34,    49,    35,   249,   170,    38,    18,     1,
+      38,     2,     3,    12,   132,   228,    38,    42,   194,    15,
+      38,   133,   134,   135,   136,   137,    53,   139,   199,   199,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   257,   258,
+     225,    59,   288,    68,    61,    38,    69,   275,   291,   119,
+     222,   224,    72,   119,    71,   292,    99,   210,   211,   214,
+     215,   216,   217,   218,   219,   220,   221,   278,    38,   100,
+     125,   127,    38,   130,   -12,   140,   141,   166,   227,   245,
+     167,   192,   175,    39,   148,   149,   176,   189,   190,    39,
+     250,   232,    39,   246,    39,   152,   153,   154,   155,   156,
+     157,   158,   159,   251,    39,    39,   252,    39,   289,   253,
+     262,   255,    38,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   272,    39,   256,   261,    39,   274,   281,   199,
+     283,   286,    39,   276,    37,   287,    39,    38,   171,    58,
+      46,   273,    14,    47,   128,    56,    17,   280,   279,   129,
+     282,   148,   149,   277,     0,    62,    63,     0,    67,   119,
+       0,     0,   119,   290,     0,   119,   156,   157,   158,   159,
+       0,    39,     0,   123,   103,     0,     0,   121,     0,     0,
+       0,     0,     0,   124,     0,    73,     0,   126,     0,    29,
+      74,    31,     2,     3,    39,   104,     0,   105,    39,     0,
+     106,   107,   108,   109,     0,     0,     0,     0,    75,     0,
+       0,     0,     0,     0,     0,     0,    76,    77,    78,    79,
+      80,    81,     0,     0,    82,    83,     0,    84,    85,     0,
+       0,    86,    87,     0,    35,     0,     0,   -77,    39,     0,
+       0,     0,    88,     0,     0,   191,     0,     0,     0,   193,
+      73,     0,     0,     0,    29,    74,    31,     2,     3,     0,
+     104,     0,   105,    39,     0,   106,   107,   108,   109,     0,
+       0,     0,     0,    75,     0,     0,     0,     0,     0,     0,
+       0,    76,    77,    78,    79,    80,    81,     0,     0,    82,
+      83,     0,    84,    85,     0,     0,    86,    87,     0,    35,
+       0,     0,     0,     0,   -62,    73,     0,    88,     0,    29,
+      74,    31,     0,     0,   247,     0,     0,    24,    25,    26,
+      27,    28,    29,    30,    31,     0,     0,     0,    75,     0,
+       0,     0,     0,     0,     0,   171,    76,    77,    78,    79,
+      80,    81,     0,     0,    82,    83,     0,    84,    85,    32,
+       0,    86,    87,    73,    35,     0,     0,    29,    74,    31,
+       0,    33,    88,     0,     0,    34,     0,    35,     0,     0,
+       0,     0,     0,    36,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,   197,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,     0,     0,    86,
+      87,     0,    35,    73,     0,   198,     0,    29,    74,    31,
+      88,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,   197,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,     0,     0,    86,
+      87,     0,    35,    73,     0,   202,     0,    29,    74,    31,
+      88,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,     0,     0,    86,
+      87,   223,    35,    73,     0,     0,     0,    29,    74,    31,
+      88,     0,     0,     0,     0,    24,    25,    26,    27,    28,
+      29,    30,    31,     0,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,    32,     0,    86,
+      87,    73,    35,     0,     0,    29,    74,    31,   235,    33,
+      88,     0,     0,    34,     0,    35,     0,     0,     0,     0,
+       0,    45,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,    76,    77,    78,    79,    80,    81,     0,     0,
+      82,    83,     0,    84,    85,     0,     0,    86,    87,    73,
+      35,     0,     0,    29,    74,    31,   236,     0,    88,     0,
+       0,    24,    25,    26,    27,    28,    29,    30,    31,     0,
+       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
+      76,    77,    78,    79,    80,    81,     0,     0,    82,    83,
+       0,    84,    85,    32,     0,    86,    87,    73,    35,     0,
+       0,    29,    74,    31,   237,    33,    88,     0,     0,    55,
+       0,    35,     0,     0,     0,     0,     0,     0,     0,     0,
+      75,     0,     0,     0,     0,     0,     0,     0,    76,    77,
+      78,    79,    80,    81,     0,     0,    82,    83,     0,    84,
+      85,     0,     0,    86,    87,    73,    35,     0,     0,    29,
+      74,    31,   238,     0,    88,     0,     0,    24,    25,    26,
+      27,    28,    29,    30,    31,     0,     0,     0,    75,     0,
+       0,     0,     0,     0,     0,     0,    76,    77,    78,    79,
+      80,    81,     0,     0,    82,    83,     0,    84,    85,    32,
+       0,    86,    87,    73,    35,     0,     0,    29,    74,    31,
+     239,    33,    88,     0,     0,    34,     0,    35,     0,     0,
+       0,     0,     0,     0,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,     0,     0,    86,
+      87,    73,    35,     0,     0,    29,    74,    31,   240,     0,
+      88,     0,     0,    24,    25,    26,    27,    28,    29,    30,
+      31,     0,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,    76,    77,    78,    79,    80,    81,     0,     0,
+      82,    83,     0,    84,    85,    48,     0,    86,    87,    73,
+      35,     0,     0,    29,    74,    31,   241,    33,    88,     0,
+       0,    34,     0,    35,     0,     0,     0,     0,     0,     0,
+       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
+      76,    77,    78,    79,    80,    81,     0,     0,    82,    83,
+       0,    84,    85,     0,     0,    86,    87,    73,    35,     0,
+       0,    29,    74,    31,   242,     0,    88,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    73,    74,    75,    76,    77,    78,     0,     0,    79,
-      80,     0,    81,    82,     0,     0,    83,    84,     0,    35,
-       0,     0,   -63,     0,     0,     0,     0,    85,    29,    72,
-      31,     2,     3,     0,   100,     0,   101,     0,     0,   102,
-     103,   104,   105,     0,     0,    24,    25,    26,    27,    28,
-      29,    30,    31,     0,    73,    74,    75,    76,    77,    78,
-       0,     0,    79,    80,     0,    81,    82,     0,     0,    83,
-      84,     0,    35,    29,    72,    31,    47,   -60,     0,     0,
-      85,     0,     0,     0,     0,     0,     0,     0,    33,     0,
-       0,     0,    34,    48,    35,     0,     0,     0,     0,    73,
-      74,    75,    76,    77,    78,     0,     0,    79,    80,     0,
-      81,    82,     0,     0,    83,    84,     0,    35,     0,    52,
-      29,    72,    31,     0,     0,    85,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    29,
-      72,    31,     0,     0,     0,     0,    73,    74,    75,    76,
-      77,    78,     0,     0,    79,    80,     0,    81,    82,     0,
-       0,    83,    84,   199,    35,    73,    74,    75,    76,    77,
-      78,     0,    85,    79,    80,     0,    81,    82,     0,     0,
-      83,    84,     0,    35,    29,    72,    31,     0,     0,     0,
-       0,    85,    24,    25,    26,    27,    28,    29,    30,    31,
-      24,    25,    26,    27,    28,    29,    30,    31,     0,     0,
-     176,    74,    75,    76,    77,    78,     0,     0,    79,    80,
-       0,    81,    82,    32,     0,    83,    84,     0,    35,     0,
-       0,    32,     0,     0,     0,    33,    85,     0,     0,    54,
-       0,    35,     0,    33,     0,     0,     0,    34,     0,    35,
-      24,    25,    26,    27,    28,    29,    30,    31,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
-     137,   138,   139,   140,   141,   142,     0,     0,     0,     0,
-       0,    47,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,     0,    33,     0,     0,     0,    34,     0,    35,
-       0,   237,   135,   136,   137,   138,   139,   140,   141,   142,
-       0,     0,     0,     0,     0,     0,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,     0,     0,     0,     0,
-      52,     0,   153,     0,  -117,   135,   136,   137,   138,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,     0,
-       0,     0,     0,     0,     0,   153,     0,  -117,   135,   136,
-     137,   138,   139,   140,   141,   142,     0,     0,     0,     0,
-       0,     0,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,     0,     0,     0,     0,     0,     0,     0,   236,
-     135,   136,   137,   138,   139,   140,   141,   142,     0,     0,
-       0,     0,     0,     0,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,     0,     0,     0,     0,     0,     0,
-     153,   135,   136,   137,   138,   139,   140,   141,   142,     0,
-       0,     0,     0,     0,     0,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,     0,     0,     0,     0,    52,
-     135,   136,   137,   138,   139,   140,   141,   142,     0,     0,
-       0,     0,     0,     0,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,     0,     0,     0,     0,   206,   135,
-     136,   137,   138,   139,   140,   141,   142,     0,     0,     0,
-       0,     0,     0,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,   152,     0,     0,     0,   217,   135,   136,   137,
-     138,   139,   140,   141,   142,     0,     0,     0,     0,     0,
-       0,   143,   144,   145,   146,   147,   148,   149,   150,   151,
-     152,     0,     0,     0,   245,   135,   136,   137,   138,   139,
-     140,   141,   142,     0,     0,     0,     0,     0,     0,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,     0,
-     175,   135,   136,   137,   138,   139,   140,   141,   142,     0,
-       0,     0,     0,     0,     0,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   136,   137,   138,   139,   140,
-     141,   142,     0,     0,     0,     0,     0,     0,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   137,   138,
-     139,   140,   141,   142,     0,     0,     0,     0,     0,     0,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   152
+      75,     0,     0,     0,     0,     0,     0,     0,    76,    77,
+      78,    79,    80,    81,     0,     0,    82,    83,     0,    84,
+      85,     0,     0,    86,    87,    73,    35,     0,     0,    29,
+      74,    31,   243,     0,    88,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    75,     0,
+       0,     0,     0,     0,     0,     0,    76,    77,    78,    79,
+      80,    81,     0,     0,    82,    83,     0,    84,    85,     0,
+       0,    86,    87,    73,    35,     0,     0,    29,    74,    31,
+     244,     0,    88,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,     0,    84,    85,     0,     0,    86,
+      87,    73,    35,     0,     0,    29,    74,    31,     0,     0,
+      88,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    75,     0,     0,     0,     0,     0,
+       0,     0,   197,    77,    78,    79,    80,    81,     0,     0,
+      82,    83,     0,    84,    85,     0,     0,    86,    87,     0,
+      35,     0,     0,     0,     0,     0,   177,   178,    88,   142,
+     143,   144,   145,   146,   147,   179,   180,   171,     0,     0,
+       0,     0,     0,     0,   150,   151,   181,   182,   183,   184,
+     185,   186,   187,   188,     0,     0,     0,     0,     0,     0,
+     160,     0,  -133,   177,   178,     0,   142,   143,   144,   145,
+     146,   147,   179,   180,     0,     0,     0,     0,     0,     0,
+       0,   150,   151,   181,   182,   183,   184,   185,   186,   187,
+     188,     0,     0,     0,     0,     0,     0,   160,     0,  -133,
+     142,   143,   144,   145,   146,   147,   148,   149,     0,     0,
+       0,     0,     0,     0,     0,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   142,   143,   144,   145,   146,
+     147,   148,   149,     0,   285,     0,     0,     0,     0,     0,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+       0,     0,     0,     0,     0,     0,     0,   284,   142,   143,
+     144,   145,   146,   147,   148,   149,     0,     0,     0,     0,
+       0,     0,     0,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,     0,     0,     0,     0,     0,     0,   160,
+     142,   143,   144,   145,   146,   147,   148,   149,     0,     0,
+       0,     0,     0,     0,     0,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,     0,     0,     0,   254,   142,
+     143,   144,   145,   146,   147,   148,   149,     0,     0,     0,
+       0,     0,     0,     0,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,     0,     0,     0,   293,   142,   143,
+     144,   145,   146,   147,   148,   149,     0,     0,     0,     0,
+       0,     0,     0,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,     0,   196,   142,   143,   144,   145,   146,
+     147,   148,   149,     0,     0,     0,     0,     0,     0,     0,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+       0,   248,   142,   143,   144,   145,   146,   147,   148,   149,
+     171,     0,     0,     0,     0,     0,     0,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   142,   143,   144,
+     145,   146,   147,   148,   149,   230,     0,     0,     0,     0,
+       0,     0,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   142,   143,   144,   145,   146,   147,   148,   149,
+       0,     0,     0,     0,     0,     0,     0,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   143,   144,   145,
+     146,   147,   148,   149,     0,     0,     0,     0,     0,     0,
+       0,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   144,   145,   146,   147,   148,   149,     0,     0,     0,
+       0,     0,     0,     0,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159
 };
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-162)))
-
-#define yytable_value_is_error(Yytable_value) \
-  YYID (0)
-
 static const yytype_int16 yycheck[] =
 {
-       3,    52,    44,   105,   105,    96,   167,     0,    14,    30,
-      35,    34,    57,    16,    34,    34,    79,    80,    81,    82,
-      83,     0,    85,    12,   126,    32,    33,    20,    53,    18,
-      50,    50,    21,    84,    23,    50,    50,    52,    41,    46,
-      47,    48,    49,    34,    33,    34,    61,    36,    54,   100,
-     101,    72,    51,    95,   105,    58,    51,    56,    56,   161,
-     102,    56,    51,    51,   166,    54,    34,    70,    56,   160,
-      54,    60,   233,    54,    54,    64,    17,    18,   239,    59,
-      52,    57,    51,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,    12,     9,   155,    11,    12,    96,    18,    57,
-      56,   153,   154,    23,    51,    58,   167,   219,    51,    53,
-      51,    56,    54,    33,    34,    54,    36,   169,    55,    57,
-     119,    55,    58,    53,   123,   236,    34,    55,    57,   241,
-      57,    51,    56,    51,    54,    15,    59,    59,    55,    53,
-      60,    23,   211,    20,    64,     2,   207,    59,    67,     3,
-     222,   219,   213,   218,   215,    70,   215,   218,    -1,    -1,
-      -1,   160,    -1,    -1,    -1,    -1,    -1,    -1,   220,    -1,
-      -1,    -1,   233,   172,    -1,   236,   237,    -1,   239,     3,
-       4,     5,     6,     7,     8,     9,    10,    -1,     3,     4,
-       5,     6,     7,     8,     9,    10,    -1,    -1,   211,   119,
-      -1,    32,    33,   123,    -1,    -1,    -1,    -1,    -1,    -1,
-      34,    42,    43,    44,    45,    46,    47,    48,    49,    34,
-      -1,    -1,    46,    -1,    -1,    -1,    50,    -1,    52,    -1,
-      -1,    46,    -1,    -1,    58,    50,    -1,    52,    -1,    -1,
-      -1,    -1,    -1,    58,    -1,     8,     9,    10,    11,    12,
-      -1,    14,   172,    16,    -1,    -1,    19,    20,    21,    22,
+       3,    53,   171,   109,   168,    45,   175,   141,   100,    14,
+     174,    30,   131,    16,     3,     4,     5,     6,     7,     8,
+       9,    10,     0,    36,    35,    52,    52,    12,    35,    52,
+      57,    57,     0,    18,    57,    87,    21,    35,    23,    42,
+      51,    54,    20,    51,    51,    53,    35,    51,    33,    34,
+      55,    36,   104,   105,    62,    74,    59,   109,    47,    99,
+      55,    58,    51,    52,    53,    60,   106,    52,    71,     9,
+      55,    11,    12,    35,    75,   167,    61,    57,   130,    35,
+      65,    82,    83,    84,    85,    86,    55,    88,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,    17,    18,
+     162,    55,   281,    58,    53,   100,    52,   251,   287,   171,
+     160,   161,    52,   175,    58,   289,    59,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   256,   123,    57,
+      52,    54,   127,    51,    55,    55,    34,    52,    35,   189,
+      57,    54,    58,    12,    32,    33,    56,    59,    56,    18,
+      56,    58,    21,    58,    23,    43,    44,    45,    46,    47,
+      48,    49,    50,    57,    33,    34,    56,    36,   284,    52,
+     232,    60,   167,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,    52,    15,    56,    55,   249,    60,   251,
+      56,    54,    61,   255,    12,    60,    65,   192,    34,    23,
+      18,   246,     2,    20,    68,    23,     3,   257,   256,    71,
+     259,    32,    33,   255,    -1,    33,    34,    -1,    36,   281,
+      -1,    -1,   284,   285,    -1,   287,    47,    48,    49,    50,
+      -1,   100,    -1,   246,    52,    -1,    -1,    55,    -1,    -1,
+      -1,    -1,    -1,    61,    -1,     4,    -1,    65,    -1,     8,
+       9,    10,    11,    12,   123,    14,    -1,    16,   127,    -1,
+      19,    20,    21,    22,    -1,    -1,    -1,    -1,    27,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    37,    38,
+      39,    40,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      -1,    50,    51,    -1,    53,    -1,    -1,    56,   167,    -1,
+      -1,    -1,    61,    -1,    -1,   123,    -1,    -1,    -1,   127,
+       4,    -1,    -1,    -1,     8,     9,    10,    11,    12,    -1,
+      14,    -1,    16,   192,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    35,    36,    37,    38,    39,    40,    -1,    -1,    43,
+      44,    -1,    46,    47,    -1,    -1,    50,    51,    -1,    53,
+      -1,    -1,    -1,    -1,    58,     4,    -1,    61,    -1,     8,
+       9,    10,    -1,    -1,   192,    -1,    -1,     3,     4,     5,
+       6,     7,     8,     9,    10,    -1,    -1,    -1,    27,    -1,
+      -1,    -1,    -1,    -1,    -1,    34,    35,    36,    37,    38,
+      39,    40,    -1,    -1,    43,    44,    -1,    46,    47,    35,
+      -1,    50,    51,     4,    53,    -1,    -1,     8,     9,    10,
+      -1,    47,    61,    -1,    -1,    51,    -1,    53,    -1,    -1,
+      -1,    -1,    -1,    59,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    -1,    50,
+      51,    -1,    53,     4,    -1,    56,    -1,     8,     9,    10,
+      61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    -1,    50,
+      51,    -1,    53,     4,    -1,    56,    -1,     8,     9,    10,
+      61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    -1,    50,
+      51,    52,    53,     4,    -1,    -1,    -1,     8,     9,    10,
+      61,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    35,    -1,    50,
+      51,     4,    53,    -1,    -1,     8,     9,    10,    59,    47,
+      61,    -1,    -1,    51,    -1,    53,    -1,    -1,    -1,    -1,
+      -1,    59,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    35,    36,    37,    38,    39,    40,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    -1,    50,    51,     4,
+      53,    -1,    -1,     8,     9,    10,    59,    -1,    61,    -1,
+      -1,     3,     4,     5,     6,     7,     8,     9,    10,    -1,
+      -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      35,    36,    37,    38,    39,    40,    -1,    -1,    43,    44,
+      -1,    46,    47,    35,    -1,    50,    51,     4,    53,    -1,
+      -1,     8,     9,    10,    59,    47,    61,    -1,    -1,    51,
+      -1,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,
+      37,    38,    39,    40,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    -1,    50,    51,     4,    53,    -1,    -1,     8,
+       9,    10,    59,    -1,    61,    -1,    -1,     3,     4,     5,
+       6,     7,     8,     9,    10,    -1,    -1,    -1,    27,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    37,    38,
+      39,    40,    -1,    -1,    43,    44,    -1,    46,    47,    35,
+      -1,    50,    51,     4,    53,    -1,    -1,     8,     9,    10,
+      59,    47,    61,    -1,    -1,    51,    -1,    53,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    -1,    50,
+      51,     4,    53,    -1,    -1,     8,     9,    10,    59,    -1,
+      61,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    35,    36,    37,    38,    39,    40,    -1,    -1,
+      43,    44,    -1,    46,    47,    35,    -1,    50,    51,     4,
+      53,    -1,    -1,     8,     9,    10,    59,    47,    61,    -1,
+      -1,    51,    -1,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      35,    36,    37,    38,    39,    40,    -1,    -1,    43,    44,
+      -1,    46,    47,    -1,    -1,    50,    51,     4,    53,    -1,
+      -1,     8,     9,    10,    59,    -1,    61,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
-      43,    -1,    45,    46,    -1,    -1,    49,    50,    -1,    52,
-      -1,    -1,    55,    -1,    -1,    -1,    -1,    60,     8,     9,
-      10,    11,    12,    -1,    14,    -1,    16,    -1,    -1,    19,
-      20,    21,    22,    -1,    -1,     3,     4,     5,     6,     7,
-       8,     9,    10,    -1,    34,    35,    36,    37,    38,    39,
-      -1,    -1,    42,    43,    -1,    45,    46,    -1,    -1,    49,
-      50,    -1,    52,     8,     9,    10,    34,    57,    -1,    -1,
-      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
-      -1,    -1,    50,    51,    52,    -1,    -1,    -1,    -1,    34,
-      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    -1,
-      45,    46,    -1,    -1,    49,    50,    -1,    52,    -1,    54,
-       8,     9,    10,    -1,    -1,    60,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     8,
-       9,    10,    -1,    -1,    -1,    -1,    34,    35,    36,    37,
-      38,    39,    -1,    -1,    42,    43,    -1,    45,    46,    -1,
-      -1,    49,    50,    51,    52,    34,    35,    36,    37,    38,
-      39,    -1,    60,    42,    43,    -1,    45,    46,    -1,    -1,
-      49,    50,    -1,    52,     8,     9,    10,    -1,    -1,    -1,
-      -1,    60,     3,     4,     5,     6,     7,     8,     9,    10,
-       3,     4,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
-      -1,    45,    46,    34,    -1,    49,    50,    -1,    52,    -1,
-      -1,    34,    -1,    -1,    -1,    46,    60,    -1,    -1,    50,
-      -1,    52,    -1,    46,    -1,    -1,    -1,    50,    -1,    52,
-       3,     4,     5,     6,     7,     8,     9,    10,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    27,
-      28,    29,    30,    31,    32,    33,    -1,    -1,    -1,    -1,
-      -1,    34,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    -1,    46,    -1,    -1,    -1,    50,    -1,    52,
-      -1,    59,    26,    27,    28,    29,    30,    31,    32,    33,
-      -1,    -1,    -1,    -1,    -1,    -1,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    -1,    -1,    -1,    -1,
-      54,    -1,    56,    -1,    58,    26,    27,    28,    29,    30,
-      31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
-      -1,    -1,    -1,    -1,    -1,    56,    -1,    58,    26,    27,
-      28,    29,    30,    31,    32,    33,    -1,    -1,    -1,    -1,
-      -1,    -1,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    57,
+      27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,
+      37,    38,    39,    40,    -1,    -1,    43,    44,    -1,    46,
+      47,    -1,    -1,    50,    51,     4,    53,    -1,    -1,     8,
+       9,    10,    59,    -1,    61,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    37,    38,
+      39,    40,    -1,    -1,    43,    44,    -1,    46,    47,    -1,
+      -1,    50,    51,     4,    53,    -1,    -1,     8,     9,    10,
+      59,    -1,    61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,    36,    37,    38,    39,    40,
+      -1,    -1,    43,    44,    -1,    46,    47,    -1,    -1,    50,
+      51,     4,    53,    -1,    -1,     8,     9,    10,    -1,    -1,
+      61,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    35,    36,    37,    38,    39,    40,    -1,    -1,
+      43,    44,    -1,    46,    47,    -1,    -1,    50,    51,    -1,
+      53,    -1,    -1,    -1,    -1,    -1,    23,    24,    61,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    -1,    -1,    -1,    -1,    -1,    -1,
+      57,    -1,    59,    23,    24,    -1,    26,    27,    28,    29,
+      30,    31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    -1,    -1,    -1,    -1,    -1,    -1,    57,    -1,    59,
       26,    27,    28,    29,    30,    31,    32,    33,    -1,    -1,
-      -1,    -1,    -1,    -1,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    -1,    -1,    -1,    -1,    -1,    -1,
-      56,    26,    27,    28,    29,    30,    31,    32,    33,    -1,
-      -1,    -1,    -1,    -1,    -1,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    -1,    -1,    -1,    -1,    54,
+      -1,    -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    26,    27,    28,    29,    30,
+      31,    32,    33,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    58,    26,    27,
+      28,    29,    30,    31,    32,    33,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    -1,    -1,    -1,    -1,    -1,    -1,    57,
       26,    27,    28,    29,    30,    31,    32,    33,    -1,    -1,
-      -1,    -1,    -1,    -1,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    -1,    -1,    -1,    -1,    54,    26,
+      -1,    -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    -1,    -1,    -1,    54,    26,
       27,    28,    29,    30,    31,    32,    33,    -1,    -1,    -1,
-      -1,    -1,    -1,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    -1,    -1,    -1,    53,    26,    27,    28,
-      29,    30,    31,    32,    33,    -1,    -1,    -1,    -1,    -1,
-      -1,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    -1,    -1,    -1,    53,    26,    27,    28,    29,    30,
-      31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
-      51,    26,    27,    28,    29,    30,    31,    32,    33,    -1,
-      -1,    -1,    -1,    -1,    -1,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    27,    28,    29,    30,    31,
-      32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    28,    29,
+      -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    -1,    -1,    -1,    54,    26,    27,
+      28,    29,    30,    31,    32,    33,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    -1,    52,    26,    27,    28,    29,    30,
+      31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      -1,    52,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,
+      -1,    -1,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    26,    27,    28,    29,    30,    31,    32,    33,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    27,    28,    29,
       30,    31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49
+      -1,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    28,    29,    30,    31,    32,    33,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
-       0,     9,    11,    12,    63,    73,    74,    75,    76,    77,
-      80,    34,    34,    50,    78,    34,    50,    81,   104,     0,
-      57,    50,    67,    69,     3,     4,     5,     6,     7,     8,
-       9,    10,    34,    46,    50,    52,    58,    64,    65,    78,
-      79,    56,    81,    82,    58,    64,    74,    34,    51,    64,
-      70,   104,    54,    72,    50,    64,    68,    69,    54,    67,
-      52,    64,    64,    35,    53,    66,    64,    57,    51,   104,
-      57,    51,     9,    34,    35,    36,    37,    38,    39,    42,
-      43,    45,    46,    49,    50,    60,    65,    93,    95,    96,
-      97,    98,    99,   100,   103,    58,    56,    51,    56,    64,
-      14,    16,    19,    20,    21,    22,    76,    83,    84,    85,
-      86,    87,    90,    91,    92,    93,    99,    64,    71,   104,
-      64,    51,    64,    53,    79,    82,    67,    95,    95,    95,
-      95,    95,    93,    95,    54,    26,    27,    28,    29,    30,
-      31,    32,    33,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    56,    50,    52,    61,    99,    70,    51,
-      56,    93,    93,    99,    72,    84,    93,    57,    55,    58,
-      55,    64,    53,    64,    72,    51,    34,    93,   101,   102,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    99,    51,
-      99,    93,    94,    34,    70,    72,    54,    57,    72,    85,
-      99,    57,    64,    59,    55,    56,    51,    53,    59,    15,
-      17,    18,    88,    89,    93,    71,    93,   101,    93,    94,
-      72,    86,    99,    59,    89,    55,    57,    59,    53,    59,
-      85,    84,    93,    85,    72,    53
+       0,     9,    11,    12,    64,    76,    77,    78,    79,    80,
+      83,    35,    35,    51,    81,    35,    51,    84,   107,     0,
+      58,    51,    69,    71,     3,     4,     5,     6,     7,     8,
+       9,    10,    35,    47,    51,    53,    59,    65,    66,    67,
+      81,    82,    57,    84,    85,    59,    65,    77,    35,    52,
+      65,    72,   107,    55,    74,    51,    65,    70,    71,    55,
+      69,    53,    65,    65,    36,    54,    68,    65,    58,    52,
+     107,    58,    52,     4,     9,    27,    35,    36,    37,    38,
+      39,    40,    43,    44,    46,    47,    50,    51,    61,    66,
+      67,    96,    98,    99,   100,   101,   102,   103,   106,    59,
+      57,    52,    57,    65,    14,    16,    19,    20,    21,    22,
+      79,    86,    87,    88,    89,    90,    93,    94,    95,    96,
+     102,    65,    73,   107,    65,    52,    65,    54,    82,    85,
+      51,    69,    98,    98,    98,    98,    98,    98,    96,    98,
+      55,    34,    26,    27,    28,    29,    30,    31,    32,    33,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      57,    51,    53,    62,   102,    72,    52,    57,    96,    96,
+     102,    34,    75,    87,    96,    58,    56,    23,    24,    32,
+      33,    43,    44,    45,    46,    47,    48,    49,    50,    59,
+      56,    65,    54,    65,    96,    74,    52,    35,    56,    96,
+     104,   105,    56,   104,    96,    96,    96,    96,    96,    96,
+      96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
+      96,    96,   102,    52,   102,    96,    97,    35,    72,    75,
+      34,    88,    58,    75,    88,    59,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,   102,    58,    65,    52,    60,
+      56,    57,    56,    52,    54,    60,    15,    17,    18,    91,
+      92,    56,    96,    96,    96,    96,    96,    96,    96,    96,
+      96,    96,    96,    73,    96,   104,    96,    97,    74,    89,
+     102,    60,    92,    56,    58,    60,    54,    60,    88,    87,
+      96,    88,    75,    54
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    63,    64,    65,    65,    65,    65,    65,    65,    65,
+      65,    65,    66,    66,    67,    67,    67,    67,    68,    69,
+      70,    70,    70,    71,    71,    71,    72,    72,    72,    72,
+      73,    73,    74,    75,    76,    76,    77,    77,    78,    79,
+      79,    80,    80,    81,    81,    82,    82,    83,    83,    84,
+      84,    84,    85,    85,    86,    86,    86,    86,    86,    86,
+      86,    86,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    88,    88,    89,
+      89,    89,    90,    91,    91,    92,    92,    93,    93,    94,
+      95,    95,    95,    96,    96,    96,    96,    96,    96,    96,
+      96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
+      96,    96,    97,    97,    98,    98,    98,    98,    98,    98,
+      98,    98,    99,    99,    99,   100,   100,   100,   101,   101,
+     101,   101,   101,   102,   102,   103,   103,   103,   103,   104,
+     104,   105,   105,   106,   106,   106,   106,   106,   106,   106,
+     106,   107,   107
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     1,     1,     1,     1,     1,     2,
+       2,     1,     1,     1,     4,     3,     4,     5,     1,     2,
+       0,     1,     1,     2,     3,     4,     1,     2,     3,     4,
+       3,     4,     3,     3,     1,     1,     0,     3,     4,     1,
+       1,     2,     4,     3,     2,     2,     3,     2,     4,     2,
+       4,     3,     2,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     1,     3,     2,     2,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     0,     3,     3,
+       5,     5,     5,     4,     3,     0,     2,     2,     1,     1,
+       7,     3,     2,     1,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     1,     0,     1,     2,     2,     2,     2,     2,
+       2,     2,     1,     1,     3,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     4,     3,     4,     3,     1,
+       3,     3,     1,     1,     3,     4,     6,     8,     3,     4,
+       4,     1,     3
+};
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-/* Error token number */
-#define YYTERROR	1
-#define YYERRCODE	256
 
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1079,7 +1246,7 @@ while (YYID (0))
 #ifndef YYLLOC_DEFAULT
 # define YYLLOC_DEFAULT(Current, Rhs, N)                                \
     do                                                                  \
-      if (YYID (N))                                                     \
+      if (N)                                                            \
         {                                                               \
           (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
           (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
@@ -1093,156 +1260,132 @@ while (YYID (0))
           (Current).first_column = (Current).last_column =              \
             YYRHSLOC (Rhs, 0).last_column;                              \
         }                                                               \
-    while (YYID (0))
+    while (0)
 #endif
 
 #define YYRHSLOC(Rhs, K) ((Rhs)[K])
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
-__attribute__((__unused__))
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static unsigned
+YY_ATTRIBUTE_UNUSED
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
-#else
-static unsigned
-yy_location_print_ (yyo, yylocp)
-    FILE *yyo;
-    YYLTYPE const * const yylocp;
-#endif
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
-      res += fprintf (yyo, "%d", yylocp->first_line);
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
       if (0 <= yylocp->first_column)
-        res += fprintf (yyo, ".%d", yylocp->first_column);
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
     }
   if (0 <= yylocp->last_line)
     {
       if (yylocp->first_line < yylocp->last_line)
         {
-          res += fprintf (yyo, "-%d", yylocp->last_line);
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
           if (0 <= end_col)
-            res += fprintf (yyo, ".%d", end_col);
+            res += YYFPRINTF (yyo, ".%d", end_col);
         }
       else if (0 <= end_col && yylocp->first_column < end_col)
-        res += fprintf (yyo, "-%d", end_col);
+        res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
 
+#  else
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
 
-/* Enable debugging if requested.  */
-#if YYDEBUG
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
-# ifndef YYFPRINTF
-#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYFPRINTF fprintf
-# endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, Location); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
-#else
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    YYLTYPE const * const yylocationp;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
-  YYUSE (yylocationp);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    YYLTYPE const * const yylocationp;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1250,16 +1393,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1270,64 +1405,57 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yylsp, yyrule)
-    YYSTYPE *yyvsp;
-    YYLTYPE *yylsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       , &(yylsp[(yyi + 1) - (yynrhs)])		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, yylsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1343,378 +1471,93 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
 
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULL, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULL;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULL, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep, yylocationp)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    YYLTYPE *yylocationp;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
-
 /* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval YY_INITIAL_VALUE(yyval_default);
-
+YYSTYPE yylval;
 /* Location data for the lookahead symbol.  */
 YYLTYPE yylloc
 # if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
   = { 1, 1, 1, 1 }
 # endif
 ;
-
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
-       `yyls': related to locations.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1722,109 +1565,113 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-	YYLTYPE *yyls1 = yyls;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yyls1, yysize * sizeof (*yylsp),
-		    &yystacksize);
-
-	yyls = yyls1;
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-	YYSTACK_RELOCATE (yyls_alloc, yyls);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1835,18 +1682,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1874,15 +1733,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1897,14 +1755,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1913,1040 +1771,1165 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-/* Line 1802 of yacc.c  */
-#line 152 "src/parsing/parser.y"
-    { tree = new AST::Program{(yyvsp[(1) - (1)].top_level_declarations)->toStdVector()}; }
+  case 2: /* start: top_level_declaration_list  */
+#line 191 "src/parsing/parser.y"
+                                            { tree = new AST::Program{(yyvsp[0].top_level_declarations)->toStdVector()}; }
+#line 1784 "src/parsing/parser.cpp"
     break;
 
-  case 3:
-/* Line 1802 of yacc.c  */
-#line 157 "src/parsing/parser.y"
-    { (yyval.type) = (yyvsp[(2) - (3)].type); }
+  case 3: /* type: '(' type ')'  */
+#line 196 "src/parsing/parser.y"
+                                            { (yyval.type) = (yyvsp[-1].type); }
+#line 1790 "src/parsing/parser.cpp"
     break;
 
-  case 4:
-/* Line 1802 of yacc.c  */
-#line 158 "src/parsing/parser.y"
-    { (yyval.type) = new AST::BoolType{}; }
+  case 4: /* type: BOOL  */
+#line 197 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::BoolType{}; }
+#line 1796 "src/parsing/parser.cpp"
     break;
 
-  case 5:
-/* Line 1802 of yacc.c  */
-#line 159 "src/parsing/parser.y"
-    { (yyval.type) = new AST::IntType{}; }
+  case 5: /* type: INT  */
+#line 198 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::IntType{}; }
+#line 1802 "src/parsing/parser.cpp"
     break;
 
-  case 6:
-/* Line 1802 of yacc.c  */
-#line 160 "src/parsing/parser.y"
-    { (yyval.type) = new AST::Float32Type{}; }
+  case 6: /* type: FLOAT32  */
+#line 199 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::Float32Type{}; }
+#line 1808 "src/parsing/parser.cpp"
     break;
 
-  case 7:
-/* Line 1802 of yacc.c  */
-#line 161 "src/parsing/parser.y"
-    { (yyval.type) = new AST::RuneType{}; }
+  case 7: /* type: RUNE  */
+#line 200 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::RuneType{}; }
+#line 1814 "src/parsing/parser.cpp"
     break;
 
-  case 8:
-/* Line 1802 of yacc.c  */
-#line 162 "src/parsing/parser.y"
-    { (yyval.type) = new AST::StringType{}; }
+  case 8: /* type: STRING  */
+#line 201 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::StringType{}; }
+#line 1820 "src/parsing/parser.cpp"
+    break;
+
+  case 9: /* type: '*' type  */
+#line 202 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::PointerType{(yyvsp[0].type)}; }
+#line 1826 "src/parsing/parser.cpp"
     break;
 
-  case 9:
-/* Line 1802 of yacc.c  */
-#line 163 "src/parsing/parser.y"
-    { (yyval.type) = new AST::PointerType{(yyvsp[(2) - (2)].type)}; }
+  case 10: /* type: FUNC function_signature  */
+#line 203 "src/parsing/parser.y"
+                                            { (yyval.type) = (yyvsp[0].type); }
+#line 1832 "src/parsing/parser.cpp"
     break;
 
-  case 10:
-/* Line 1802 of yacc.c  */
-#line 164 "src/parsing/parser.y"
-    { (yyval.type) = (yyvsp[(2) - (2)].type); }
+  case 11: /* type: literal_type  */
+#line 204 "src/parsing/parser.y"
+                                            { (yyval.type) = (yyvsp[0].type); }
+#line 1838 "src/parsing/parser.cpp"
     break;
 
-  case 11:
-/* Line 1802 of yacc.c  */
-#line 165 "src/parsing/parser.y"
-    { (yyval.type) = (yyvsp[(1) - (1)].type); }
+  case 12: /* literal_type: IDENTIFIER  */
+#line 208 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::CustomType{(yyvsp[0].identifier)}; }
+#line 1844 "src/parsing/parser.cpp"
     break;
 
-  case 12:
-/* Line 1802 of yacc.c  */
-#line 169 "src/parsing/parser.y"
-    { (yyval.type) = new AST::CustomType{(yyvsp[(1) - (1)].identifier)}; delete (yyvsp[(1) - (1)].identifier); }
+  case 13: /* literal_type: composite_type  */
+#line 209 "src/parsing/parser.y"
+                                            { (yyval.type) = (yyvsp[0].type); }
+#line 1850 "src/parsing/parser.cpp"
     break;
 
-  case 13:
-/* Line 1802 of yacc.c  */
-#line 170 "src/parsing/parser.y"
-    { (yyval.type) = new AST::ArrayType{(yyvsp[(2) - (4)].integer), (yyvsp[(4) - (4)].type)}; }
+  case 14: /* composite_type: '[' array_length ']' type  */
+#line 214 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::ArrayType{(yyvsp[-2].integer), (yyvsp[0].type)}; }
+#line 1856 "src/parsing/parser.cpp"
     break;
 
-  case 14:
-/* Line 1802 of yacc.c  */
-#line 171 "src/parsing/parser.y"
-    { (yyval.type) = new AST::SliceType{(yyvsp[(3) - (3)].type)}; }
+  case 15: /* composite_type: '[' ']' type  */
+#line 215 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::SliceType{(yyvsp[0].type)}; }
+#line 1862 "src/parsing/parser.cpp"
     break;
 
-  case 15:
-/* Line 1802 of yacc.c  */
-#line 172 "src/parsing/parser.y"
-    { (yyval.type) = new AST::StructType{(yyvsp[(3) - (4)].fields)->toStdVector()}; delete (yyvsp[(3) - (4)].fields); }
+  case 16: /* composite_type: STRUCT '{' struct_field_decls '}'  */
+#line 216 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::StructType{(yyvsp[-1].fields)->toStdVector()}; delete (yyvsp[-1].fields); }
+#line 1868 "src/parsing/parser.cpp"
     break;
 
-  case 16:
-/* Line 1802 of yacc.c  */
-#line 173 "src/parsing/parser.y"
-    { (yyval.type) = new AST::MapType{(yyvsp[(3) - (5)].type), (yyvsp[(5) - (5)].type)}; }
+  case 17: /* composite_type: MAP '[' type ']' type  */
+#line 217 "src/parsing/parser.y"
+                                            { (yyval.type) = new AST::MapType{(yyvsp[-2].type), (yyvsp[0].type)}; }
+#line 1874 "src/parsing/parser.cpp"
     break;
 
-  case 17:
-/* Line 1802 of yacc.c  */
-#line 177 "src/parsing/parser.y"
-    { (yyval.integer) = yylval.integer; }
+  case 18: /* array_length: INT_LITERAL  */
+#line 221 "src/parsing/parser.y"
+                                            { (yyval.integer) = yylval.integer; }
+#line 1880 "src/parsing/parser.cpp"
     break;
 
-  case 18:
-/* Line 1802 of yacc.c  */
-#line 182 "src/parsing/parser.y"
-    { 
-                                                (yyval.type) = new AST::FunctionType{(yyvsp[(1) - (2)].fields)->toStdVector(), (yyvsp[(2) - (2)].fields)->toStdVector()}; 
-                                                delete (yyvsp[(1) - (2)].fields);
-                                                delete (yyvsp[(2) - (2)].fields);
+  case 19: /* function_signature: function_parameters function_result  */
+#line 226 "src/parsing/parser.y"
+                                            { 
+                                                (yyval.type) = new AST::FunctionType{(yyvsp[-1].fields)->toStdVector(), (yyvsp[0].fields)->toStdVector()}; 
+                                                delete (yyvsp[-1].fields);
+                                                delete (yyvsp[0].fields);
                                             }
+#line 1890 "src/parsing/parser.cpp"
     break;
 
-  case 19:
-/* Line 1802 of yacc.c  */
-#line 190 "src/parsing/parser.y"
-    { (yyval.fields) = new LinkedList<std::pair<std::string, AST::Type *>>; }
+  case 20: /* function_result: %empty  */
+#line 234 "src/parsing/parser.y"
+                                            { (yyval.fields) = new LinkedList<std::pair<Atom, AST::Type *>>; }
+#line 1896 "src/parsing/parser.cpp"
     break;
 
-  case 20:
-/* Line 1802 of yacc.c  */
-#line 191 "src/parsing/parser.y"
-    { (yyval.fields) = (yyvsp[(1) - (1)].fields); }
+  case 21: /* function_result: function_parameters  */
+#line 235 "src/parsing/parser.y"
+                                            { (yyval.fields) = (yyvsp[0].fields); }
+#line 1902 "src/parsing/parser.cpp"
     break;
 
-  case 21:
-/* Line 1802 of yacc.c  */
-#line 192 "src/parsing/parser.y"
-    { 
-                                                auto type = (yyvsp[(1) - (1)].type);
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+  case 22: /* function_result: type  */
+#line 236 "src/parsing/parser.y"
+                                            { 
+                                                auto type = (yyvsp[0].type);
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 list->insert(0, std::make_pair("", type));
                                                 (yyval.fields) = list;
                                             }
+#line 1913 "src/parsing/parser.cpp"
     break;
 
-  case 22:
-/* Line 1802 of yacc.c  */
-#line 201 "src/parsing/parser.y"
-    { (yyval.fields) = new LinkedList<std::pair<std::string, AST::Type *>>; }
+  case 23: /* function_parameters: '(' ')'  */
+#line 245 "src/parsing/parser.y"
+                                            { (yyval.fields) = new LinkedList<std::pair<Atom, AST::Type *>>; }
+#line 1919 "src/parsing/parser.cpp"
     break;
 
-  case 23:
-/* Line 1802 of yacc.c  */
-#line 203 "src/parsing/parser.y"
-    { (yyval.fields) = (yyvsp[(2) - (3)].fields); }
+  case 24: /* function_parameters: '(' function_parameter_list ')'  */
+#line 247 "src/parsing/parser.y"
+                                            { (yyval.fields) = (yyvsp[-1].fields); }
+#line 1925 "src/parsing/parser.cpp"
     break;
 
-  case 24:
-/* Line 1802 of yacc.c  */
-#line 205 "src/parsing/parser.y"
-    { (yyval.fields) = (yyvsp[(2) - (4)].fields); }
+  case 25: /* function_parameters: '(' function_parameter_list ',' ')'  */
+#line 249 "src/parsing/parser.y"
+                                            { (yyval.fields) = (yyvsp[-2].fields); }
+#line 1931 "src/parsing/parser.cpp"
     break;
 
-  case 25:
-/* Line 1802 of yacc.c  */
-#line 209 "src/parsing/parser.y"
-    { 
-                                                auto type = (yyvsp[(1) - (1)].type);
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+  case 26: /* function_parameter_list: type  */
+#line 253 "src/parsing/parser.y"
+                                            { 
+                                                auto type = (yyvsp[0].type);
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 list->insert(0, std::make_pair("", type));
                                                 (yyval.fields) = list;
                                             }
+#line 1942 "src/parsing/parser.cpp"
     break;
 
-  case 26:
-/* Line 1802 of yacc.c  */
-#line 216 "src/parsing/parser.y"
-    {
-                                                auto ids = (yyvsp[(1) - (2)].id_list)->toStdVector();
-                                                delete (yyvsp[(1) - (2)].id_list);
-                                                auto type = (yyvsp[(2) - (2)].type);
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+  case 27: /* function_parameter_list: identifier_list type  */
+#line 260 "src/parsing/parser.y"
+                                            {
+                                                auto ids = (yyvsp[-1].id_list)->toStdVector();
+                                                delete (yyvsp[-1].id_list);
+                                                auto type = (yyvsp[0].type);
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
                                                 (yyval.fields) = list;
                                             }
+#line 1957 "src/parsing/parser.cpp"
     break;
 
-  case 27:
-/* Line 1802 of yacc.c  */
-#line 227 "src/parsing/parser.y"
-    { 
-                                                auto type = (yyvsp[(1) - (3)].type);
-                                                auto list = (yyvsp[(3) - (3)].fields);
+  case 28: /* function_parameter_list: type ',' function_parameter_list  */
+#line 271 "src/parsing/parser.y"
+                                            { 
+                                                auto type = (yyvsp[-2].type);
+                                                auto list = (yyvsp[0].fields);
                                                 list->insert(0, std::make_pair("", type));
                                                 (yyval.fields) = list;
                                             }
+#line 1968 "src/parsing/parser.cpp"
     break;
 
-  case 28:
-/* Line 1802 of yacc.c  */
-#line 234 "src/parsing/parser.y"
-    {
-                                                auto ids = (yyvsp[(1) - (4)].id_list)->toStdVector();
-                                                delete (yyvsp[(1) - (4)].id_list);
-                                                auto type = (yyvsp[(2) - (4)].type);
-                                                auto list = (yyvsp[(4) - (4)].fields);
+  case 29: /* function_parameter_list: identifier_list type ',' function_parameter_list  */
+#line 278 "src/parsing/parser.y"
+                                            {
+                                                auto ids = (yyvsp[-3].id_list)->toStdVector();
+                                                delete (yyvsp[-3].id_list);
+                                                auto type = (yyvsp[-2].type);
+                                                auto list = (yyvsp[0].fields);
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
                                                 (yyval.fields) = list;
                                             }
+#line 1983 "src/parsing/parser.cpp"
     break;
 
-  case 29:
-/* Line 1802 of yacc.c  */
-#line 248 "src/parsing/parser.y"
-    {
-                                                auto ids = (yyvsp[(1) - (3)].id_list)->toStdVector();
-                                                delete (yyvsp[(1) - (3)].id_list);
-                                                auto type = (yyvsp[(2) - (3)].type);
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+  case 30: /* struct_field_decls: identifier_list type ';'  */
+#line 292 "src/parsing/parser.y"
+                                            {
+                                                auto ids = (yyvsp[-2].id_list)->toStdVector();
+                                                delete (yyvsp[-2].id_list);
+                                                auto type = (yyvsp[-1].type);
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
                                                 (yyval.fields) = list;
                                             }
+#line 1998 "src/parsing/parser.cpp"
     break;
 
-  case 30:
-/* Line 1802 of yacc.c  */
-#line 259 "src/parsing/parser.y"
-    {
-                                                auto ids = (yyvsp[(1) - (4)].id_list)->toStdVector();
-                                                delete (yyvsp[(1) - (4)].id_list);
-                                                auto type = (yyvsp[(2) - (4)].type);
-                                                auto list = (yyvsp[(4) - (4)].fields);
+  case 31: /* struct_field_decls: identifier_list type ';' struct_field_decls  */
+#line 303 "src/parsing/parser.y"
+                                            {
+                                                auto ids = (yyvsp[-3].id_list)->toStdVector();
+                                                delete (yyvsp[-3].id_list);
+                                                auto type = (yyvsp[-2].type);
+                                                auto list = (yyvsp[0].fields);
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
                                                 (yyval.fields) = list;
                                             }
+#line 2013 "src/parsing/parser.cpp"
     break;
 
-  case 31:
-/* Line 1802 of yacc.c  */
-#line 273 "src/parsing/parser.y"
-    { (yyval.block) = new AST::Block{(yyvsp[(2) - (3)].statements)->toStdVector()}; delete (yyvsp[(2) - (3)].statements); }
+  case 32: /* block: '{' statement_list '}'  */
+#line 317 "src/parsing/parser.y"
+                                            { (yyval.block) = new AST::Block{(yyvsp[-1].statements)->toStdVector()}; delete (yyvsp[-1].statements); }
+#line 2019 "src/parsing/parser.cpp"
     break;
 
-  case 32:
-/* Line 1802 of yacc.c  */
-#line 278 "src/parsing/parser.y"
-    {
-                                                auto declarations = (yyvsp[(1) - (1)].declarations)->toStdVector(); 
-                                                delete (yyvsp[(1) - (1)].declarations);
+  case 33: /* body: BODY statement_list '}'  */
+#line 322 "src/parsing/parser.y"
+                                            { (yyval.block) = new AST::Block{(yyvsp[-1].statements)->toStdVector()}; delete (yyvsp[-1].statements); }
+#line 2025 "src/parsing/parser.cpp"
+    break;
+
+  case 34: /* top_level_declaration: declaration  */
+#line 327 "src/parsing/parser.y"
+                                            {
+                                                auto declarations = (yyvsp[0].declarations)->toStdVector(); 
+                                                delete (yyvsp[0].declarations);
                                                 auto list = new LinkedList<AST::TopLevelDeclaration *>;
                                                 for (int i = 0; i < declarations.size(); i++) {
                                                     list->insert(i, declarations[i]);
                                                 }
                                                 (yyval.top_level_declarations) = list;
                                             }
+#line 2039 "src/parsing/parser.cpp"
     break;
 
-  case 33:
-/* Line 1802 of yacc.c  */
-#line 287 "src/parsing/parser.y"
-    {
-                                                auto function = (yyvsp[(1) - (1)].top_level_declaration);
+  case 35: /* top_level_declaration: function_declaration  */
+#line 336 "src/parsing/parser.y"
+                                            {
+                                                auto function = (yyvsp[0].top_level_declaration);
                                                 auto list = new LinkedList<AST::TopLevelDeclaration *>; 
                                                 list->insert(0, function);
                                                 (yyval.top_level_declarations) = list;
                                             }
+#line 2050 "src/parsing/parser.cpp"
     break;
 
-  case 34:
-/* Line 1802 of yacc.c  */
-#line 297 "src/parsing/parser.y"
-    { (yyval.top_level_declarations) = new LinkedList<AST::TopLevelDeclaration *>; }
+  case 36: /* top_level_declaration_list: %empty  */
+#line 346 "src/parsing/parser.y"
+                                            { (yyval.top_level_declarations) = new LinkedList<AST::TopLevelDeclaration *>; }
+#line 2056 "src/parsing/parser.cpp"
     break;
 
-  case 35:
-/* Line 1802 of yacc.c  */
-#line 299 "src/parsing/parser.y"
-    {
-                                                auto declarations = (yyvsp[(1) - (3)].top_level_declarations)->toStdVector();
-                                                delete (yyvsp[(1) - (3)].top_level_declarations);
-                                                auto list = (yyvsp[(3) - (3)].top_level_declarations);
+  case 37: /* top_level_declaration_list: top_level_declaration ';' top_level_declaration_list  */
+#line 348 "src/parsing/parser.y"
+                                            {
+                                                auto declarations = (yyvsp[-2].top_level_declarations)->toStdVector();
+                                                delete (yyvsp[-2].top_level_declarations);
+                                                auto list = (yyvsp[0].top_level_declarations);
                                                 for (int i = 0; i < declarations.size(); i++) {
                                                     list->insert(i, declarations[i]);
                                                 }
                                                 (yyval.top_level_declarations) = list;
                                             }
+#line 2070 "src/parsing/parser.cpp"
     break;
 
-  case 36:
-/* Line 1802 of yacc.c  */
-#line 312 "src/parsing/parser.y"
-    {
-                                                (yyval.top_level_declaration) = new AST::FunctionDeclaration{(yyvsp[(2) - (4)].identifier), (yyvsp[(3) - (4)].type), (yyvsp[(4) - (4)].block)};
+  case 38: /* function_declaration: FUNC IDENTIFIER function_signature block  */
+#line 361 "src/parsing/parser.y"
+                                            {
+                                                (yyval.top_level_declaration) = new AST::FunctionDeclaration{(yyvsp[-2].identifier), (yyvsp[-1].type), (yyvsp[0].block)};
                                             }
+#line 2078 "src/parsing/parser.cpp"
     break;
 
-  case 37:
-/* Line 1802 of yacc.c  */
-#line 318 "src/parsing/parser.y"
-    { (yyval.declarations) = (yyvsp[(1) - (1)].declarations); }
+  case 39: /* declaration: type_decl  */
+#line 367 "src/parsing/parser.y"
+                                            { (yyval.declarations) = (yyvsp[0].declarations); }
+#line 2084 "src/parsing/parser.cpp"
     break;
 
-  case 38:
-/* Line 1802 of yacc.c  */
-#line 319 "src/parsing/parser.y"
-    { (yyval.declarations) = (yyvsp[(1) - (1)].declarations); }
+  case 40: /* declaration: var_decl  */
+#line 368 "src/parsing/parser.y"
+                                            { (yyval.declarations) = (yyvsp[0].declarations); }
+#line 2090 "src/parsing/parser.cpp"
     break;
 
-  case 39:
-/* Line 1802 of yacc.c  */
-#line 323 "src/parsing/parser.y"
-    { 
-                                                auto typeSpec = (yyvsp[(2) - (2)].declaration);
+  case 41: /* type_decl: TYPE type_spec  */
+#line 372 "src/parsing/parser.y"
+                                            { 
+                                                auto typeSpec = (yyvsp[0].declaration);
                                                 auto list = new LinkedList<AST::Declaration *>;
                                                 list->insert(0, typeSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2101 "src/parsing/parser.cpp"
     break;
 
-  case 40:
-/* Line 1802 of yacc.c  */
-#line 329 "src/parsing/parser.y"
-    { (yyval.declarations) = (yyvsp[(3) - (4)].declarations); }
+  case 42: /* type_decl: TYPE '(' type_spec_list ')'  */
+#line 378 "src/parsing/parser.y"
+                                            { (yyval.declarations) = (yyvsp[-1].declarations); }
+#line 2107 "src/parsing/parser.cpp"
     break;
 
-  case 41:
-/* Line 1802 of yacc.c  */
-#line 333 "src/parsing/parser.y"
-    { (yyval.declaration) = new AST::TypeAliasDeclaration{(yyvsp[(1) - (3)].identifier), (yyvsp[(3) - (3)].type)}; delete (yyvsp[(1) - (3)].identifier); }
+  case 43: /* type_spec: IDENTIFIER '=' type  */
+#line 382 "src/parsing/parser.y"
+                                            { (yyval.declaration) = new AST::TypeAliasDeclaration{(yyvsp[-2].identifier), (yyvsp[0].type)}; }
+#line 2113 "src/parsing/parser.cpp"
     break;
 
-  case 42:
-/* Line 1802 of yacc.c  */
-#line 334 "src/parsing/parser.y"
-    { (yyval.declaration) = new AST::TypeDefinitionDeclaration{(yyvsp[(1) - (2)].identifier), (yyvsp[(2) - (2)].type)}; delete (yyvsp[(1) - (2)].identifier); }
+  case 44: /* type_spec: IDENTIFIER type  */
+#line 383 "src/parsing/parser.y"
+                                            { (yyval.declaration) = new AST::TypeDefinitionDeclaration{(yyvsp[-1].identifier), (yyvsp[0].type)}; }
+#line 2119 "src/parsing/parser.cpp"
     break;
 
-  case 43:
-/* Line 1802 of yacc.c  */
-#line 338 "src/parsing/parser.y"
-    {  
-                                                auto typeSpec = (yyvsp[(1) - (2)].declaration);
+  case 45: /* type_spec_list: type_spec ';'  */
+#line 387 "src/parsing/parser.y"
+                                            {  
+                                                auto typeSpec = (yyvsp[-1].declaration);
                                                 auto list = new LinkedList<AST::Declaration *>; 
                                                 list->insert(0, typeSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2130 "src/parsing/parser.cpp"
     break;
 
-  case 44:
-/* Line 1802 of yacc.c  */
-#line 345 "src/parsing/parser.y"
-    { 
-                                                auto typeSpec = (yyvsp[(1) - (3)].declaration);
-                                                auto list = (yyvsp[(3) - (3)].declarations); 
+  case 46: /* type_spec_list: type_spec ';' type_spec_list  */
+#line 394 "src/parsing/parser.y"
+                                            { 
+                                                auto typeSpec = (yyvsp[-2].declaration);
+                                                auto list = (yyvsp[0].declarations); 
                                                 list->insert(0, typeSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2141 "src/parsing/parser.cpp"
     break;
 
-  case 45:
-/* Line 1802 of yacc.c  */
-#line 354 "src/parsing/parser.y"
-    {
-                                                auto varSpec = (yyvsp[(2) - (2)].declaration);
+  case 47: /* var_decl: VAR var_spec  */
+#line 403 "src/parsing/parser.y"
+                                            {
+                                                auto varSpec = (yyvsp[0].declaration);
                                                 auto list = new LinkedList<AST::Declaration*>;
                                                 list->insert(0, varSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2152 "src/parsing/parser.cpp"
     break;
 
-  case 46:
-/* Line 1802 of yacc.c  */
-#line 360 "src/parsing/parser.y"
-    { (yyval.declarations) = (yyvsp[(3) - (4)].declarations); }
+  case 48: /* var_decl: VAR '(' var_spec_list ')'  */
+#line 409 "src/parsing/parser.y"
+                                            { (yyval.declarations) = (yyvsp[-1].declarations); }
+#line 2158 "src/parsing/parser.cpp"
     break;
 
-  case 47:
-/* Line 1802 of yacc.c  */
-#line 364 "src/parsing/parser.y"
-    { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[(1) - (2)].id_list)->toStdVector(), (yyvsp[(2) - (2)].type), {}}; }
+  case 49: /* var_spec: identifier_list type  */
+#line 413 "src/parsing/parser.y"
+                                            { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[-1].id_list)->toStdVector(), (yyvsp[0].type), {}}; }
+#line 2164 "src/parsing/parser.cpp"
     break;
 
-  case 48:
-/* Line 1802 of yacc.c  */
-#line 366 "src/parsing/parser.y"
-    { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[(1) - (4)].id_list)->toStdVector(), (yyvsp[(2) - (4)].type), (yyvsp[(4) - (4)].expressions)->toStdVector()}; }
+  case 50: /* var_spec: identifier_list type '=' expression_list  */
+#line 415 "src/parsing/parser.y"
+                                            { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[-3].id_list)->toStdVector(), (yyvsp[-2].type), (yyvsp[0].expressions)->toStdVector()}; }
+#line 2170 "src/parsing/parser.cpp"
     break;
 
-  case 49:
-/* Line 1802 of yacc.c  */
-#line 368 "src/parsing/parser.y"
-    { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[(1) - (3)].id_list)->toStdVector(), nullptr, (yyvsp[(3) - (3)].expressions)->toStdVector()}; }
+  case 51: /* var_spec: identifier_list '=' expression_list  */
+#line 417 "src/parsing/parser.y"
+                                            { (yyval.declaration) = new AST::VariableDeclaration{(yyvsp[-2].id_list)->toStdVector(), nullptr, (yyvsp[0].expressions)->toStdVector()}; }
+#line 2176 "src/parsing/parser.cpp"
     break;
 
-  case 50:
-/* Line 1802 of yacc.c  */
-#line 372 "src/parsing/parser.y"
-    {
-                                                auto varSpec = (yyvsp[(1) - (2)].declaration);
+  case 52: /* var_spec_list: var_spec ';'  */
+#line 421 "src/parsing/parser.y"
+                                            {
+                                                auto varSpec = (yyvsp[-1].declaration);
                                                 auto list = new LinkedList<AST::Declaration *>;
                                                 list->insert(0, varSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2187 "src/parsing/parser.cpp"
     break;
 
-  case 51:
-/* Line 1802 of yacc.c  */
-#line 378 "src/parsing/parser.y"
-    { 
-                                                auto varSpec = (yyvsp[(1) - (3)].declaration);
-                                                auto list = (yyvsp[(3) - (3)].declarations); 
+  case 53: /* var_spec_list: var_spec ';' var_spec_list  */
+#line 427 "src/parsing/parser.y"
+                                            { 
+                                                auto varSpec = (yyvsp[-2].declaration);
+                                                auto list = (yyvsp[0].declarations); 
                                                 list->insert(0, varSpec);
                                                 (yyval.declarations) = list;
                                             }
+#line 2198 "src/parsing/parser.cpp"
     break;
 
-  case 52:
-/* Line 1802 of yacc.c  */
-#line 388 "src/parsing/parser.y"
-    {
-                                                auto stmt = (yyvsp[(1) - (1)].simple_statement);
+  case 54: /* statement: simple_statement  */
+#line 437 "src/parsing/parser.y"
+                                            {
+                                                auto stmt = (yyvsp[0].simple_statement);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, stmt);
                                                 (yyval.statements) = list;
                                             }
+#line 2209 "src/parsing/parser.cpp"
     break;
 
-  case 53:
-/* Line 1802 of yacc.c  */
-#line 394 "src/parsing/parser.y"
-    {
-                                                auto if_statement = (yyvsp[(1) - (1)].statement);
+  case 55: /* statement: if_statement  */
+#line 443 "src/parsing/parser.y"
+                                            {
+                                                auto if_statement = (yyvsp[0].statement);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, if_statement);
                                                 (yyval.statements) = list;
                                             }
+#line 2220 "src/parsing/parser.cpp"
     break;
 
-  case 54:
-/* Line 1802 of yacc.c  */
-#line 400 "src/parsing/parser.y"
-    {
-                                                auto switch_statement = (yyvsp[(1) - (1)].statement);
+  case 56: /* statement: switch_statement  */
+#line 449 "src/parsing/parser.y"
+                                            {
+                                                auto switch_statement = (yyvsp[0].statement);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, switch_statement);
                                                 (yyval.statements) = list;
                                             }
+#line 2231 "src/parsing/parser.cpp"
     break;
 
-  case 55:
-/* Line 1802 of yacc.c  */
-#line 406 "src/parsing/parser.y"
-    {
-                                                auto return_statement = (yyvsp[(1) - (1)].statement);
+  case 57: /* statement: return_statement  */
+#line 455 "src/parsing/parser.y"
+                                            {
+                                                auto return_statement = (yyvsp[0].statement);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, return_statement);
                                                 (yyval.statements) = list;
                                             }
+#line 2242 "src/parsing/parser.cpp"
     break;
 
-  case 56:
-/* Line 1802 of yacc.c  */
-#line 412 "src/parsing/parser.y"
-    {
+  case 58: /* statement: BREAK  */
+#line 461 "src/parsing/parser.y"
+                                            {
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, new AST::BreakStatement{});
                                                 (yyval.statements) = list;
                                             }
+#line 2252 "src/parsing/parser.cpp"
     break;
 
-  case 57:
-/* Line 1802 of yacc.c  */
-#line 417 "src/parsing/parser.y"
-    {
+  case 59: /* statement: CONTINUE  */
+#line 466 "src/parsing/parser.y"
+                                            {
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, new AST::ContinueStatement{});
                                                 (yyval.statements) = list;
                                             }
+#line 2262 "src/parsing/parser.cpp"
     break;
 
-  case 58:
-/* Line 1802 of yacc.c  */
-#line 422 "src/parsing/parser.y"
-    {
-                                                auto for_statement = (yyvsp[(1) - (1)].statement);
+  case 60: /* statement: for_statement  */
+#line 471 "src/parsing/parser.y"
+                                            {
+                                                auto for_statement = (yyvsp[0].statement);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 list->insert(0, for_statement);
                                                 (yyval.statements) = list;
                                             }
+#line 2273 "src/parsing/parser.cpp"
     break;
 
-  case 59:
-/* Line 1802 of yacc.c  */
-#line 428 "src/parsing/parser.y"
-    { 
-                                                auto declarations = (yyvsp[(1) - (1)].declarations)->toStdVector(); 
-                                                delete (yyvsp[(1) - (1)].declarations);
+  case 61: /* statement: declaration  */
+#line 477 "src/parsing/parser.y"
+                                            { 
+                                                auto declarations = (yyvsp[0].declarations)->toStdVector(); 
+                                                delete (yyvsp[0].declarations);
                                                 auto list = new LinkedList<AST::Statement *>;
                                                 for (int i = 0; i < declarations.size(); i++) {
                                                     list->insert(i, new AST::DeclarationStatement{declarations[i]});
                                                 }
                                                 (yyval.statements) = list;
                                             }
+#line 2287 "src/parsing/parser.cpp"
     break;
 
-  case 60:
-/* Line 1802 of yacc.c  */
-#line 440 "src/parsing/parser.y"
-    { (yyval.simple_statement) = new AST::EmptyStatement{}; }
+  case 62: /* simple_statement: %empty  */
+#line 489 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::EmptyStatement{}; }
+#line 2293 "src/parsing/parser.cpp"
     break;
 
-  case 61:
-/* Line 1802 of yacc.c  */
-#line 441 "src/parsing/parser.y"
-    { (yyval.simple_statement) = new AST::ExpressionStatement{(yyvsp[(1) - (1)].expression)}; }
+  case 63: /* simple_statement: expression  */
+#line 490 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::ExpressionStatement{(yyvsp[0].expression)}; }
+#line 2299 "src/parsing/parser.cpp"
     break;
 
-  case 62:
-/* Line 1802 of yacc.c  */
-#line 443 "src/parsing/parser.y"
-    {
-                                                auto lhs = (yyvsp[(1) - (3)].expressions)->toStdVector();
-                                                auto rhs = (yyvsp[(3) - (3)].expressions)->toStdVector();
+  case 64: /* simple_statement: expression_list '=' expression_list  */
+#line 492 "src/parsing/parser.y"
+                                            {
+                                                auto lhs = (yyvsp[-2].expressions)->toStdVector();
+                                                auto rhs = (yyvsp[0].expressions)->toStdVector();
                                                 (yyval.simple_statement) = new AST::AssignmentStatement{lhs, rhs};
-                                                delete (yyvsp[(1) - (3)].expressions);
-                                                delete (yyvsp[(3) - (3)].expressions);
+                                                delete (yyvsp[-2].expressions);
+                                                delete (yyvsp[0].expressions);
                                             }
+#line 2311 "src/parsing/parser.cpp"
+    break;
+
+  case 65: /* simple_statement: expression INC  */
+#line 499 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::IncDecStatement{(yyvsp[-1].expression), 1}; }
+#line 2317 "src/parsing/parser.cpp"
+    break;
+
+  case 66: /* simple_statement: expression DEC  */
+#line 500 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::IncDecStatement{(yyvsp[-1].expression), -1}; }
+#line 2323 "src/parsing/parser.cpp"
+    break;
+
+  case 67: /* simple_statement: expression '+' '=' expression  */
+#line 502 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::ADD, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2329 "src/parsing/parser.cpp"
+    break;
+
+  case 68: /* simple_statement: expression '-' '=' expression  */
+#line 503 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::SUB, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2335 "src/parsing/parser.cpp"
+    break;
+
+  case 69: /* simple_statement: expression '|' '=' expression  */
+#line 504 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_OR, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2341 "src/parsing/parser.cpp"
+    break;
+
+  case 70: /* simple_statement: expression '^' '=' expression  */
+#line 505 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_XOR, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2347 "src/parsing/parser.cpp"
     break;
 
-  case 63:
-/* Line 1802 of yacc.c  */
-#line 453 "src/parsing/parser.y"
-    { 
+  case 71: /* simple_statement: expression '&' '=' expression  */
+#line 506 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_AND, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2353 "src/parsing/parser.cpp"
+    break;
+
+  case 72: /* simple_statement: expression '*' '=' expression  */
+#line 507 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::MULT, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2359 "src/parsing/parser.cpp"
+    break;
+
+  case 73: /* simple_statement: expression '/' '=' expression  */
+#line 508 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::DIV, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2365 "src/parsing/parser.cpp"
+    break;
+
+  case 74: /* simple_statement: expression '%' '=' expression  */
+#line 509 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::MOD, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2371 "src/parsing/parser.cpp"
+    break;
+
+  case 75: /* simple_statement: expression SHIFT_LEFT '=' expression  */
+#line 510 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_LEFT, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2377 "src/parsing/parser.cpp"
+    break;
+
+  case 76: /* simple_statement: expression SHIFT_RIGHT '=' expression  */
+#line 511 "src/parsing/parser.y"
+                                            { (yyval.simple_statement) = new AST::CompoundAssignmentStatement{(yyvsp[-3].expression), new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_RIGHT, new AST::TargetExpression{}, (yyvsp[0].expression)}}; }
+#line 2383 "src/parsing/parser.cpp"
+    break;
+
+  case 77: /* statement_list: %empty  */
+#line 515 "src/parsing/parser.y"
+                                            { 
                                                 (yyval.statements) = new LinkedList<AST::Statement *>;
                                             }
+#line 2391 "src/parsing/parser.cpp"
     break;
 
-  case 64:
-/* Line 1802 of yacc.c  */
-#line 457 "src/parsing/parser.y"
-    {
-                                                auto statements = (yyvsp[(1) - (3)].statements)->toStdVector();
-                                                delete (yyvsp[(1) - (3)].statements);
-                                                auto list = (yyvsp[(3) - (3)].statements);
+  case 78: /* statement_list: statement ';' statement_list  */
+#line 519 "src/parsing/parser.y"
+                                            {
+                                                auto statements = (yyvsp[-2].statements)->toStdVector();
+                                                delete (yyvsp[-2].statements);
+                                                auto list = (yyvsp[0].statements);
                                                 for (int i = 0; i < statements.size(); i++) {
                                                     list->insert(i, statements[i]);
                                                 }
                                                 (yyval.statements) = list;
                                             }
+#line 2405 "src/parsing/parser.cpp"
     break;
 
-  case 65:
-/* Line 1802 of yacc.c  */
-#line 470 "src/parsing/parser.y"
-    { (yyval.statement) = new AST::IfStatement{(yyvsp[(2) - (3)].expression), (yyvsp[(3) - (3)].block), new AST::Block{{}}}; }
+  case 79: /* if_statement: IF expression body  */
+#line 532 "src/parsing/parser.y"
+                                            { (yyval.statement) = new AST::IfStatement{(yyvsp[-1].expression), (yyvsp[0].block), new AST::Block{{}}}; }
+#line 2411 "src/parsing/parser.cpp"
     break;
 
-  case 66:
-/* Line 1802 of yacc.c  */
-#line 472 "src/parsing/parser.y"
-    { (yyval.statement) = new AST::IfStatement{(yyvsp[(2) - (5)].expression), (yyvsp[(3) - (5)].block), new AST::Block{{(yyvsp[(5) - (5)].statement)}}}; }
+  case 80: /* if_statement: IF expression body ELSE if_statement  */
+#line 534 "src/parsing/parser.y"
+                                            { (yyval.statement) = new AST::IfStatement{(yyvsp[-3].expression), (yyvsp[-2].block), new AST::Block{{(yyvsp[0].statement)}}}; }
+#line 2417 "src/parsing/parser.cpp"
     break;
 
-  case 67:
-/* Line 1802 of yacc.c  */
-#line 474 "src/parsing/parser.y"
-    { (yyval.statement) = new AST::IfStatement{(yyvsp[(2) - (5)].expression), (yyvsp[(3) - (5)].block), (yyvsp[(5) - (5)].block)}; }
+  case 81: /* if_statement: IF expression body ELSE block  */
+#line 536 "src/parsing/parser.y"
+                                            { (yyval.statement) = new AST::IfStatement{(yyvsp[-3].expression), (yyvsp[-2].block), (yyvsp[0].block)}; }
+#line 2423 "src/parsing/parser.cpp"
     break;
 
-  case 68:
-/* Line 1802 of yacc.c  */
-#line 479 "src/parsing/parser.y"
-    {
-                                                (yyval.statement) = new AST::SwitchStatement{(yyvsp[(2) - (5)].expression), (yyvsp[(4) - (5)].switch_clauses)->toStdVector()};
-                                                delete (yyvsp[(4) - (5)].switch_clauses);
+  case 82: /* switch_statement: SWITCH expression BODY switch_clause_list '}'  */
+#line 541 "src/parsing/parser.y"
+                                            {
+                                                (yyval.statement) = new AST::SwitchStatement{(yyvsp[-3].expression), (yyvsp[-1].switch_clauses)->toStdVector()};
+                                                delete (yyvsp[-1].switch_clauses);
                                             }
+#line 2432 "src/parsing/parser.cpp"
     break;
 
-  case 69:
-/* Line 1802 of yacc.c  */
-#line 487 "src/parsing/parser.y"
-    {
-                                                (yyval.switch_clause) = new AST::SwitchStatement::SwitchExpressionClause{(yyvsp[(2) - (4)].expressions)->toStdVector(), (yyvsp[(4) - (4)].statements)->toStdVector()}; 
-                                                delete (yyvsp[(2) - (4)].expressions);
-                                                delete (yyvsp[(4) - (4)].statements);
+  case 83: /* switch_clause: CASE expression_list ':' statement_list  */
+#line 549 "src/parsing/parser.y"
+                                            {
+                                                (yyval.switch_clause) = new AST::SwitchStatement::SwitchExpressionClause{(yyvsp[-2].expressions)->toStdVector(), (yyvsp[0].statements)->toStdVector()}; 
+                                                delete (yyvsp[-2].expressions);
+                                                delete (yyvsp[0].statements);
                                             }
+#line 2442 "src/parsing/parser.cpp"
     break;
 
-  case 70:
-/* Line 1802 of yacc.c  */
-#line 493 "src/parsing/parser.y"
-    {
-                                                (yyval.switch_clause) = new AST::SwitchStatement::SwitchDefaultClause{(yyvsp[(3) - (3)].statements)->toStdVector()}; 
-                                                delete (yyvsp[(3) - (3)].statements);
+  case 84: /* switch_clause: DEFAULT ':' statement_list  */
+#line 555 "src/parsing/parser.y"
+                                            {
+                                                (yyval.switch_clause) = new AST::SwitchStatement::SwitchDefaultClause{(yyvsp[0].statements)->toStdVector()}; 
+                                                delete (yyvsp[0].statements);
                                             }
+#line 2451 "src/parsing/parser.cpp"
     break;
 
-  case 71:
-/* Line 1802 of yacc.c  */
-#line 500 "src/parsing/parser.y"
-    { 
+  case 85: /* switch_clause_list: %empty  */
+#line 562 "src/parsing/parser.y"
+                                            { 
                                                 (yyval.switch_clauses) = new LinkedList<AST::SwitchStatement::SwitchClause *>;
                                             }
+#line 2459 "src/parsing/parser.cpp"
     break;
 
-  case 72:
-/* Line 1802 of yacc.c  */
-#line 504 "src/parsing/parser.y"
-    { 
-                                                auto clause = (yyvsp[(1) - (2)].switch_clause);
-                                                auto list = (yyvsp[(2) - (2)].switch_clauses);
+  case 86: /* switch_clause_list: switch_clause switch_clause_list  */
+#line 566 "src/parsing/parser.y"
+                                            { 
+                                                auto clause = (yyvsp[-1].switch_clause);
+                                                auto list = (yyvsp[0].switch_clauses);
                                                 list->insert(0, clause);
                                                 (yyval.switch_clauses) = list;
                                             }
+#line 2470 "src/parsing/parser.cpp"
     break;
 
-  case 73:
-/* Line 1802 of yacc.c  */
-#line 513 "src/parsing/parser.y"
-    { 
-                                                (yyval.statement) = new AST::ReturnStatement{(yyvsp[(2) - (2)].expressions)->toStdVector()}; 
-                                                delete (yyvsp[(2) - (2)].expressions);
+  case 87: /* return_statement: RETURN expression_list  */
+#line 575 "src/parsing/parser.y"
+                                            { 
+                                                (yyval.statement) = new AST::ReturnStatement{(yyvsp[0].expressions)->toStdVector()}; 
+                                                delete (yyvsp[0].expressions);
                                             }
+#line 2479 "src/parsing/parser.cpp"
     break;
 
-  case 74:
-/* Line 1802 of yacc.c  */
-#line 520 "src/parsing/parser.y"
-    { (yyval.statement) = (yyvsp[(1) - (1)].statement); }
+  case 88: /* return_statement: RETURN  */
+#line 579 "src/parsing/parser.y"
+                                            { (yyval.statement) = new AST::ReturnStatement{{}}; }
+#line 2485 "src/parsing/parser.cpp"
     break;
 
-  case 75:
-/* Line 1802 of yacc.c  */
-#line 525 "src/parsing/parser.y"
-    {
-                                                (yyval.statement) = new AST::ForConditionStatement{(yyvsp[(2) - (7)].simple_statement), (yyvsp[(4) - (7)].expression), (yyvsp[(6) - (7)].simple_statement), (yyvsp[(7) - (7)].block)};
+  case 89: /* for_statement: for_condition_statement  */
+#line 583 "src/parsing/parser.y"
+                                            { (yyval.statement) = (yyvsp[0].statement); }
+#line 2491 "src/parsing/parser.cpp"
+    break;
+
+  case 90: /* for_condition_statement: FOR simple_statement ';' expression ';' simple_statement body  */
+#line 588 "src/parsing/parser.y"
+                                            {
+                                                (yyval.statement) = new AST::ForConditionStatement{(yyvsp[-5].simple_statement), (yyvsp[-3].expression), (yyvsp[-1].simple_statement), (yyvsp[0].block)};
                                             }
+#line 2499 "src/parsing/parser.cpp"
     break;
 
-  case 76:
-/* Line 1802 of yacc.c  */
-#line 529 "src/parsing/parser.y"
-    {
+  case 91: /* for_condition_statement: FOR expression body  */
+#line 592 "src/parsing/parser.y"
+                                            {
                                                 (yyval.statement) = new AST::ForConditionStatement{
                                                     new AST::EmptyStatement{}, 
-                                                    (yyvsp[(2) - (3)].expression), 
+                                                    (yyvsp[-1].expression), 
                                                     new AST::EmptyStatement{}, 
-                                                    (yyvsp[(3) - (3)].block)};
+                                                    (yyvsp[0].block)};
                                             }
+#line 2511 "src/parsing/parser.cpp"
     break;
 
-  case 77:
-/* Line 1802 of yacc.c  */
-#line 537 "src/parsing/parser.y"
-    {
+  case 92: /* for_condition_statement: FOR body  */
+#line 600 "src/parsing/parser.y"
+                                            {
                                                 (yyval.statement) = new AST::ForConditionStatement{
                                                     new AST::EmptyStatement{}, 
                                                     new AST::BoolExpression{true}, 
                                                     new AST::EmptyStatement{}, 
-                                                    (yyvsp[(2) - (2)].block)};
+                                                    (yyvsp[0].block)};
                                             }
+#line 2523 "src/parsing/parser.cpp"
     break;
 
-  case 78:
-/* Line 1802 of yacc.c  */
-#line 548 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 93: /* expression: unary_expression  */
+#line 611 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2529 "src/parsing/parser.cpp"
     break;
 
-  case 79:
-/* Line 1802 of yacc.c  */
-#line 549 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::L_OR, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 94: /* expression: expression OR expression  */
+#line 612 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::L_OR, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2535 "src/parsing/parser.cpp"
     break;
 
-  case 80:
-/* Line 1802 of yacc.c  */
-#line 550 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::L_AND, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 95: /* expression: expression AND expression  */
+#line 613 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::L_AND, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2541 "src/parsing/parser.cpp"
     break;
 
-  case 81:
-/* Line 1802 of yacc.c  */
-#line 551 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::EQ, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 96: /* expression: expression EQ expression  */
+#line 614 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::EQ, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2547 "src/parsing/parser.cpp"
     break;
 
-  case 82:
-/* Line 1802 of yacc.c  */
-#line 552 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::NEQ, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 97: /* expression: expression NEQ expression  */
+#line 615 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::NEQ, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2553 "src/parsing/parser.cpp"
     break;
 
-  case 83:
-/* Line 1802 of yacc.c  */
-#line 553 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::LTE, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 98: /* expression: expression LTE expression  */
+#line 616 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::LTE, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2559 "src/parsing/parser.cpp"
     break;
 
-  case 84:
-/* Line 1802 of yacc.c  */
-#line 554 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::GTE, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 99: /* expression: expression GTE expression  */
+#line 617 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::GTE, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2565 "src/parsing/parser.cpp"
     break;
 
-  case 85:
-/* Line 1802 of yacc.c  */
-#line 555 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_LEFT, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 100: /* expression: expression SHIFT_LEFT expression  */
+#line 618 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_LEFT, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2571 "src/parsing/parser.cpp"
     break;
 
-  case 86:
-/* Line 1802 of yacc.c  */
-#line 556 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_RIGHT, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 101: /* expression: expression SHIFT_RIGHT expression  */
+#line 619 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_RIGHT, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2577 "src/parsing/parser.cpp"
     break;
 
-  case 87:
-/* Line 1802 of yacc.c  */
-#line 557 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::LT, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 102: /* expression: expression '<' expression  */
+#line 620 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::LT, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2583 "src/parsing/parser.cpp"
     break;
 
-  case 88:
-/* Line 1802 of yacc.c  */
-#line 558 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::GT, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 103: /* expression: expression '>' expression  */
+#line 621 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::GT, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2589 "src/parsing/parser.cpp"
     break;
 
-  case 89:
-/* Line 1802 of yacc.c  */
-#line 559 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::ADD, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 104: /* expression: expression '+' expression  */
+#line 622 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::ADD, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2595 "src/parsing/parser.cpp"
     break;
 
-  case 90:
-/* Line 1802 of yacc.c  */
-#line 560 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SUB, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 105: /* expression: expression '-' expression  */
+#line 623 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::SUB, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2601 "src/parsing/parser.cpp"
     break;
 
-  case 91:
-/* Line 1802 of yacc.c  */
-#line 561 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_OR, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 106: /* expression: expression '|' expression  */
+#line 624 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_OR, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2607 "src/parsing/parser.cpp"
     break;
 
-  case 92:
-/* Line 1802 of yacc.c  */
-#line 562 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_XOR, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 107: /* expression: expression '^' expression  */
+#line 625 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_XOR, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2613 "src/parsing/parser.cpp"
     break;
 
-  case 93:
-/* Line 1802 of yacc.c  */
-#line 563 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_AND, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 108: /* expression: expression '&' expression  */
+#line 626 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_AND, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2619 "src/parsing/parser.cpp"
     break;
 
-  case 94:
-/* Line 1802 of yacc.c  */
-#line 564 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::MULT, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 109: /* expression: expression '*' expression  */
+#line 627 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::MULT, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2625 "src/parsing/parser.cpp"
     break;
 
-  case 95:
-/* Line 1802 of yacc.c  */
-#line 565 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::DIV, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 110: /* expression: expression '/' expression  */
+#line 628 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::DIV, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2631 "src/parsing/parser.cpp"
     break;
 
-  case 96:
-/* Line 1802 of yacc.c  */
-#line 566 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::MOD, (yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].expression)}; }
+  case 111: /* expression: expression '%' expression  */
+#line 629 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BinaryExpression{AST::BinaryExpression::Operation::MOD, (yyvsp[-2].expression), (yyvsp[0].expression)}; }
+#line 2637 "src/parsing/parser.cpp"
     break;
 
-  case 97:
-/* Line 1802 of yacc.c  */
-#line 570 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 112: /* optional_expression: expression  */
+#line 633 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2643 "src/parsing/parser.cpp"
     break;
 
-  case 98:
-/* Line 1802 of yacc.c  */
-#line 571 "src/parsing/parser.y"
-    { (yyval.expression) = nullptr; }
+  case 113: /* optional_expression: %empty  */
+#line 634 "src/parsing/parser.y"
+                                            { (yyval.expression) = nullptr; }
+#line 2649 "src/parsing/parser.cpp"
     break;
 
-  case 99:
-/* Line 1802 of yacc.c  */
-#line 575 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 114: /* unary_expression: primary_expression  */
+#line 638 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2655 "src/parsing/parser.cpp"
     break;
 
-  case 100:
-/* Line 1802 of yacc.c  */
-#line 576 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::PLUS, (yyvsp[(2) - (2)].expression)}; }
+  case 115: /* unary_expression: '+' unary_expression  */
+#line 639 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::PLUS, (yyvsp[0].expression)}; }
+#line 2661 "src/parsing/parser.cpp"
     break;
 
-  case 101:
-/* Line 1802 of yacc.c  */
-#line 577 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::NEGATE, (yyvsp[(2) - (2)].expression)}; }
+  case 116: /* unary_expression: '-' unary_expression  */
+#line 640 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::NEGATE, (yyvsp[0].expression)}; }
+#line 2667 "src/parsing/parser.cpp"
     break;
 
-  case 102:
-/* Line 1802 of yacc.c  */
-#line 578 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::L_NOT, (yyvsp[(2) - (2)].expression)}; }
+  case 117: /* unary_expression: '!' unary_expression  */
+#line 641 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::L_NOT, (yyvsp[0].expression)}; }
+#line 2673 "src/parsing/parser.cpp"
     break;
 
-  case 103:
-/* Line 1802 of yacc.c  */
-#line 579 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::BW_NOT, (yyvsp[(2) - (2)].expression)}; }
+  case 118: /* unary_expression: '^' unary_expression  */
+#line 642 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::BW_NOT, (yyvsp[0].expression)}; }
+#line 2679 "src/parsing/parser.cpp"
     break;
 
-  case 104:
-/* Line 1802 of yacc.c  */
-#line 580 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::DEREFERENCE, (yyvsp[(2) - (2)].expression)}; }
+  case 119: /* unary_expression: '*' unary_expression  */
+#line 643 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::DEREFERENCE, (yyvsp[0].expression)}; }
+#line 2685 "src/parsing/parser.cpp"
     break;
 
-  case 105:
-/* Line 1802 of yacc.c  */
-#line 581 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, (yyvsp[(2) - (2)].expression)}; }
+  case 120: /* unary_expression: '&' unary_expression  */
+#line 644 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, (yyvsp[0].expression)}; }
+#line 2691 "src/parsing/parser.cpp"
     break;
 
-  case 106:
-/* Line 1802 of yacc.c  */
-#line 585 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 121: /* unary_expression: AND unary_expression  */
+#line 645 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, (yyvsp[0].expression)}; }
+#line 2697 "src/parsing/parser.cpp"
     break;
 
-  case 107:
-/* Line 1802 of yacc.c  */
-#line 586 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::IdentifierExpression{(yyvsp[(1) - (1)].identifier)}; }
+  case 122: /* operand: literal  */
+#line 649 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2703 "src/parsing/parser.cpp"
     break;
 
-  case 108:
-/* Line 1802 of yacc.c  */
-#line 587 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(2) - (3)].expression); }
+  case 123: /* operand: IDENTIFIER  */
+#line 650 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::IdentifierExpression{(yyvsp[0].identifier)}; }
+#line 2709 "src/parsing/parser.cpp"
     break;
 
-  case 109:
-/* Line 1802 of yacc.c  */
-#line 591 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 124: /* operand: '(' expression ')'  */
+#line 651 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[-1].expression); }
+#line 2715 "src/parsing/parser.cpp"
     break;
 
-  case 110:
-/* Line 1802 of yacc.c  */
-#line 592 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 125: /* literal: basic_literal  */
+#line 655 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2721 "src/parsing/parser.cpp"
+    break;
+
+  case 126: /* literal: composite_literal  */
+#line 656 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2727 "src/parsing/parser.cpp"
     break;
 
-  case 111:
-/* Line 1802 of yacc.c  */
-#line 593 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::FunctionLiteralExpression{(yyvsp[(2) - (3)].type), (yyvsp[(3) - (3)].block)}; }
+  case 127: /* literal: FUNC function_signature block  */
+#line 657 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::FunctionLiteralExpression{(yyvsp[-1].type), (yyvsp[0].block)}; }
+#line 2733 "src/parsing/parser.cpp"
     break;
 
-  case 112:
-/* Line 1802 of yacc.c  */
-#line 597 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::BoolExpression{(yyvsp[(1) - (1)].boolean)}; }
+  case 128: /* basic_literal: BOOL_LITERAL  */
+#line 661 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::BoolExpression{(yyvsp[0].boolean)}; }
+#line 2739 "src/parsing/parser.cpp"
     break;
 
-  case 113:
-/* Line 1802 of yacc.c  */
-#line 598 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::IntExpression{(yyvsp[(1) - (1)].integer)}; }
+  case 129: /* basic_literal: INT_LITERAL  */
+#line 662 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::IntExpression{(yyvsp[0].integer)}; }
+#line 2745 "src/parsing/parser.cpp"
     break;
 
-  case 114:
-/* Line 1802 of yacc.c  */
-#line 599 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::Float32Expression{(yyvsp[(1) - (1)].floating)}; }
+  case 130: /* basic_literal: FLOAT_LITERAL  */
+#line 663 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::Float32Expression{(yyvsp[0].floating)}; }
+#line 2751 "src/parsing/parser.cpp"
     break;
 
-  case 115:
-/* Line 1802 of yacc.c  */
-#line 600 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::RuneExpression{(yyvsp[(1) - (1)].rune)}; }
+  case 131: /* basic_literal: RUNE_LITERAL  */
+#line 664 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::RuneExpression{(yyvsp[0].rune)}; }
+#line 2757 "src/parsing/parser.cpp"
     break;
 
-  case 116:
-/* Line 1802 of yacc.c  */
-#line 601 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::StringExpression{(yyvsp[(1) - (1)].string).string, (yyvsp[(1) - (1)].string).length}; }
+  case 132: /* basic_literal: STRING_LITERAL  */
+#line 665 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::StringExpression{(yyvsp[0].string).string, (yyvsp[0].string).length}; }
+#line 2763 "src/parsing/parser.cpp"
     break;
 
-  case 117:
-/* Line 1802 of yacc.c  */
-#line 605 "src/parsing/parser.y"
-    {
+  case 133: /* expression_list: expression  */
+#line 669 "src/parsing/parser.y"
+                                            {
                                                 auto list = new LinkedList<AST::Expression *>{}; 
-                                                list->insert(0, (yyvsp[(1) - (1)].expression));
+                                                list->insert(0, (yyvsp[0].expression));
                                                 (yyval.expressions) = list;
                                                 
                                             }
+#line 2774 "src/parsing/parser.cpp"
     break;
 
-  case 118:
-/* Line 1802 of yacc.c  */
-#line 612 "src/parsing/parser.y"
-    {
-                                                auto list = (yyvsp[(3) - (3)].expressions);
-                                                list->insert(0, (yyvsp[(1) - (3)].expression));
+  case 134: /* expression_list: expression ',' expression_list  */
+#line 676 "src/parsing/parser.y"
+                                            {
+                                                auto list = (yyvsp[0].expressions);
+                                                list->insert(0, (yyvsp[-2].expression));
                                                 (yyval.expressions) = list;
                                             }
+#line 2784 "src/parsing/parser.cpp"
     break;
 
-  case 119:
-/* Line 1802 of yacc.c  */
-#line 620 "src/parsing/parser.y"
-    {
-                                                auto type = (yyvsp[(1) - (4)].type);
-                                                auto elements = (yyvsp[(3) - (4)].keyed_expressions)->toStdVector();
-                                                delete (yyvsp[(3) - (4)].keyed_expressions);
+  case 135: /* composite_literal: literal_type '{' element_list '}'  */
+#line 684 "src/parsing/parser.y"
+                                            {
+                                                auto type = (yyvsp[-3].type);
+                                                auto elements = (yyvsp[-1].keyed_expressions)->toStdVector();
+                                                delete (yyvsp[-1].keyed_expressions);
                                                 (yyval.expression) = new AST::CompositLiteralExpression(type, elements);
                                             }
+#line 2795 "src/parsing/parser.cpp"
     break;
 
-  case 120:
-/* Line 1802 of yacc.c  */
-#line 629 "src/parsing/parser.y"
-    { (yyval.keyed_expressions) = (yyvsp[(1) - (1)].keyed_expressions); }
+  case 136: /* composite_literal: literal_type '{' '}'  */
+#line 690 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::CompositLiteralExpression((yyvsp[-2].type), {}); }
+#line 2801 "src/parsing/parser.cpp"
     break;
 
-  case 121:
-/* Line 1802 of yacc.c  */
-#line 630 "src/parsing/parser.y"
-    {
+  case 137: /* composite_literal: composite_type BODY element_list '}'  */
+#line 692 "src/parsing/parser.y"
+                                            {
+                                                auto type = (yyvsp[-3].type);
+                                                auto elements = (yyvsp[-1].keyed_expressions)->toStdVector();
+                                                delete (yyvsp[-1].keyed_expressions);
+                                                (yyval.expression) = new AST::CompositLiteralExpression(type, elements);
+                                                bodyNext = true;
+                                            }
+#line 2813 "src/parsing/parser.cpp"
+    break;
+
+  case 138: /* composite_literal: composite_type BODY '}'  */
+#line 699 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::CompositLiteralExpression((yyvsp[-2].type), {}); bodyNext = true; }
+#line 2819 "src/parsing/parser.cpp"
+    break;
 
-                                                auto elements = (yyvsp[(1) - (3)].keyed_expressions)->toStdVector();
-                                                delete (yyvsp[(1) - (3)].keyed_expressions);
-                                                auto list = (yyvsp[(3) - (3)].keyed_expressions);
+  case 139: /* element_list: keyed_element  */
+#line 703 "src/parsing/parser.y"
+                                            { (yyval.keyed_expressions) = (yyvsp[0].keyed_expressions); }
+#line 2825 "src/parsing/parser.cpp"
+    break;
+
+  case 140: /* element_list: keyed_element ',' element_list  */
+#line 704 "src/parsing/parser.y"
+                                            {
+
+                                                auto elements = (yyvsp[-2].keyed_expressions)->toStdVector();
+                                                delete (yyvsp[-2].keyed_expressions);
+                                                auto list = (yyvsp[0].keyed_expressions);
                                                 for (int i = 0; i < elements.size(); ++i) {
                                                     list->insert(i, elements[i]);
                                                 }
                                                 (yyval.keyed_expressions) = list;
                                             }
+#line 2840 "src/parsing/parser.cpp"
     break;
 
-  case 122:
-/* Line 1802 of yacc.c  */
-#line 643 "src/parsing/parser.y"
-    {
-                                                auto list = new LinkedList<std::pair<std::string, AST::Expression*>>;
-                                                list->insert(0, std::make_pair((yyvsp[(1) - (3)].identifier), (yyvsp[(3) - (3)].expression)));
+  case 141: /* keyed_element: IDENTIFIER ':' expression  */
+#line 717 "src/parsing/parser.y"
+                                            {
+                                                auto list = new LinkedList<std::pair<Atom, AST::Expression*>>;
+                                                list->insert(0, std::make_pair((yyvsp[-2].identifier), (yyvsp[0].expression)));
                                                 (yyval.keyed_expressions) = list;
                                             }
+#line 2850 "src/parsing/parser.cpp"
     break;
 
-  case 123:
-/* Line 1802 of yacc.c  */
-#line 648 "src/parsing/parser.y"
-    {
-                                                auto list = new LinkedList<std::pair<std::string, AST::Expression*>>;
-                                                list->insert(0, std::make_pair("", (yyvsp[(1) - (1)].expression)));
+  case 142: /* keyed_element: expression  */
+#line 722 "src/parsing/parser.y"
+                                            {
+                                                auto list = new LinkedList<std::pair<Atom, AST::Expression*>>;
+                                                list->insert(0, std::make_pair("", (yyvsp[0].expression)));
                                                 (yyval.keyed_expressions) = list;
                                             }
+#line 2860 "src/parsing/parser.cpp"
     break;
 
-  case 124:
-/* Line 1802 of yacc.c  */
-#line 656 "src/parsing/parser.y"
-    { (yyval.expression) = (yyvsp[(1) - (1)].expression); }
+  case 143: /* primary_expression: operand  */
+#line 730 "src/parsing/parser.y"
+                                            { (yyval.expression) = (yyvsp[0].expression); }
+#line 2866 "src/parsing/parser.cpp"
     break;
 
-  case 125:
-/* Line 1802 of yacc.c  */
-#line 657 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::SelectExpression{(yyvsp[(1) - (3)].expression), (yyvsp[(3) - (3)].identifier)}; }
+  case 144: /* primary_expression: primary_expression '.' IDENTIFIER  */
+#line 731 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::SelectExpression{(yyvsp[-2].expression), (yyvsp[0].identifier)}; }
+#line 2872 "src/parsing/parser.cpp"
     break;
 
-  case 126:
-/* Line 1802 of yacc.c  */
-#line 658 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::IndexExpression{(yyvsp[(1) - (4)].expression), (yyvsp[(3) - (4)].expression)}; }
+  case 145: /* primary_expression: primary_expression '[' expression ']'  */
+#line 732 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::IndexExpression{(yyvsp[-3].expression), (yyvsp[-1].expression)}; }
+#line 2878 "src/parsing/parser.cpp"
     break;
 
-  case 127:
-/* Line 1802 of yacc.c  */
-#line 660 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::SimpleSliceExpression{(yyvsp[(1) - (6)].expression), (yyvsp[(3) - (6)].expression), (yyvsp[(5) - (6)].expression)}; }
+  case 146: /* primary_expression: primary_expression '[' optional_expression ':' optional_expression ']'  */
+#line 734 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::SimpleSliceExpression{(yyvsp[-5].expression), (yyvsp[-3].expression), (yyvsp[-1].expression)}; }
+#line 2884 "src/parsing/parser.cpp"
     break;
 
-  case 128:
-/* Line 1802 of yacc.c  */
-#line 662 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::FullSliceExpression{(yyvsp[(1) - (8)].expression), (yyvsp[(3) - (8)].expression), (yyvsp[(5) - (8)].expression), (yyvsp[(7) - (8)].expression)}; }
+  case 147: /* primary_expression: primary_expression '[' optional_expression ':' expression ':' expression ']'  */
+#line 736 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::FullSliceExpression{(yyvsp[-7].expression), (yyvsp[-5].expression), (yyvsp[-3].expression), (yyvsp[-1].expression)}; }
+#line 2890 "src/parsing/parser.cpp"
     break;
 
-  case 129:
-/* Line 1802 of yacc.c  */
-#line 664 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::CallExpression{(yyvsp[(1) - (3)].expression), {}}; }
+  case 148: /* primary_expression: primary_expression '(' ')'  */
+#line 738 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::CallExpression{(yyvsp[-2].expression), {}, (yylsp[-1]).first_line}; }
+#line 2896 "src/parsing/parser.cpp"
     break;
 
-  case 130:
-/* Line 1802 of yacc.c  */
-#line 666 "src/parsing/parser.y"
-    { (yyval.expression) = new AST::CallExpression{(yyvsp[(1) - (4)].expression), (yyvsp[(3) - (4)].expressions)->toStdVector()}; }
+  case 149: /* primary_expression: primary_expression '(' expression_list ')'  */
+#line 740 "src/parsing/parser.y"
+                                            { (yyval.expression) = makeCall((yyvsp[-3].expression), (yyvsp[-1].expressions)->toStdVector(), (yylsp[-2]).first_line); }
+#line 2902 "src/parsing/parser.cpp"
     break;
 
-  case 131:
-/* Line 1802 of yacc.c  */
-#line 672 "src/parsing/parser.y"
-    {
-                                                auto list = new LinkedList<std::string>{}; 
-                                                list->insert(0, (yyvsp[(1) - (1)].identifier));
+  case 150: /* primary_expression: INT '(' expression ')'  */
+#line 741 "src/parsing/parser.y"
+                                            { (yyval.expression) = new AST::ConversionExpression{new AST::IntType{}, (yyvsp[-1].expression)}; }
+#line 2908 "src/parsing/parser.cpp"
+    break;
+
+  case 151: /* identifier_list: IDENTIFIER  */
+#line 747 "src/parsing/parser.y"
+                                            {
+                                                auto list = new LinkedList<Atom>{}; 
+                                                list->insert(0, (yyvsp[0].identifier));
                                                 (yyval.id_list) = list;
-                                                delete (yyvsp[(1) - (1)].identifier);
                                             }
+#line 2918 "src/parsing/parser.cpp"
     break;
 
-  case 132:
-/* Line 1802 of yacc.c  */
-#line 679 "src/parsing/parser.y"
-    {
-                                                auto list = (yyvsp[(3) - (3)].id_list);
-                                                list->insert(0, (yyvsp[(1) - (3)].identifier));
+  case 152: /* identifier_list: IDENTIFIER ',' identifier_list  */
+#line 753 "src/parsing/parser.y"
+                                            {
+                                                auto list = (yyvsp[0].id_list);
+                                                list->insert(0, (yyvsp[-2].identifier));
                                                 (yyval.id_list) = list;
-                                                delete (yyvsp[(1) - (3)].identifier);
                                             }
+#line 2928 "src/parsing/parser.cpp"
     break;
 
 
-/* Line 1802 of yacc.c  */
-#line 2950 "src/parsing/parser.cpp"
+#line 2932 "src/parsing/parser.cpp"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2960,97 +2943,60 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, &yylloc);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -3062,15 +3008,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3083,29 +3027,30 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -3116,13 +3061,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3133,26 +3076,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -3161,31 +3108,25 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval, &yylloc);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-/* Line 2050 of yacc.c  */
-#line 687 "src/parsing/parser.y"
+#line 760 "src/parsing/parser.y"
 
 
 void yyerror(char *s)
@@ -3196,4 +3137,4 @@ void yyerror(char *s)
     } else {
         std::cerr  << "unexpected \'" << yytext << "\'." << std::endl;
     }
-}
\ No newline at end of file
+}
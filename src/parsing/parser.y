@@ -1,13 +1,49 @@
 %locations
 %defines "include/parsing/parser.hpp"
+%define api.header.include {"parsing/parser.hpp"}
 
 %code {
+    #include <algorithm>
     #include <iostream>
+    #include <iterator>
     #include <string>
     #include "lexing/lexer.hpp"
     AST::Program *tree;
 
     void yyerror(char *s);
+
+    // Set by the lexer when the next `{` opens the body of an if, for or switch statement
+    extern bool bodyNext;
+
+    // Predeclared type names the lexer reads as identifiers
+    bool isSizedInt(Atom id)
+    {
+        static const Atom names[] = {"int8", "int16", "int32", "int64", "uint8", "uint16", "uint32", "uint64", "byte"};
+        return std::find(std::begin(names), std::end(names), id) != std::end(names);
+    }
+
+    // `new(T)` parses as a call, the argument names the type, and so do conversions to sized integers
+    AST::Expression *makeCall(AST::Expression *callee, std::vector<AST::Expression *> arguments, long line)
+    {
+        auto function = dynamic_cast<AST::IdentifierExpression *>(callee);
+
+        if (function != nullptr && arguments.size() == 1 && isSizedInt(function->getId())) {
+            auto expression = new AST::ConversionExpression{new AST::CustomType{function->getId()}, arguments[0]};
+            delete callee;
+            return expression;
+        }
+
+        auto type = arguments.size() == 1 ? dynamic_cast<AST::IdentifierExpression *>(arguments[0]) : nullptr;
+
+        if (function == nullptr || type == nullptr || !(function->getId() == Atom{"new"})) {
+            return new AST::CallExpression{callee, arguments, line};
+        }
+
+        auto expression = new AST::NewExpression{new AST::CustomType{type->getId()}};
+        delete callee;
+        delete type;
+        return expression;
+    }
 }
 
 %code requires {
@@ -24,11 +60,11 @@
 }
 
 %union {
-    int integer;
+    long integer;
     float floating;
     bool boolean;
     char rune;
-    char *identifier;
+    Atom identifier;
     str string;
 
     AST::Block *block;
@@ -48,10 +84,10 @@
 
     AST::Expression *expression;
     LinkedList<AST::Expression *> *expressions;
-    LinkedList<std::pair<std::string, AST::Expression *>> *keyed_expressions;
+    LinkedList<std::pair<Atom, AST::Expression *>> *keyed_expressions;
 
-    LinkedList<std::string> *id_list;
-    LinkedList<std::pair<std::string, AST::Type *>> *fields;
+    LinkedList<Atom> *id_list;
+    LinkedList<std::pair<Atom, AST::Type *>> *fields;
 }
 
 %start start // entry point of parsing
@@ -87,6 +123,7 @@
 %token GTE
 %token SHIFT_LEFT
 %token SHIFT_RIGHT
+%token BODY
 
 %token<identifier> IDENTIFIER
 %token<integer> INT_LITERAL
@@ -97,6 +134,7 @@
 
 %type<type> type
 %type<type> literal_type
+%type<type> composite_type
 %type<type> function_signature
 %type<integer> array_length
 %type<id_list> identifier_list
@@ -106,6 +144,7 @@
 %type<fields> struct_field_decls
 
 %type<block> block
+%type<block> body
 
 %type<statements> statement
 %type<statements> statement_list
@@ -166,8 +205,13 @@ type
     ;
 
 literal_type
-    : IDENTIFIER                            { $$ = new AST::CustomType{$1}; delete $1; }
-    | '[' array_length ']' type             { $$ = new AST::ArrayType{$2, $4}; }
+    : IDENTIFIER                            { $$ = new AST::CustomType{$1}; }
+    | composite_type                        { $$ = $1; }
+    ;
+
+// Literal types other than names, their literals can open with BODY
+composite_type
+    : '[' array_length ']' type             { $$ = new AST::ArrayType{$2, $4}; }
     | '[' ']' type                          { $$ = new AST::SliceType{$3}; }
     | STRUCT '{' struct_field_decls '}'     { $$ = new AST::StructType{$3->toStdVector()}; delete $3; }
     | MAP '[' type ']' type                 { $$ = new AST::MapType{$3, $5}; }
@@ -187,18 +231,18 @@ function_signature
     ;
 
 function_result
-    :                                       { $$ = new LinkedList<std::pair<std::string, AST::Type *>>; }
+    :                                       { $$ = new LinkedList<std::pair<Atom, AST::Type *>>; }
     | function_parameters                   { $$ = $1; }
     | type                                  { 
                                                 auto type = $1;
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 list->insert(0, std::make_pair("", type));
                                                 $$ = list;
                                             }
     ;
 
 function_parameters
-    : '(' ')'                               { $$ = new LinkedList<std::pair<std::string, AST::Type *>>; }
+    : '(' ')'                               { $$ = new LinkedList<std::pair<Atom, AST::Type *>>; }
     | '(' function_parameter_list ')'
                                             { $$ = $2; }
     | '(' function_parameter_list ',' ')'
@@ -208,7 +252,7 @@ function_parameters
 function_parameter_list
     : type                                  { 
                                                 auto type = $1;
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 list->insert(0, std::make_pair("", type));
                                                 $$ = list;
                                             }
@@ -217,7 +261,7 @@ function_parameter_list
                                                 auto ids = $1->toStdVector();
                                                 delete $1;
                                                 auto type = $2;
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
@@ -249,7 +293,7 @@ struct_field_decls
                                                 auto ids = $1->toStdVector();
                                                 delete $1;
                                                 auto type = $2;
-                                                auto list = new LinkedList<std::pair<std::string, AST::Type *>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Type *>>;
                                                 for (int i = 0; i < ids.size(); i++) {
                                                     list->insert(i, std::make_pair(ids[i], type));
                                                 }
@@ -273,6 +317,11 @@ block
     : '{' statement_list '}'                { $$ = new AST::Block{$2->toStdVector()}; delete $2; }
     ;
 
+// Block of an if, for or switch statement, the lexer returns BODY for its `{`
+body
+    : BODY statement_list '}'               { $$ = new AST::Block{$2->toStdVector()}; delete $2; }
+    ;
+
 // declarations
 top_level_declaration
     : declaration                           {
@@ -330,8 +379,8 @@ type_decl
     ;
 
 type_spec
-    : IDENTIFIER '=' type                   { $$ = new AST::TypeAliasDeclaration{$1, $3}; delete $1; }
-    | IDENTIFIER type                       { $$ = new AST::TypeDefinitionDeclaration{$1, $2}; delete $1; }
+    : IDENTIFIER '=' type                   { $$ = new AST::TypeAliasDeclaration{$1, $3}; }
+    | IDENTIFIER type                       { $$ = new AST::TypeDefinitionDeclaration{$1, $2}; }
     ;
 
 type_spec_list
@@ -447,6 +496,19 @@ simple_statement
                                                 delete $1;
                                                 delete $3;
                                             }
+    | expression INC                        { $$ = new AST::IncDecStatement{$1, 1}; }
+    | expression DEC                        { $$ = new AST::IncDecStatement{$1, -1}; }
+    // The operator and '=' are separate tokens. The target is resolved once, TargetExpression reads it
+    | expression '+' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::ADD, new AST::TargetExpression{}, $4}}; }
+    | expression '-' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::SUB, new AST::TargetExpression{}, $4}}; }
+    | expression '|' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_OR, new AST::TargetExpression{}, $4}}; }
+    | expression '^' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_XOR, new AST::TargetExpression{}, $4}}; }
+    | expression '&' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::BW_AND, new AST::TargetExpression{}, $4}}; }
+    | expression '*' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::MULT, new AST::TargetExpression{}, $4}}; }
+    | expression '/' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::DIV, new AST::TargetExpression{}, $4}}; }
+    | expression '%' '=' expression         { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::MOD, new AST::TargetExpression{}, $4}}; }
+    | expression SHIFT_LEFT '=' expression  { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_LEFT, new AST::TargetExpression{}, $4}}; }
+    | expression SHIFT_RIGHT '=' expression { $$ = new AST::CompoundAssignmentStatement{$1, new AST::BinaryExpression{AST::BinaryExpression::Operation::SHIFT_RIGHT, new AST::TargetExpression{}, $4}}; }
     ;
 
 statement_list
@@ -467,15 +529,15 @@ statement_list
     ;
 
 if_statement
-    : IF expression block                   { $$ = new AST::IfStatement{$2, $3, new AST::Block{{}}}; }
-    | IF expression block ELSE if_statement 
+    : IF expression body                    { $$ = new AST::IfStatement{$2, $3, new AST::Block{{}}}; }
+    | IF expression body ELSE if_statement 
                                             { $$ = new AST::IfStatement{$2, $3, new AST::Block{{$5}}}; }
-    | IF expression block ELSE block        
+    | IF expression body ELSE block         
                                             { $$ = new AST::IfStatement{$2, $3, $5}; }
     ;
 
 switch_statement
-    : SWITCH expression '{' switch_clause_list '}'
+    : SWITCH expression BODY switch_clause_list '}'
                                             {
                                                 $$ = new AST::SwitchStatement{$2, $4->toStdVector()};
                                                 delete $4;
@@ -514,6 +576,7 @@ return_statement
                                                 $$ = new AST::ReturnStatement{$2->toStdVector()}; 
                                                 delete $2;
                                             }
+    | RETURN                                { $$ = new AST::ReturnStatement{{}}; }
     ;
 
 for_statement
@@ -521,11 +584,11 @@ for_statement
     ;
 
 for_condition_statement
-    : FOR simple_statement ';' expression ';' simple_statement block
+    : FOR simple_statement ';' expression ';' simple_statement body
                                             {
                                                 $$ = new AST::ForConditionStatement{$2, $4, $6, $7};
                                             }
-    | FOR expression block
+    | FOR expression body
                                             {
                                                 $$ = new AST::ForConditionStatement{
                                                     new AST::EmptyStatement{}, 
@@ -533,7 +596,7 @@ for_condition_statement
                                                     new AST::EmptyStatement{}, 
                                                     $3};
                                             }
-    | FOR block
+    | FOR body
                                             {
                                                 $$ = new AST::ForConditionStatement{
                                                     new AST::EmptyStatement{}, 
@@ -579,6 +642,7 @@ unary_expression
     | '^' unary_expression                  { $$ = new AST::UnaryExpression{AST::UnaryExpression::Operation::BW_NOT, $2}; }
     | '*' unary_expression                  { $$ = new AST::UnaryExpression{AST::UnaryExpression::Operation::DEREFERENCE, $2}; }
     | '&' unary_expression                  { $$ = new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, $2}; }
+    | AND unary_expression                  { $$ = new AST::UnaryExpression{AST::UnaryExpression::Operation::REFERENCE, $2}; }
     ;
 
 operand
@@ -623,6 +687,16 @@ composite_literal
                                                 delete $3;
                                                 $$ = new AST::CompositLiteralExpression(type, elements);
                                             }   
+    | literal_type '{' '}'                  { $$ = new AST::CompositLiteralExpression($1, {}); }
+    // In a statement header, the `{` of the statement's body follows the literal
+    | composite_type BODY element_list '}'  {
+                                                auto type = $1;
+                                                auto elements = $3->toStdVector();
+                                                delete $3;
+                                                $$ = new AST::CompositLiteralExpression(type, elements);
+                                                bodyNext = true;
+                                            }
+    | composite_type BODY '}'               { $$ = new AST::CompositLiteralExpression($1, {}); bodyNext = true; }
     ;
 
 element_list
@@ -641,12 +715,12 @@ element_list
 
 keyed_element
     : IDENTIFIER ':' expression             {
-                                                auto list = new LinkedList<std::pair<std::string, AST::Expression*>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Expression*>>;
                                                 list->insert(0, std::make_pair($1, $3));
                                                 $$ = list;
                                             }
     | expression                            {
-                                                auto list = new LinkedList<std::pair<std::string, AST::Expression*>>;
+                                                auto list = new LinkedList<std::pair<Atom, AST::Expression*>>;
                                                 list->insert(0, std::make_pair("", $1));
                                                 $$ = list;
                                             }
@@ -661,26 +735,25 @@ primary_expression
     | primary_expression '[' optional_expression ':' expression ':' expression ']' 
                                             { $$ = new AST::FullSliceExpression{$1, $3, $5, $7}; }
     | primary_expression '(' ')'
-                                            { $$ = new AST::CallExpression{$1, {}}; }
+                                            { $$ = new AST::CallExpression{$1, {}, @2.first_line}; }
     | primary_expression '(' expression_list ')'
-                                            { $$ = new AST::CallExpression{$1, $3->toStdVector()}; }
+                                            { $$ = makeCall($1, $3->toStdVector(), @2.first_line); }
+    | INT '(' expression ')'                { $$ = new AST::ConversionExpression{new AST::IntType{}, $3}; }
     /* | type '(' expression ')'               { $$ = new AST::ConversionExpression($1, $3); } */
     ;
 
 // Miscellaneous
 identifier_list
     : IDENTIFIER                            {
-                                                auto list = new LinkedList<std::string>{}; 
+                                                auto list = new LinkedList<Atom>{}; 
                                                 list->insert(0, $1);
                                                 $$ = list;
-                                                delete $1;
                                             }
     | IDENTIFIER ',' identifier_list    
                                             {
                                                 auto list = $3;
                                                 list->insert(0, $1);
                                                 $$ = list;
-                                                delete $1;
                                             }
     ;
 
@@ -0,0 +1,49 @@
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+
+#include "utils/atom.hpp"
+
+namespace {
+
+    // Names never move once interned, the index is keyed by views into them
+    struct Table
+    {
+        std::deque<std::string> names{""};
+        std::unordered_map<std::string_view, uint32_t> indices{{names.front(), 0}};
+    };
+
+    Table& table()
+    {
+        static Table atoms;
+        return atoms;
+    }
+
+    uint32_t intern(std::string_view name)
+    {
+        auto& atoms = table();
+        auto found = atoms.indices.find(name);
+
+        if (found != atoms.indices.end()) return found->second;
+
+        uint32_t index = atoms.names.size();
+        atoms.names.emplace_back(name);
+        atoms.indices.emplace(atoms.names.back(), index);
+
+        return index;
+    }
+
+}
+
+Atom::Atom(const char *name)
+    : index{intern(name)}
+{}
+
+Atom::Atom(const std::string& name)
+    : index{intern(name)}
+{}
+
+const std::string& Atom::str() const
+{
+    return table().names[index];
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/counters.hpp"
+
+namespace {
+
+    struct Event
+    {
+        std::string function;
+        char phase; // 'B'egin or 'E'nd
+        double timestamp; // Microseconds since the first event
+    };
+
+    std::map<std::string_view, long>& counts()
+    {
+        static std::map<std::string_view, long> counts;
+        return counts;
+    }
+
+    std::vector<Event>& events()
+    {
+        static std::vector<Event> events;
+        return events;
+    }
+
+    double now()
+    {
+        static auto start = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::string escape(const std::string& string)
+    {
+        std::string escaped;
+
+        for (auto c : string) {
+            if (c == '"' || c == '\\') escaped += '\\';
+            escaped += c;
+        }
+
+        return escaped;
+    }
+
+}
+
+void Counters::increment(const char *name)
+{
+    ++counts()[name];
+}
+
+void Counters::enter(const std::string& function)
+{
+    events().push_back(Event{function, 'B', now()});
+}
+
+void Counters::exit(const std::string& function)
+{
+    events().push_back(Event{function, 'E', now()});
+}
+
+Counters::Trace::Trace(std::string function)
+    : function{std::move(function)}
+{
+    enter(this->function);
+}
+
+Counters::Trace::~Trace()
+{
+    exit(function);
+}
+
+void Counters::printSummary(std::ostream& out)
+{
+    std::vector<std::pair<std::string_view, long>> sorted{counts().begin(), counts().end()};
+
+    std::sort(sorted.begin(), sorted.end(), [](const auto& first, const auto& second) {
+        return first.second > second.second;
+    });
+
+    out << std::left << std::setw(32) << "counter" << std::right << std::setw(14) << "count" << std::endl;
+
+    for (const auto& entry : sorted) {
+        out << std::left << std::setw(32) << entry.first << std::right << std::setw(14) << entry.second << std::endl;
+    }
+}
+
+void Counters::writeTrace(std::ostream& out)
+{
+    out << "{\"traceEvents\":[";
+
+    for (long i = 0; i < events().size(); ++i) {
+        const auto& event = events()[i];
+
+        out << (i == 0 ? "\n" : ",\n")
+            << "{\"name\":\"" << escape(event.function) << "\",\"ph\":\"" << event.phase
+            << "\",\"ts\":" << std::fixed << std::setprecision(3) << event.timestamp << ",\"pid\":1,\"tid\":1}";
+    }
+
+    out << "\n]}" << std::endl;
+}
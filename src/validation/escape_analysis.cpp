@@ -0,0 +1,577 @@
+#include <algorithm>
+
+#include "validation/escape_analysis.hpp"
+
+EscapeAnalysis::EscapeAnalysis()
+    : functions{}, values{}, targets{}
+{}
+
+bool EscapeAnalysis::isLocal(Atom id) const
+{
+    for (const auto& function : functions) {
+        if (function.locals.contains(id)) return true;
+    }
+
+    return false;
+}
+
+void EscapeAnalysis::declare(Atom id)
+{
+    if (!functions.empty()) functions.back().locals.insert(id);
+}
+
+void EscapeAnalysis::push()
+{
+    values.push(Sources{});
+}
+
+void EscapeAnalysis::escape(const Sources& sources)
+{
+    if (functions.empty()) return;
+
+    auto& function = functions.back();
+
+    for (auto reference : sources.references) {
+        function.references[reference].escaped = true;
+    }
+
+    for (auto local : sources.locals) {
+        function.leaked.insert(local);
+    }
+}
+
+void EscapeAnalysis::store(const Target& target, const Sources& sources)
+{
+    if (!target.local) {
+        escape(sources);
+        return;
+    }
+
+    auto& flow = functions.back().flows[target.id];
+    flow.references.insert(flow.references.end(), sources.references.begin(), sources.references.end());
+    flow.locals.insert(flow.locals.end(), sources.locals.begin(), sources.locals.end());
+}
+
+void EscapeAnalysis::finishFunction()
+{
+    auto& function = functions.back();
+
+    std::vector<Atom> pending{function.leaked.begin(), function.leaked.end()};
+
+    while (!pending.empty()) {
+        auto local = pending.back();
+        pending.pop_back();
+
+        auto flow = function.flows.find(local);
+        if (flow == function.flows.end()) continue;
+
+        for (auto reference : flow->second.references) {
+            function.references[reference].escaped = true;
+        }
+
+        for (auto source : flow->second.locals) {
+            if (function.leaked.insert(source).second) pending.push_back(source);
+        }
+    }
+
+    for (const auto& reference : function.references) {
+        *reference.escapes = reference.escaped;
+    }
+
+    functions.pop_back();
+}
+
+void EscapeAnalysis::visitProgram(long size)
+{}
+
+void EscapeAnalysis::visitBoolType()
+{}
+
+void EscapeAnalysis::visitIntType()
+{}
+
+void EscapeAnalysis::visitFloat32Type()
+{}
+
+void EscapeAnalysis::visitRuneType()
+{}
+
+void EscapeAnalysis::visitStringType()
+{}
+
+void EscapeAnalysis::visitArrayType(long size)
+{}
+
+void EscapeAnalysis::visitSliceType()
+{}
+
+void EscapeAnalysis::visitStructType(std::vector<Atom> fields)
+{}
+
+void EscapeAnalysis::visitPointerType()
+{}
+
+void EscapeAnalysis::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
+{
+    // Parameters and named results are locals of the function being entered
+    for (auto parameter : parameters) declare(parameter);
+    for (auto result : returns) declare(result);
+}
+
+void EscapeAnalysis::visitMapType()
+{}
+
+void EscapeAnalysis::visitCustomType(Atom id)
+{}
+
+void EscapeAnalysis::visitBlock(AST::Visits visitStatements)
+{
+    visitStatements();
+}
+
+void EscapeAnalysis::visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody)
+{
+    functions.push_back(Function{});
+    visitSignature();
+    visitBody();
+    finishFunction();
+}
+
+void EscapeAnalysis::visitTypeAliasDeclaration(Atom id, AST::Visit visitType)
+{}
+
+void EscapeAnalysis::visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType)
+{}
+
+void EscapeAnalysis::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
+{
+    auto sources = values.pop(expression_count);
+    std::reverse(sources.begin(), sources.end());
+
+    for (auto id : ids) declare(id);
+
+    for (long i = 0; i < expression_count; ++i) {
+        if (i < ids.size() && isLocal(ids[i])) {
+            store(Target{true, ids[i]}, sources[i]);
+        } else {
+            escape(sources[i]);
+        }
+    }
+}
+
+void EscapeAnalysis::visitExpressionStatement()
+{
+    values.pop();
+}
+
+void EscapeAnalysis::visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs)
+{
+    auto lhsSize = visitLhs();
+    auto rhsSize = visitRhs();
+
+    auto stores = targets.pop(lhsSize);
+    auto sources = values.pop(rhsSize);
+    std::reverse(stores.begin(), stores.end());
+    std::reverse(sources.begin(), sources.end());
+
+    for (long i = 0; i < rhsSize; ++i) {
+        if (i < lhsSize && lhsSize == rhsSize) {
+            store(stores[i], sources[i]);
+        } else {
+            escape(sources[i]);
+        }
+    }
+}
+
+void EscapeAnalysis::visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate)
+{
+    // Only arithmetic updates, no pointer is stored
+    visitTarget();
+    visitUpdate();
+    values.pop();
+    targets.pop();
+}
+
+void EscapeAnalysis::visitIncDecStatement(AST::Visit visitTarget, long delta)
+{
+    visitTarget();
+    targets.pop();
+}
+
+void EscapeAnalysis::visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse)
+{
+    values.pop();
+    visitTrue();
+    visitFalse();
+}
+
+void EscapeAnalysis::visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table)
+{
+    visitExpression();
+    values.pop();
+    visitClauses();
+}
+
+void EscapeAnalysis::visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements)
+{
+    for (const auto visitExpression : visitExpressions) {
+        visitExpression();
+        values.pop();
+    }
+
+    visitStatements();
+}
+
+void EscapeAnalysis::visitSwitchDefaultClause(AST::Visits visitStatements)
+{
+    visitStatements();
+}
+
+void EscapeAnalysis::visitReturnStatement(long size)
+{
+    for (const auto& sources : values.pop(size)) {
+        escape(sources);
+    }
+}
+
+void EscapeAnalysis::visitBreakStatement()
+{}
+
+void EscapeAnalysis::visitContinueStatement()
+{}
+
+void EscapeAnalysis::visitEmptyStatement()
+{}
+
+void EscapeAnalysis::visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody)
+{
+    visitInit();
+    visitCondition();
+    values.pop();
+    visitPost();
+    visitBody();
+}
+
+void EscapeAnalysis::visitBoolExpression(bool value)
+{
+    push();
+}
+
+void EscapeAnalysis::visitIntExpression(long value)
+{
+    push();
+}
+
+void EscapeAnalysis::visitFloat32Expression(float value)
+{
+    push();
+}
+
+void EscapeAnalysis::visitRuneExpression(char value)
+{
+    push();
+}
+
+void EscapeAnalysis::visitStringExpression(char *value, long length)
+{
+    push();
+}
+
+void EscapeAnalysis::visitConstantExpression(long index, AST::Visit visitLiteral)
+{
+    visitLiteral();
+}
+
+void EscapeAnalysis::visitIdentifierExpression(Atom id)
+{
+    if (!isLocal(id)) {
+        push();
+        return;
+    }
+
+    values.push(Sources{{}, {id}});
+}
+
+void EscapeAnalysis::visitTargetExpression()
+{
+    push();
+}
+
+void EscapeAnalysis::visitCompositLiteralExpression(std::vector<Atom> keys)
+{
+    for (const auto& sources : values.pop(keys.size())) {
+        escape(sources);
+    }
+
+    push();
+}
+
+void EscapeAnalysis::VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody)
+{
+    // The closure copies every local in sight, it can outlive them
+    if (!functions.empty()) {
+        auto& function = functions.back();
+        function.leaked.insert(function.locals.begin(), function.locals.end());
+    }
+
+    functions.push_back(Function{});
+    visitSignature();
+    visitBody();
+    finishFunction();
+
+    push();
+}
+
+void EscapeAnalysis::visitSelectExpression(Atom id, long& fieldIndex)
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitIndexExpression(long& length, bool checked)
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared)
+{
+    values.pop(1 + lowDeclared + highDeclared);
+    push();
+}
+
+void EscapeAnalysis::visitFullSliceExpression(bool lowDeclared)
+{
+    values.pop(3 + lowDeclared);
+    push();
+}
+
+void EscapeAnalysis::visitCallExpression(long size, long line, bool tailCall)
+{
+    for (const auto& sources : values.pop(size)) {
+        escape(sources);
+    }
+
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitConversionExpression()
+{}
+
+void EscapeAnalysis::visitNewExpression(AST::Visit visitType)
+{
+    push();
+}
+
+void EscapeAnalysis::visitUnaryPlusExpression()
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitUnaryNegateExpression()
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitUnaryLogicalNotExpression()
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitUnaryBitwiseNotExpression()
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitUnaryDereferenceExpression()
+{
+    values.pop();
+    push();
+}
+
+void EscapeAnalysis::visitUnaryReferenceExpression(bool& escapes)
+{
+    auto target = targets.pop();
+
+    // Globals, elements, fields and literals are on the heap already
+    if (!target.local) {
+        push();
+        return;
+    }
+
+    // Whatever the local holds can be read back through the pointer
+    auto& function = functions.back();
+    function.leaked.insert(target.id);
+    function.references.push_back(Reference{&escapes, false});
+
+    values.push(Sources{{static_cast<long>(function.references.size()) - 1}, {}});
+}
+
+void EscapeAnalysis::visitBinaryLogicalOrExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryLogicalAndExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryEqualExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryNotEqualExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryLessThanExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryLessThanEqualExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryGreaterThanExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryGreaterThanEqualExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryShiftLeftExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryShiftRightExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryAddExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinarySubtractExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryBitwiseOrExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryBitwiseXOrExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryBitwiseAndExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryMultiplyExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryDivideExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitBinaryModuloExpression()
+{
+    values.pop(2);
+    push();
+}
+
+void EscapeAnalysis::visitIdentifierStore(Atom id)
+{
+    targets.push(Target{isLocal(id), id});
+}
+
+void EscapeAnalysis::visitSelectStore(Atom id, long& fieldIndex)
+{
+    targets.pop();
+    targets.push(Target{false, {}});
+}
+
+void EscapeAnalysis::visitIndexStore(long& length, bool checked)
+{
+    values.pop();
+    targets.pop();
+    targets.push(Target{false, {}});
+}
+
+void EscapeAnalysis::visitDereferenceStore()
+{
+    values.pop();
+    targets.push(Target{false, {}});
+}
+
+void EscapeAnalysis::visitLiteralStore()
+{
+    values.pop();
+    targets.push(Target{false, {}});
+}
+
+void EscapeAnalysis::visitValueStore()
+{
+    values.pop();
+    targets.push(Target{false, {}});
+}
+
+void EscapeAnalysis::visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void EscapeAnalysis::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void EscapeAnalysis::visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void EscapeAnalysis::visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
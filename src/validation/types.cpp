@@ -1,55 +1,112 @@
+#include <cstdint>
+
 #include "validation/types.hpp"
 
+namespace {
+
+    std::string address(const Type *type)
+    {
+        return std::to_string(reinterpret_cast<std::uintptr_t>(type));
+    }
+
+    std::string addresses(const std::vector<std::pair<Atom, Type *>>& pairs)
+    {
+        std::string key;
+
+        for (const auto& pair : pairs) {
+            key += pair.first + ":" + address(pair.second) + ",";
+        }
+
+        return key;
+    }
+
+}
+
+bool Type::equals(const Type& other) const
+{
+    return this == &other;
+}
+
+std::string Type::toString() const
+{
+    if (description.empty()) description = describe();
+    return description;
+}
+
 bool Type::composable() const {
     return false;
 }
 
-bool BoolType::equals(const Type& other) const 
+std::string BoolType::describe() const
 {
-    return instanceof<BoolType>(&other);
+    return "Bool";
 }
 
-std::string BoolType::toString() const
+std::string BoolType::key() const
 {
     return "Bool";
 }
 
-bool IntType::equals(const Type& other) const 
+std::string IntType::describe() const
 {
-    return instanceof<IntType>(&other);
+    return "Int";
 }
 
-std::string IntType::toString() const
+std::string IntType::key() const
 {
     return "Int";
 }
 
-bool Float32Type::equals(const Type& other) const 
+SizedIntType::SizedIntType(long bits, bool isSigned)
+    : bits{bits}, isSigned{isSigned}
+{}
+
+std::string SizedIntType::describe() const
+{
+    return (isSigned ? "Int" : "Uint") + std::to_string(bits);
+}
+
+std::string SizedIntType::key() const
+{
+    return describe();
+}
+
+long SizedIntType::getBits() const
 {
-    return instanceof<Float32Type>(&other);
+    return bits;
 }
 
-std::string Float32Type::toString() const
+bool SizedIntType::getSigned() const
+{
+    return isSigned;
+}
+
+std::string Float32Type::describe() const
 {
     return "Float32";
 }
 
-bool RuneType::equals(const Type& other) const 
+std::string Float32Type::key() const
 {
-    return instanceof<RuneType>(&other);
+    return "Float32";
 }
 
-std::string RuneType::toString() const
+std::string RuneType::describe() const
 {
     return "Rune";
 }
 
-bool StringType::equals(const Type& other) const 
+std::string RuneType::key() const
 {
-    return instanceof<StringType>(&other);
+    return "Rune";
+}
+
+std::string StringType::describe() const
+{
+    return "String";
 }
 
-std::string StringType::toString() const
+std::string StringType::key() const
 {
     return "String";
 }
@@ -58,23 +115,14 @@ ArrayType::ArrayType(Type *type, long size)
     : type{type}, size{size}
 {}
 
-ArrayType::~ArrayType()
+std::string ArrayType::describe() const
 {
-    delete type;
-}
-
-bool ArrayType::equals(const Type& other) const
-{
-    if (!instanceof<ArrayType>(&other)) return false;
-
-    const ArrayType& casted_other = (const ArrayType&) other;
-
-    return this->type->equals(*casted_other.type) && this->size == casted_other.size;
+    return "Array<" + this->type->toString() + ">[" + std::to_string(this->size) + "]";
 }
 
-std::string ArrayType::toString() const
+std::string ArrayType::key() const
 {
-    return "Array<" + this->type->toString() + ">[" + std::to_string(this->size) + "]";
+    return "Array<" + address(type) + ">[" + std::to_string(size) + "]";
 }
 
 bool ArrayType::composable() const 
@@ -87,27 +135,23 @@ Type *ArrayType::elementType() const
     return type;
 }
 
+long ArrayType::length() const
+{
+    return size;
+}
+
 SliceType::SliceType(Type *type) 
     : type{type}
 {}
 
-SliceType::~SliceType()
+std::string SliceType::describe() const
 {
-    delete type;
-}
-
-bool SliceType::equals(const Type& other) const
-{
-    if (!instanceof<SliceType>(&other)) return false;
-
-    const SliceType& casted_other = (const SliceType&) other;
-
-    return this->type->equals(*casted_other.type);
+    return "Slice<" + this->type->toString() + ">";
 }
 
-std::string SliceType::toString() const
+std::string SliceType::key() const
 {
-    return "Slice<" + this->type->toString() + ">";
+    return "Slice<" + address(type) + ">";
 }
 
 bool SliceType::composable() const {
@@ -119,39 +163,11 @@ Type *SliceType::elementType() const
     return type;
 }
 
-StructType::StructType(std::vector<std::pair<std::string, Type *>> fields)
+StructType::StructType(std::vector<std::pair<Atom, Type *>> fields)
     : fields{fields}
 {}
 
-StructType::~StructType()
-{
-    for (const auto field : fields)
-    {
-        delete field.second;
-    }
-}
-
-bool StructType::equals(const Type& other) const
-{
-    if (!instanceof<StructType>(&other)) return false;
-
-    const StructType& casted_other = (const StructType&) other;
-
-    if (this->fields.size() != casted_other.fields.size()) {
-        return false;
-    }
-
-    for (int i = 0; i < fields.size(); ++i) {
-        if (this->fields[i].first != casted_other.fields[i].first
-        || !this->fields[i].second->equals(*casted_other.fields[i].second)) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-std::string StructType::toString() const
+std::string StructType::describe() const
 {
     auto body = std::vector<std::string>{};
 
@@ -164,11 +180,16 @@ std::string StructType::toString() const
     return "Struct{" + res.str() + "}";
 }
 
+std::string StructType::key() const
+{
+    return "Struct{" + addresses(fields) + "}";
+}
+
 bool StructType::composable() const {
     return true;
 }
 
-bool StructType::hasField(std::string field) const
+bool StructType::hasField(Atom field) const
 {
     for (const auto _field : fields)
     {
@@ -178,7 +199,7 @@ bool StructType::hasField(std::string field) const
     return false;
 }
 
-Type *StructType::typeOfField(std::string field) const
+Type *StructType::typeOfField(Atom field) const
 {
     for (const auto _field : fields)
     {
@@ -188,27 +209,28 @@ Type *StructType::typeOfField(std::string field) const
     return nullptr;
 }
 
+long StructType::indexOfField(Atom field) const
+{
+    for (int i = 0; i < fields.size(); ++i)
+    {
+        if (fields[i].first == field) return i;
+    }
+
+    return -1;
+}
+
 PointerType::PointerType(Type *type) 
     : type{type}
 {}
 
-PointerType::~PointerType()
+std::string PointerType::describe() const
 {
-    delete type;
+    return this->type->toString() + "*";
 }
 
-bool PointerType::equals(const Type& other) const
+std::string PointerType::key() const
 {
-    if (!instanceof<PointerType>(&other)) return false;
-
-    const PointerType& casted_other = (const PointerType&) other;
-
-    return this->type->equals(*casted_other.type);
-}
-
-std::string PointerType::toString() const
-{
-    return this->type->toString() + "*";
+    return "Pointer<" + address(type) + ">";
 }
 
 Type *PointerType::underlyingType() const 
@@ -217,29 +239,16 @@ Type *PointerType::underlyingType() const
 }
 
 FunctionType::FunctionType(
-        std::vector<std::pair<std::string, Type *>> parameters,
-        std::vector<std::pair<std::string, Type *>> returns)
+        std::vector<std::pair<Atom, Type *>> parameters,
+        std::vector<std::pair<Atom, Type *>> returns)
     : parameters{parameters}, returns{returns}
 {}
 
-FunctionType::~FunctionType()
-{
-    for (const auto parameter : parameters) 
-    {
-        delete parameter.second;
-    }
-
-    for (const auto _return : returns) 
-    {
-        delete _return.second;
-    }
-}
-
 std::vector<Type *> FunctionType::getParameterTypes() const
 {
     std::vector<Type *> parameterTypes;
 
-    std::transform(parameters.begin(), parameters.end(), std::inserter(parameterTypes, parameterTypes.end()), [](const std::pair<std::string, Type*>& pair) { return pair.second; });
+    std::transform(parameters.begin(), parameters.end(), std::inserter(parameterTypes, parameterTypes.end()), [](const std::pair<Atom, Type*>& pair) { return pair.second; });
 
     return parameterTypes;
 }
@@ -248,53 +257,22 @@ std::vector<Type *> FunctionType::getReturnTypes() const
 {
     std::vector<Type *> returnTypes;
 
-    std::transform(returns.begin(), returns.end(), std::inserter(returnTypes, returnTypes.end()), [](const std::pair<std::string, Type*>& pair) { return pair.second; });
+    std::transform(returns.begin(), returns.end(), std::inserter(returnTypes, returnTypes.end()), [](const std::pair<Atom, Type*>& pair) { return pair.second; });
     
     return returnTypes;
 }
 
-std::vector<std::pair<std::string, Type *>> FunctionType::getParameters() const
+std::vector<std::pair<Atom, Type *>> FunctionType::getParameters() const
 {
     return parameters;
 }
 
-std::vector<std::pair<std::string, Type *>> FunctionType::getReturns() const
+std::vector<std::pair<Atom, Type *>> FunctionType::getReturns() const
 {
     return returns;
 }
 
-bool FunctionType::equals(const Type& other) const 
-{
-    if (!instanceof<FunctionType>(&other)) return false;
-
-    const FunctionType& casted_other = (const FunctionType&) other;
-
-    if (this->parameters.size() != casted_other.parameters.size()) {
-        return false;
-    }
-
-    if (this->returns.size() != casted_other.returns.size()) {
-        return false;
-    }
-
-    for (int i = 0; i < parameters.size(); ++i) {
-        if (this->parameters[i].first != casted_other.parameters[i].first
-        || !this->parameters[i].second->equals(*casted_other.parameters[i].second)) {
-            return false;
-        }
-    }
-
-    for (int i = 0; i < returns.size(); ++i) {
-        if (this->returns[i].first != casted_other.returns[i].first
-        || !this->returns[i].second->equals(*casted_other.returns[i].second)) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-std::string FunctionType::toString() const
+std::string FunctionType::describe() const
 {
     auto params = std::vector<std::string>{};
     auto rets = std::vector<std::string>{};
@@ -316,28 +294,23 @@ std::string FunctionType::toString() const
     return "Function(" + res_params.str() + ") -> (" + res_rets.str() + ")";
 }
 
+std::string FunctionType::key() const
+{
+    return "Function(" + addresses(parameters) + ")(" + addresses(returns) + ")";
+}
+
 MapType::MapType(Type *keyType, Type *elementType)
     : _keyType{keyType}, _elementType{elementType}
 {}
 
-MapType::~MapType() 
+std::string MapType::describe() const
 {
-    delete _keyType;
-    delete _elementType;
-}
-
-bool MapType::equals(const Type& other) const
-{
-    if (!instanceof<MapType>(&other)) return false;
-
-    const MapType& casted_other = (const MapType&) other;
-
-    return this->_keyType->equals(*casted_other._keyType) && this->_elementType->equals(*casted_other._elementType);
+    return "Map<" + this->_keyType->toString() + ", " + this->_elementType->toString() + ">";
 }
 
-std::string MapType::toString() const
+std::string MapType::key() const
 {
-    return "Map<" + this->_keyType->toString() + ", " + this->_elementType->toString() + ">";
+    return "Map<" + address(_keyType) + ", " + address(_elementType) + ">";
 }
 
 bool MapType::composable() const {
@@ -357,23 +330,9 @@ Type *MapType::elementType() const
 int CustomType::idGen = 0;
 
 CustomType::CustomType(Type *type)
-    : type{type}, id{idGen++}
+    : type{type}, id{idGen++}, describing{false}
 {}
 
-CustomType::~CustomType()
-{
-    delete type;
-}
-
-bool CustomType::equals(const Type& other) const
-{
-    if (!instanceof<CustomType>(&other)) return false;
-
-    const CustomType& casted_other = (const CustomType&) other;
-
-    return this->type->equals(*casted_other.type) && this->id == casted_other.id;
-}
-
 Type *CustomType::underlyingType() const 
 {
     if (instanceof<CustomType>(type)) {
@@ -383,9 +342,25 @@ Type *CustomType::underlyingType() const
     }
 }
 
-std::string CustomType::toString() const
+void CustomType::define(Type *type)
 {
-    return "Custom<" + this->type->toString() + ">";
+    this->type = type;
+}
+
+std::string CustomType::describe() const
+{
+    if (describing) return "Custom#" + std::to_string(id);
+
+    describing = true;
+    auto description = "Custom<" + this->type->toString() + ">";
+    describing = false;
+
+    return description;
+}
+
+std::string CustomType::key() const
+{
+    return "Custom#" + std::to_string(id);
 }
 
 bool CustomType::composable() const 
@@ -393,12 +368,33 @@ bool CustomType::composable() const
     return type->composable();
 }
 
+std::string NilType::describe() const
+{
+    return "Nil";
+}
+
+std::string NilType::key() const
+{
+    return "Nil";
+}
+
 bool UnresolvedType::equals(const Type& other) const
 {
     return false;
 }
 
-std::string UnresolvedType::toString() const
+std::string UnresolvedType::describe() const
+{
+    return "!Unresolved!";
+}
+
+std::string UnresolvedType::key() const
 {
     return "!Unresolved!";
-}
\ No newline at end of file
+}
+
+std::unordered_map<std::string, Type *>& Types::canonical()
+{
+    static std::unordered_map<std::string, Type *> types;
+    return types;
+}
@@ -1,7 +1,9 @@
 #include "validation/validator.hpp"
+#include "natives/natives.hpp"
 
-Validator::Validator()
+Validator::Validator(bool lazy)
     : 
+    lazy{lazy},
     errors{},
     functionDeclarationValidators{},
     typeDeclTable{}, 
@@ -17,27 +19,18 @@ Validator::Validator()
     this->typeDeclTable.addScope();
     this->varDeclTable.addScope();
 
-    std::string printInt = "printInt";
-    std::string printRune = "printRune";
-    std::string printFloat32 = "printFloat32";
-    std::string printString = "printString";
-    this->varDeclTable.add(printInt, new FunctionType{{std::make_pair("value", new IntType{})}, {}});
-    this->varDeclTable.add(printRune, new FunctionType{{std::make_pair("value", new RuneType{})}, {}});
-    this->varDeclTable.add(printFloat32, new FunctionType{{std::make_pair("value", new Float32Type{})}, {}});
-    this->varDeclTable.add(printString, new FunctionType{{std::make_pair("value", new StringType{})}, {}});
-}
-
-Validator::~Validator()
-{
-    for (const auto typedecl : typeDeclTable.allValues())
-    {
-        delete typedecl;
+    for (const auto& native : Natives::all()) {
+        this->varDeclTable.add(native.id, native.signature());
     }
 
-    for (const auto vardecl : varDeclTable.allValues())
-    {
-        delete vardecl;
+    this->varDeclTable.add("nil", Types::get<NilType>());
+
+    for (long bits = 8; bits <= 64; bits *= 2) {
+        this->typeDeclTable.add("int" + std::to_string(bits), Types::get<SizedIntType>(bits, true));
+        this->typeDeclTable.add("uint" + std::to_string(bits), Types::get<SizedIntType>(bits, false));
     }
+
+    this->typeDeclTable.add("byte", Types::get<SizedIntType>(8, false));
 }
 
 std::vector<std::string> Validator::getErrors() const
@@ -45,12 +38,30 @@ std::vector<std::string> Validator::getErrors() const
     return errors;
 }
 
+bool Validator::assignable(Type *value, Type *target)
+{
+    if (value->equals(*target)) return true;
+
+    auto baseType = target;
+    if (instanceof<CustomType>(baseType)) {
+        baseType = dynamic_cast<CustomType *>(baseType)->underlyingType();
+    }
+
+    return instanceof<NilType>(value) && instanceof<PointerType>(baseType);
+}
+
+Type *Validator::converted(Type *operand, Type *other)
+{
+    if (instanceof<SizedIntType>(other) && operand == Types::get<IntType>()) return other;
+    return operand;
+}
+
 void Validator::visitProgram(long size)
 {
     if (!functionDeclarationValidators.contains("main")) {
         errors.push_back("Program does not contain a main function");
     } else {
-        std::string id = "main";
+        Atom id = "main";
         auto main = dynamic_cast<FunctionType*>(varDeclTable.get(id));
 
         if (!main->getParameters().empty()) {
@@ -62,55 +73,75 @@ void Validator::visitProgram(long size)
         }
     }
 
+    if (lazy) return;
+
     for (const auto functionValidator : functionDeclarationValidators) {
         functionValidator.second();
     }
+
+    functionDeclarationValidators.clear();
+}
+
+void Validator::validateFunction(Atom id)
+{
+    auto functionValidator = functionDeclarationValidators.find(id);
+    if (functionValidator == functionDeclarationValidators.end()) return;
+
+    auto validate = functionValidator->second;
+    functionDeclarationValidators.erase(functionValidator);
+    validate();
 }
 
 void Validator::visitBoolType()
 {
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
 }
 
 void Validator::visitIntType()
 {
-    typeStack.push(new IntType{});
+    typeStack.push(Types::get<IntType>());
 }
 
 void Validator::visitFloat32Type()
 {
-    typeStack.push(new Float32Type{});
+    typeStack.push(Types::get<Float32Type>());
 }
 
 void Validator::visitRuneType()
 {
-    typeStack.push(new RuneType{});
+    typeStack.push(Types::get<RuneType>());
 }
 
 void Validator::visitStringType()
 {
-    typeStack.push(new StringType{});
+    typeStack.push(Types::get<StringType>());
 }
 
 void Validator::visitArrayType(long size)
 {
     auto elementType = typeStack.pop();
-    typeStack.push(new ArrayType{elementType, size});
+
+    // The lexer gives -1 for a length too large for an int
+    if (size < 0) {
+        errors.push_back("The length of an array must fit in an int.");
+    }
+
+    typeStack.push(Types::get<ArrayType>(elementType, size));
 }
 
 void Validator::visitSliceType()
 {
     auto elementType = typeStack.pop();
-    typeStack.push(new SliceType{elementType});
+    typeStack.push(Types::get<SliceType>(elementType));
 }
 
-void Validator::visitStructType(std::vector<std::string> fields)
+void Validator::visitStructType(std::vector<Atom> fields)
 {
     auto types = typeStack.pop(fields.size());
 
     std::reverse(types.begin(), types.end());
 
-    std::vector<std::pair<std::string, Type *>> _fields;
+    std::vector<std::pair<Atom, Type *>> _fields;
 
     std::transform(fields.begin(), fields.end(), types.begin(),
                std::back_inserter(_fields),
@@ -119,16 +150,16 @@ void Validator::visitStructType(std::vector<std::string> fields)
                    return std::make_pair(name, type);
                });
 
-    typeStack.push(new StructType{_fields});
+    typeStack.push(Types::get<StructType>(_fields));
 }
 
 void Validator::visitPointerType()
 {
     auto type = typeStack.pop();
-    typeStack.push(new PointerType{type});
+    typeStack.push(Types::get<PointerType>(type));
 }
 
-void Validator::visitFunctionType(std::vector<std::string> parameters, std::vector<std::string> returns)
+void Validator::visitFunctionType(const std::vector<Atom>& parameters, const std::vector<Atom>& returns)
 {
     auto returnTypes = typeStack.pop(returns.size());
     auto parameterTypes = typeStack.pop(parameters.size());
@@ -136,8 +167,8 @@ void Validator::visitFunctionType(std::vector<std::string> parameters, std::vect
     std::reverse(parameterTypes.begin(), parameterTypes.end());
     std::reverse(returnTypes.begin(), returnTypes.end());
 
-    std::vector<std::pair<std::string, Type *>> _parameters;
-    std::vector<std::pair<std::string, Type *>> _returns;
+    std::vector<std::pair<Atom, Type *>> _parameters;
+    std::vector<std::pair<Atom, Type *>> _returns;
 
     std::transform(parameters.begin(), parameters.end(), parameterTypes.begin(),
                std::back_inserter(_parameters),
@@ -157,27 +188,27 @@ void Validator::visitFunctionType(std::vector<std::string> parameters, std::vect
         errors.push_back("Multiple return values is not supported.");
     }
 
-    typeStack.push(new FunctionType{_parameters, _returns});
+    typeStack.push(Types::get<FunctionType>(_parameters, _returns));
 }
 
 void Validator::visitMapType()
 {
     auto elementType = typeStack.pop();
     auto keyType = typeStack.pop();
-    typeStack.push(new MapType{keyType, elementType});
+    typeStack.push(Types::get<MapType>(keyType, elementType));
 }
 
-void Validator::visitCustomType(std::string id)
+void Validator::visitCustomType(Atom id)
 {
     if (!typeDeclTable.contains(id)) {
         errors.push_back("Type \'" + id + "\' does not exist.");
-        typeDeclTable.add(id, new UnresolvedType{});
+        typeDeclTable.add(id, Types::get<UnresolvedType>());
     }
 
     typeStack.push(typeDeclTable.get(id));
 }
 
-void Validator::visitBlock(const std::vector<const std::function<void ()>> visitStatements)
+void Validator::visitBlock(AST::Visits visitStatements)
 {
     typeDeclTable.addScope();
     varDeclTable.addScope();
@@ -190,7 +221,7 @@ void Validator::visitBlock(const std::vector<const std::function<void ()>> visit
     varDeclTable.removeScope();
 }
 
-void Validator::visitFunctionDeclaration(std::string id, const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody)
+void Validator::visitFunctionDeclaration(Atom id, AST::Visit visitSignature, AST::Visit visitBody)
 {
     visitSignature();
     auto signature = typeStack.pop();
@@ -226,27 +257,31 @@ void Validator::visitFunctionDeclaration(std::string id, const std::function<voi
     }));
 }
 
-void Validator::visitTypeAliasDeclaration(std::string id)
+void Validator::visitTypeAliasDeclaration(Atom id, AST::Visit visitType)
 {
+    visitType();
     auto type = typeStack.pop();
     typeDeclTable.add(id, type);
 }
 
-void Validator::visitTypeDefinitionDeclaration(std::string id)
+void Validator::visitTypeDefinitionDeclaration(Atom id, AST::Visit visitType)
 {
-    auto type = new CustomType{typeStack.pop()};
+    // Declared before its underlying type is visited, which can point back to it
+    auto type = Types::get<CustomType>(Types::get<UnresolvedType>());
     typeDeclTable.add(id, type);
+
+    visitType();
+    type->define(typeStack.pop());
 }
 
-void Validator::visitVariableDeclaration(std::vector<std::string> ids, bool typeDeclared, long expression_count)
+void Validator::visitVariableDeclaration(std::vector<Atom> ids, bool typeDeclared, long expression_count)
 {
-    Type *type = new UnresolvedType{};
+    Type *type = Types::get<UnresolvedType>();
     std::vector<Type *> types = typeStack.pop(expression_count);
     std::vector<bool> referencable = referencableStack.pop(expression_count);
     std::reverse(types.begin(), types.end());
 
     if (typeDeclared) {
-        delete type;
         type = typeStack.pop();
     
         if (ids.size() != expression_count && expression_count != 0) {
@@ -258,13 +293,13 @@ void Validator::visitVariableDeclaration(std::vector<std::string> ids, bool type
             errors.push_back("Assignment mismatch, " + std::to_string(ids.size()) + " variables but " + std::to_string(expression_count) + (expression_count == 1 ? " value." : " values."));
             return;
         } else {
-            delete type;
             type = types[0];
         }
     }
 
+    // Ints are converted to a declared sized integer type, like constants
     for (const auto elemType : types) {
-        if (!elemType->equals(*type)) {
+        if (!assignable(converted(elemType, type), type)) {
             errors.push_back("Got type " + elemType->toString() + " but expected " + type->toString() + ".");
         }
     }
@@ -283,7 +318,7 @@ void Validator::visitExpressionStatement()
     // FIXME: 
 }
 
-void Validator::visitAssignmentStatement(const std::function<long ()>& visitLhs, const std::function<long ()>& visitRhs)
+void Validator::visitAssignmentStatement(AST::Visits visitLhs, AST::Visits visitRhs)
 { 
     auto lhsSize = visitLhs();
     auto rhsSize = visitRhs();
@@ -309,13 +344,48 @@ void Validator::visitAssignmentStatement(const std::function<long ()>& visitLhs,
             errors.push_back("Left hand side of assignment must be assignable");
         }
 
-        if (!lhs->equals(*rhs)) {
+        if (!assignable(rhs, lhs)) {
             errors.push_back("Got type " + rhs->toString() + " but expected " + lhs->toString() + ".");
         }
     }
 }
 
-void Validator::visitIfStatement(const std::function <void ()>& visitTrue, const std::function <void ()>& visitFalse)
+void Validator::visitCompoundAssignmentStatement(AST::Visit visitTarget, AST::Visit visitUpdate)
+{
+    visitTarget();
+    visitUpdate();
+
+    auto update = typeStack.pop();
+    auto target = typeStack.pop();
+    referencableStack.pop();
+    auto referencable = referencableStack.pop();
+
+    if (!referencable) {
+        errors.push_back("Left hand side of assignment must be assignable");
+    }
+
+    if (!target->equals(*update)) {
+        errors.push_back("Got type " + update->toString() + " but expected " + target->toString() + ".");
+    }
+}
+
+void Validator::visitIncDecStatement(AST::Visit visitTarget, long delta)
+{
+    visitTarget();
+
+    auto target = typeStack.pop();
+    auto referencable = referencableStack.pop();
+
+    if (!referencable) {
+        errors.push_back("Operand of " + std::string{delta > 0 ? "++" : "--"} + " must be assignable");
+    }
+
+    if (!instanceof<IntType>(target) && !instanceof<Float32Type>(target) && !instanceof<RuneType>(target)) {
+        errors.push_back(std::string{delta > 0 ? "Increment" : "Decrement"} + " can only be used on an integer, float32 or rune, not on " + target->toString() + ".");
+    }
+}
+
+void Validator::visitIfStatement(AST::Visit visitTrue, AST::Visit visitFalse)
 {
     auto conditionType = typeStack.pop();
     referencableStack.pop();
@@ -336,7 +406,7 @@ void Validator::visitIfStatement(const std::function <void ()>& visitTrue, const
     returnsStack.push(currentReturns || (trueReturns && falseReturns));
 }
 
-void Validator::visitSwitchStatement(const std::function<void ()>& visitExpression, const std::vector<const std::function<void ()>> visitClauses)
+void Validator::visitSwitchStatement(AST::Visit visitExpression, AST::Visits visitClauses, const AST::SwitchTable *table)
 {
     visitExpression();
 
@@ -360,7 +430,7 @@ void Validator::visitSwitchStatement(const std::function<void ()>& visitExpressi
     switchExpressionTypeStack.pop();
 }
 
-void Validator::visitSwitchExpressionClause(const std::vector<const std::function<void ()>> visitExpressions, const std::vector<const std::function<void ()>> visitStatements)
+void Validator::visitSwitchExpressionClause(AST::Visits visitExpressions, AST::Visits visitStatements)
 {
     for (const auto visitExpression : visitExpressions) {
         visitExpression();
@@ -369,6 +439,8 @@ void Validator::visitSwitchExpressionClause(const std::vector<const std::functio
         referencableStack.pop();
         auto expected = switchExpressionTypeStack.top();
 
+        type = converted(type, expected);
+
         if (!type->equals(*expected)) {
             errors.push_back("Expected expression of type " + expected->toString() + ", not of type " + type->toString() + ".");
         }
@@ -379,7 +451,7 @@ void Validator::visitSwitchExpressionClause(const std::vector<const std::functio
     }
 }
 
-void Validator::visitSwitchDefaultClause(const std::vector<const std::function<void ()>> visitStatements)
+void Validator::visitSwitchDefaultClause(AST::Visits visitStatements)
 {
     for (const auto visitStatement : visitStatements) {
         visitStatement();
@@ -403,7 +475,7 @@ void Validator::visitReturnStatement(long size)
     }
 
     for (int i = 0; i < returns.size(); ++i) {
-        if (!returns[i].second->equals(*types[i])) {
+        if (!assignable(types[i], returns[i].second)) {
             errors.push_back("The " + std::to_string(i + 1) + (i == 0 ? "st" : (i == 1 ? "nd" : "th")) + " element has type " + types[i]->toString() + ", but expected " + returns[i].second->toString() + " in the return statementd.");
         }
     }
@@ -435,7 +507,7 @@ void Validator::visitContinueStatement()
 void Validator::visitEmptyStatement()
 {}
 
-void Validator::visitForConditionStatement(const std::function<void ()>& visitInit, const std::function<void ()>& visitCondition, const std::function<void ()>& visitPost, const std::function<void ()>& visitBody)
+void Validator::visitForConditionStatement(AST::Visit visitInit, AST::Visit visitCondition, AST::Visit visitPost, AST::Visit visitBody)
 {
     visitInit();
     visitCondition();
@@ -459,39 +531,49 @@ void Validator::visitForConditionStatement(const std::function<void ()>& visitIn
 
 void Validator::visitBoolExpression(bool value)
 {
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
-void Validator::visitIntExpression(int value)
+void Validator::visitIntExpression(long value)
 {
-    typeStack.push(new IntType{});
+    // The lexer gives -1 for a literal too large for an int, folded constants come after validation
+    if (value < 0) {
+        errors.push_back("The integer literal does not fit in an int.");
+    }
+
+    typeStack.push(Types::get<IntType>());
     referencableStack.push(false);
 }
 
 void Validator::visitFloat32Expression(float value)
 {
-    typeStack.push(new Float32Type{});
+    typeStack.push(Types::get<Float32Type>());
     referencableStack.push(false);
 }
 
 void Validator::visitRuneExpression(char value)
 {
-    typeStack.push(new RuneType{});
+    typeStack.push(Types::get<RuneType>());
     referencableStack.push(false);
 }
 
 void Validator::visitStringExpression(char *value, long length)
 {
-    typeStack.push(new StringType{});
+    typeStack.push(Types::get<StringType>());
     referencableStack.push(false);
 }
 
-void Validator::visitIdentifierExpression(std::string id)
+void Validator::visitConstantExpression(long index, AST::Visit visitLiteral)
+{
+    visitLiteral();
+}
+
+void Validator::visitIdentifierExpression(Atom id)
 {
     if (!varDeclTable.contains(id)) {
         errors.push_back("Variable \'" + id + "\' does not exist.");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(true);
         return;
     }
@@ -502,7 +584,14 @@ void Validator::visitIdentifierExpression(std::string id)
     referencableStack.push(true);
 }
 
-void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
+void Validator::visitTargetExpression()
+{
+    // The target was visited just before the update, it is read but not stored here
+    typeStack.push(typeStack.top());
+    referencableStack.push(false);
+}
+
+void Validator::visitCompositLiteralExpression(std::vector<Atom> keys)
 {
     auto expressionTypes = typeStack.pop(keys.size());
     referencableStack.pop(keys.size());
@@ -514,7 +603,7 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
 
     if (!type->composable()) {
         errors.push_back(type->toString() + " is not composable.");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
         return;
     }
@@ -524,7 +613,7 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
     }
 
     if (instanceof<ArrayType>(baseType)) {
-        if (!std::all_of(keys.begin(), keys.end(), [](std::string key) { return key == ""; })) {
+        if (!std::all_of(keys.begin(), keys.end(), [](Atom key) { return key.empty(); })) {
             errors.push_back("Keys on a composite literal are only accepted for structures (because i got lazy).");
             typeStack.push(type);
             referencableStack.push(false);
@@ -533,13 +622,17 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
 
         auto arrayType = dynamic_cast<ArrayType *>(baseType);
 
+        if (expressionTypes.size() > arrayType->length()) {
+            errors.push_back("The composite literal has " + std::to_string(expressionTypes.size()) + " elements, but " + type->toString() + " only holds " + std::to_string(arrayType->length()) + '.');
+        }
+
         for (int i = 0; i < expressionTypes.size(); ++i) {
-            if (!expressionTypes[i]->equals(*arrayType->elementType())) {
+            if (!assignable(converted(expressionTypes[i], arrayType->elementType()), arrayType->elementType())) {
                 errors.push_back("The " + std::to_string(i + 1) + (i == 0 ? "st" : (i == 1 ? "nd" : "th")) + " element has type " + expressionTypes[i]->toString() + ", but expected " + arrayType->elementType()->toString() + '.');
             }
         }
     } else if (instanceof<SliceType>(baseType)) {
-        if (!std::all_of(keys.begin(), keys.end(), [](std::string key) { return key == ""; })) {
+        if (!std::all_of(keys.begin(), keys.end(), [](Atom key) { return key.empty(); })) {
             errors.push_back("Keys on a composite literal are only accepted for structures (because i got lazy).");
             typeStack.push(type);
             referencableStack.push(false);
@@ -549,7 +642,7 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
         auto sliceType = dynamic_cast<SliceType *>(baseType);
 
         for (int i = 0; i < expressionTypes.size(); ++i) {
-            if (!expressionTypes[i]->equals(*sliceType->elementType())) {
+            if (!assignable(converted(expressionTypes[i], sliceType->elementType()), sliceType->elementType())) {
                 errors.push_back("The " + std::to_string(i + 1) + (i == 0 ? "st" : (i == 1 ? "nd" : "th")) + " element has type " + expressionTypes[i]->toString() + ", but expected " + sliceType->elementType()->toString() + '.');
             }
         }
@@ -567,14 +660,14 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
         //     }
         // }
     } else if (instanceof<StructType>(baseType)) {
-        if (!std::all_of(keys.begin(), keys.end(), [](std::string key) { return key != ""; })) {
+        if (!std::all_of(keys.begin(), keys.end(), [](Atom key) { return !key.empty(); })) {
             errors.push_back("Keys on a composite literal are required for structures (because i got lazy).");
             typeStack.push(type);
             referencableStack.push(false);
             return;
         }
 
-        std::vector<std::string> dupCheck;
+        std::vector<Atom> dupCheck;
 
         bool flag = false;
 
@@ -593,13 +686,17 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
             return;
         }
 
-        std::vector<std::pair<std::string, Type *>> fields;
+        std::vector<std::pair<Atom, Type *>> fields;
+        auto structType = dynamic_cast<StructType *>(baseType);
 
+        // `nil` takes the type of the pointer field it is given for
         for (int i = 0; i < keys.size(); ++i) {
-            fields.push_back(std::make_pair(keys[i], expressionTypes[i]));
+            auto fieldType = structType->typeOfField(keys[i]);
+            auto given = fieldType != nullptr && assignable(expressionTypes[i], fieldType) ? fieldType : expressionTypes[i];
+            fields.push_back(std::make_pair(keys[i], given));
         }
 
-        auto composedType = new StructType{fields};
+        auto composedType = Types::get<StructType>(fields);
 
         if (!baseType->equals(*composedType)) {
             errors.push_back("Given type doesn't match composed type, either the fields are out of order, or incorrect/not all fields have been declared.");
@@ -614,7 +711,7 @@ void Validator::visitCompositLiteralExpression(std::vector<std::string> keys)
     referencableStack.push(false);
 }
 
-void Validator::VisitFunctionLiteralExpression(const std::function<void ()>& visitSignature, const std::function<void ()>& visitBody)
+void Validator::VisitFunctionLiteralExpression(AST::Visit visitSignature, AST::Visit visitBody)
 {
     visitSignature();
     auto signature = dynamic_cast<FunctionType *>(typeStack.pop());
@@ -647,7 +744,7 @@ void Validator::VisitFunctionLiteralExpression(const std::function<void ()>& vis
     referencableStack.push(false);
 }
 
-void Validator::visitSelectExpression(std::string id)
+void Validator::visitSelectExpression(Atom id, long& fieldIndex)
 {
     auto type = typeStack.pop();
     auto referencable = referencableStack.pop();
@@ -657,22 +754,33 @@ void Validator::visitSelectExpression(std::string id)
         baseType = dynamic_cast<CustomType*>(baseType)->underlyingType();
     }
 
+    // Selectors go through pointers to structs, the fields they reach are assignable
+    if (instanceof<PointerType>(baseType)) {
+        baseType = dynamic_cast<PointerType *>(baseType)->underlyingType();
+        referencable = true;
+
+        if (instanceof<CustomType>(baseType)) {
+            baseType = dynamic_cast<CustomType*>(baseType)->underlyingType();
+        }
+    }
+
     if (instanceof<StructType>(baseType)) {
         if (!dynamic_cast<StructType *>(baseType)->hasField(id)) {
             errors.push_back("Type " + type->toString() + " has no field \'" + id + "\'.");
-            typeStack.push(new UnresolvedType{});
+            typeStack.push(Types::get<UnresolvedType>());
         } else {
             typeStack.push(dynamic_cast<StructType *>(baseType)->typeOfField(id));
+            fieldIndex = dynamic_cast<StructType *>(baseType)->indexOfField(id);
         }
         referencableStack.push(referencable);
     } else {
         errors.push_back("Selectors can only be used on Structs not on " + type->toString());
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
     }
 }
 
-void Validator::visitIndexExpression()
+void Validator::visitIndexExpression(long& length, bool checked)
 {
     auto indexType = typeStack.pop();
     auto indexReferencable = referencableStack.pop();
@@ -686,30 +794,37 @@ void Validator::visitIndexExpression()
 
         typeStack.push(dynamic_cast<ArrayType *>(expressionType)->elementType());
         referencableStack.push(expresionReferencable);
+
+        // Only int indices are proven in range, the others keep their check
+        if (indexType == Types::get<IntType>()) {
+            length = dynamic_cast<ArrayType *>(expressionType)->length();
+        }
     } else if (instanceof<SliceType>(expressionType)) {
         if (!instanceof<IntType>(indexType)) {
             errors.push_back("Slices can only be indexed using Ints, not " + indexType->toString() + ".");
         }
 
+        // Slice elements live in the backing array, they are always assignable
         typeStack.push(dynamic_cast<SliceType *>(expressionType)->elementType());
-        referencableStack.push(expresionReferencable);
+        referencableStack.push(true);
     } else if (instanceof<StringType>(expressionType)) {
         if (!instanceof<IntType>(indexType)) {
             errors.push_back("Strings can only be indexed using Ints, not " + indexType->toString() + ".");
         }
 
-        typeStack.push(dynamic_cast<SliceType *>(expressionType)->elementType());
-        referencableStack.push(expresionReferencable);
+        // Strings are immutable, their elements are no lvalues
+        typeStack.push(Types::get<RuneType>());
+        referencableStack.push(false);
     } else if (instanceof<MapType>(expressionType)) {
         if (indexType != dynamic_cast<MapType *>(expressionType)->keyType()) {
             errors.push_back(expressionType->toString() + " can only be indexed using " + dynamic_cast<MapType *>(expressionType)->keyType()->toString() + ", not " + indexType->toString() + ".");
         }
 
         typeStack.push(dynamic_cast<MapType *>(expressionType)->elementType());
-        referencableStack.push(expresionReferencable);
+        referencableStack.push(true);
     } else {
         errors.push_back("Indexing can not be used on " + expressionType->toString() + ".");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
     }
 }
@@ -737,22 +852,22 @@ void Validator::visitSimpleSliceExpression(bool lowDeclared, bool highDeclared)
 
     if (instanceof<ArrayType>(expressionType)) {
         typeStack.push(
-            new SliceType{
+            Types::get<SliceType>(
                 dynamic_cast<ArrayType *>(expressionType)
-                    ->elementType()});
+                    ->elementType()));
         referencableStack.push(false);
     } else if (instanceof<SliceType>(expressionType)) {
         typeStack.push(
-            new SliceType{
+            Types::get<SliceType>(
                 dynamic_cast<SliceType *>(expressionType)
-                    ->elementType()});
+                    ->elementType()));
         referencableStack.push(false);
     } else if (instanceof<StringType>(expressionType)) {
         typeStack.push(expressionType);
         referencableStack.push(false);
     } else {
         errors.push_back("Can not take slice of " + expressionType->toString() + ".");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
     }
 }
@@ -785,36 +900,37 @@ void Validator::visitFullSliceExpression(bool lowDeclared)
 
     if (instanceof<ArrayType>(expressionType)) {
         typeStack.push(
-            new SliceType{
+            Types::get<SliceType>(
                 dynamic_cast<ArrayType *>(expressionType)
-                    ->elementType()});
+                    ->elementType()));
         referencableStack.push(false);
     } else if (instanceof<SliceType>(expressionType)) {
         typeStack.push(
-            new SliceType{
+            Types::get<SliceType>(
                 dynamic_cast<SliceType *>(expressionType)
-                    ->elementType()});
+                    ->elementType()));
         referencableStack.push(false);
     } else if (instanceof<StringType>(expressionType)) {
         typeStack.push(expressionType);
         referencableStack.push(false);
     } else {
         errors.push_back("Can not take slice of " + expressionType->toString() + ".");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
     }
 }
 
-void Validator::visitCallExpression(long size)
+void Validator::visitCallExpression(long size, long line, bool tailCall)
 {
     auto argTypes = typeStack.pop(size);
+    std::reverse(argTypes.begin(), argTypes.end());
     referencableStack.pop(size);
     auto expressionType = typeStack.pop();
     referencableStack.pop();
 
     if (!instanceof<FunctionType>(expressionType)) {
         errors.push_back("Expected a function, not " + expressionType->toString() + ".");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(false);
         return;
     }
@@ -828,7 +944,7 @@ void Validator::visitCallExpression(long size)
     }
 
     for (int i = 0; i < paramTypes.size(); ++i) {
-        if (!paramTypes[i]->equals(*argTypes[i])) {
+        if (!assignable(argTypes[i], paramTypes[i])) {
             errors.push_back("Expected the " + std::to_string(i+1) + (
                 i == 0 ? "st" :
                 i == 1 ? "nd" :
@@ -845,7 +961,27 @@ void Validator::visitCallExpression(long size)
 
 void Validator::visitConversionExpression()
 {
-    // FIXME: in parser
+    auto operand = typeStack.pop();
+    referencableStack.pop();
+    auto type = typeStack.pop();
+
+    // Only conversions between integer types change the value, runes convert to them too
+    auto integer = instanceof<IntType>(operand) || instanceof<RuneType>(operand);
+    if (!assignable(operand, type) && !(integer && instanceof<IntType>(type))) {
+        errors.push_back("Cannot convert " + operand->toString() + " to " + type->toString() + ".");
+    }
+
+    typeStack.push(type);
+    referencableStack.push(false);
+}
+
+void Validator::visitNewExpression(AST::Visit visitType)
+{
+    visitType();
+    auto type = typeStack.pop();
+
+    typeStack.push(Types::get<PointerType>(type));
+    referencableStack.push(false);
 }
 
 void Validator::visitUnaryPlusExpression()
@@ -854,7 +990,7 @@ void Validator::visitUnaryPlusExpression()
     referencableStack.pop();
 
     if (!instanceof<IntType>(operand)
-        || !instanceof<Float32Type>(operand)) {
+        && !instanceof<Float32Type>(operand)) {
             errors.push_back("Unary plus can only be used on int, and float32, not on " + operand->toString() + ".");
     }
 
@@ -868,7 +1004,7 @@ void Validator::visitUnaryNegateExpression()
     referencableStack.pop();
 
     if (!instanceof<IntType>(operand)
-        || !instanceof<Float32Type>(operand)) {
+        && !instanceof<Float32Type>(operand)) {
             errors.push_back("Unary minus can only be used on int, and float32, not on " + operand->toString() + ".");
     }
 
@@ -903,25 +1039,22 @@ void Validator::visitUnaryBitwiseNotExpression()
 
 void Validator::visitUnaryDereferenceExpression()
 {
-    errors.push_back("Address operations are not supported.");
-
     auto operand = typeStack.pop();
     auto referencable = referencableStack.pop();
 
     if (!instanceof<PointerType>(operand)) {
         errors.push_back("Dereference can only be used on pointers, not on " + operand->toString() + ".");
-        typeStack.push(new UnresolvedType{});
+        typeStack.push(Types::get<UnresolvedType>());
         referencableStack.push(referencable);
     } else {
+        // What a pointer points at is always assignable
         typeStack.push(dynamic_cast<PointerType*>(operand)->underlyingType());
-        referencableStack.push(referencable);
+        referencableStack.push(true);
     }
 }
 
-void Validator::visitUnaryReferenceExpression()
+void Validator::visitUnaryReferenceExpression(bool& escapes)
 {
-    errors.push_back("Address operations are not supported.");
-
     auto operand = typeStack.pop();
     auto referencable = referencableStack.pop();
 
@@ -929,7 +1062,7 @@ void Validator::visitUnaryReferenceExpression()
         errors.push_back("Operand of reference operator has to be referencable.");
     } 
 
-    typeStack.push(new PointerType{operand});
+    typeStack.push(Types::get<PointerType>(operand));
     referencableStack.push(false);
 }
 
@@ -948,7 +1081,7 @@ void Validator::visitBinaryLogicalOrExpression()
             errors.push_back("Logical or can only be used on booleans, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -967,7 +1100,7 @@ void Validator::visitBinaryLogicalAndExpression()
             errors.push_back("Logical or can only be used on booleans, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -977,6 +1110,8 @@ void Validator::visitBinaryEqualExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) || instanceof<MapType>(lhs) || instanceof<FunctionType>(lhs)) {
         errors.push_back(lhs->toString() + " is not comparable.");
@@ -986,11 +1121,11 @@ void Validator::visitBinaryEqualExpression()
         errors.push_back(rhs->toString() + " is not comparable.");
     }
 
-    if (!lhs->equals(*rhs)) {
+    if (!assignable(lhs, rhs) && !assignable(rhs, lhs)) {
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1000,6 +1135,8 @@ void Validator::visitBinaryNotEqualExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) || instanceof<MapType>(lhs) || instanceof<FunctionType>(lhs)) {
         errors.push_back(lhs->toString() + " is not comparable.");
@@ -1010,11 +1147,11 @@ void Validator::visitBinaryNotEqualExpression()
     }
     // TODO: check if values in array are ordered/comparable
 
-    if (!lhs->equals(*rhs)) {
+    if (!assignable(lhs, rhs) && !assignable(rhs, lhs)) {
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1024,6 +1161,8 @@ void Validator::visitBinaryLessThanExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) 
     || instanceof<MapType>(lhs) 
@@ -1048,7 +1187,7 @@ void Validator::visitBinaryLessThanExpression()
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1058,6 +1197,8 @@ void Validator::visitBinaryLessThanEqualExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) 
     || instanceof<MapType>(lhs) 
@@ -1081,7 +1222,7 @@ void Validator::visitBinaryLessThanEqualExpression()
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1091,6 +1232,8 @@ void Validator::visitBinaryGreaterThanExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) 
     || instanceof<MapType>(lhs) 
@@ -1114,7 +1257,7 @@ void Validator::visitBinaryGreaterThanExpression()
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1124,6 +1267,8 @@ void Validator::visitBinaryGreaterThanEqualExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (instanceof<UnresolvedType>(lhs) 
     || instanceof<MapType>(lhs) 
@@ -1147,7 +1292,7 @@ void Validator::visitBinaryGreaterThanEqualExpression()
         errors.push_back("Cannot compare " + lhs->toString() + " to " + rhs->toString() + ".");
     }
 
-    typeStack.push(new BoolType{});
+    typeStack.push(Types::get<BoolType>());
     referencableStack.push(false);
 }
 
@@ -1166,7 +1311,8 @@ void Validator::visitBinaryShiftLeftExpression()
         errors.push_back("Shift expression can only be used on an integer, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new IntType{});
+    // The count can be any integer, the result has the type of the shifted value
+    typeStack.push(lhs);
     referencableStack.push(false);
 }
 
@@ -1185,7 +1331,8 @@ void Validator::visitBinaryShiftRightExpression()
         errors.push_back("Shift expression can only be used on an integer, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new IntType{});
+    // The count can be any integer, the result has the type of the shifted value
+    typeStack.push(lhs);
     referencableStack.push(false);
 }
 
@@ -1195,6 +1342,8 @@ void Validator::visitBinaryAddExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs) && !instanceof<Float32Type>(lhs) && !instanceof<RuneType>(lhs) && !instanceof<StringType>(lhs)) {
         errors.push_back("Add expression can only be used on an integer, float32, rune or string, not on " + lhs->toString() + ".");
@@ -1218,6 +1367,8 @@ void Validator::visitBinarySubtractExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs) && !instanceof<Float32Type>(lhs) && !instanceof<RuneType>(lhs)) {
         errors.push_back("Subtract expression can only be used on an integer, float32 or rune, not on " + lhs->toString() + ".");
@@ -1241,6 +1392,8 @@ void Validator::visitBinaryBitwiseOrExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs)) {
         errors.push_back("Bitwise or expression can only be used on an integer, not on " + lhs->toString() + ".");
@@ -1250,7 +1403,11 @@ void Validator::visitBinaryBitwiseOrExpression()
         errors.push_back("Bitwise or expression can only be used on an integer, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new IntType{});
+    if (!lhs->equals(*rhs)) {
+        errors.push_back("Cannot or " + lhs->toString() + " with " + rhs->toString() + ".");
+    }
+
+    typeStack.push(lhs);
     referencableStack.push(false);
 }
 
@@ -1260,6 +1417,8 @@ void Validator::visitBinaryBitwiseXOrExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs)) {
         errors.push_back("Bitwise xor expression can only be used on an integer, not on " + lhs->toString() + ".");
@@ -1269,7 +1428,11 @@ void Validator::visitBinaryBitwiseXOrExpression()
         errors.push_back("Bitwise xor expression can only be used on an integer, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new IntType{});
+    if (!lhs->equals(*rhs)) {
+        errors.push_back("Cannot xor " + lhs->toString() + " with " + rhs->toString() + ".");
+    }
+
+    typeStack.push(lhs);
     referencableStack.push(false);
 }
 
@@ -1279,6 +1442,8 @@ void Validator::visitBinaryBitwiseAndExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs)) {
         errors.push_back("Bitwise and expression can only be used on an integer, not on " + lhs->toString() + ".");
@@ -1288,7 +1453,11 @@ void Validator::visitBinaryBitwiseAndExpression()
         errors.push_back("Bitwise and expression can only be used on an integer, not on " + rhs->toString() + ".");
     }
 
-    typeStack.push(new IntType{});
+    if (!lhs->equals(*rhs)) {
+        errors.push_back("Cannot and " + lhs->toString() + " with " + rhs->toString() + ".");
+    }
+
+    typeStack.push(lhs);
     referencableStack.push(false);
 }
 
@@ -1298,6 +1467,8 @@ void Validator::visitBinaryMultiplyExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs) && !instanceof<Float32Type>(lhs) && !instanceof<RuneType>(lhs)) {
         errors.push_back("Multiply expression can only be used on an integer, float32 or rune, not on " + lhs->toString() + ".");
@@ -1321,6 +1492,8 @@ void Validator::visitBinaryDivideExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs) && !instanceof<Float32Type>(lhs) && !instanceof<RuneType>(lhs)) {
         errors.push_back("Divide expression can only be used on an integer, float32 or rune, not on " + lhs->toString() + ".");
@@ -1344,6 +1517,8 @@ void Validator::visitBinaryModuloExpression()
     auto lhs = typeStack.pop();
     referencableStack.pop();
     referencableStack.pop();
+    lhs = converted(lhs, rhs);
+    rhs = converted(rhs, lhs);
 
     if (!instanceof<IntType>(lhs)) {
         errors.push_back("Modulo expression can only be used on an integer, not on " + lhs->toString() + ".");
@@ -1360,3 +1535,55 @@ void Validator::visitBinaryModuloExpression()
     typeStack.push(lhs);
     referencableStack.push(false);
 }
+
+void Validator::visitIdentifierStore(Atom id)
+{
+    visitIdentifierExpression(id);
+}
+
+void Validator::visitSelectStore(Atom id, long& fieldIndex)
+{
+    visitSelectExpression(id, fieldIndex);
+}
+
+void Validator::visitIndexStore(long& length, bool checked)
+{
+    visitIndexExpression(length, checked);
+}
+
+void Validator::visitDereferenceStore()
+{
+    visitUnaryDereferenceExpression();
+}
+
+void Validator::visitLiteralStore()
+{
+    // `&T{...}` allocates the value it points at
+    referencableStack.pop();
+    referencableStack.push(true);
+}
+
+void Validator::visitValueStore()
+{
+    // Stays unreferencable, only what it points at or the elements of a slice can be stored to
+}
+
+void Validator::visitIncrementStatement(Atom id, long delta, long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Validator::visitCompareLocalExpression(Atom id, long constant, bool (*compare)(long, long), long& executions, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Validator::visitIndexLocalExpression(Atom id, long& executions, bool checked, AST::Visit visitIndex, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
+
+void Validator::visitIndexGridExpression(bool rowChecked, bool checked, AST::Visit visitRow, AST::Visit visitColumn, AST::Visit visitOriginal)
+{
+    visitOriginal();
+}
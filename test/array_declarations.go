@@ -0,0 +1,19 @@
+type cell struct {
+	alive bool
+	age   int
+}
+
+func main() {
+	var b [8]int
+	b[3] = 1
+	printInt(b[3] + b[7])
+
+	var g [3][4]int
+	g[1][2] = 5
+	g[2][3] = g[1][2] + 1
+	printInt(g[0][0] + g[1][2] + g[2][3])
+
+	var c [2]cell
+	c[1].age = 4
+	printInt(c[0].age + c[1].age)
+}
@@ -0,0 +1,23 @@
+func sum(a [4]int) int {
+	var s int = 0
+	var i int
+	for i = 0; i < 4; i++ {
+		s = s + a[i]
+	}
+	return s
+}
+
+func main() {
+	var a [4]int = [4]int{1}
+	printInt(sum(a))
+
+	var b [3]int = [3]int{}
+	b[1] = 5
+	printInt(b[0])
+	printInt(b[1])
+	printInt(b[2])
+
+	var g [3][2]int = [3][2]int{[2]int{1, 2}}
+	g[2][1] = 7
+	printInt(g[0][1] + g[1][0] + g[2][1])
+}
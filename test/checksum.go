@@ -0,0 +1,29 @@
+func main() {
+	var data []byte = []byte{72, 101, 108, 108, 111, 44, 32, 87, 111, 114, 108, 100}
+	printInt(int(adler32(data, 12)))
+	printString("\n")
+	printInt(int(fnv1a("Hello, World", 12)))
+	printString("\n")
+}
+
+// Sums wrap at 32 bits, the low and high halves are reduced modulo 65521
+func adler32(data []byte, n int) uint32 {
+	var a, b uint32 = 1, 0
+	var i int = 0
+	for i = 0; i < n; i++ {
+		a = (a + uint32(data[i])) % 65521
+		b = (b + a) % 65521
+	}
+	return b<<16 | a
+}
+
+// Multiplication wraps at 32 bits
+func fnv1a(s string, n int) uint32 {
+	var h uint32 = 2166136261
+	var i int = 0
+	for i = 0; i < n; i++ {
+		h ^= uint32(s[i])
+		h *= 16777619
+	}
+	return h
+}
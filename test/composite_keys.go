@@ -0,0 +1,53 @@
+func main() {
+	// Arrays and structs compare by their elements and fields
+	var a [3]int = [3]int{1, 2, 3}
+	var b [3]int = [3]int{1, 2, 3}
+	var l Line = Line{from: Point{x: 1, y: 2}, to: Point{x: 3, y: 4}}
+	var m Line = l
+	m.to.y = 99
+	printInts(truth(a == b), truth(l == m))
+
+	// Map keys of composite types, looked up by an equal value
+	var counts map[Point]int = map[Point]int{}
+	counts[Point{x: 1, y: 2}] = 10
+	counts[l.to] = 20
+	printInts(counts[l.from], counts[Point{x: 3, y: 4}])
+
+	// A key is not changed by writes to the variable it came from
+	var names map[[2]string]int = map[[2]string]int{}
+	var key [2]string = [2]string{"a", "b"}
+	names[key] = 7
+	key[0] = "c"
+	printInts(names[key], names[[2]string{"a", "b"}])
+
+	switch (l.to) {
+	case Point{x: 1, y: 2}:
+		printString("from\n")
+	case Point{x: 3, y: 4}:
+		printString("to\n")
+	}
+}
+
+type Point struct {
+	x int
+	y int
+}
+
+type Line struct {
+	from Point
+	to Point
+}
+
+func truth(b bool) int {
+	if (b) {
+		return 1
+	}
+	return 0
+}
+
+func printInts(x int, y int) {
+	printInt(x)
+	printString(" ")
+	printInt(y)
+	printString("\n")
+}
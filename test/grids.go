@@ -0,0 +1,47 @@
+func main() {
+	// Arrays of arrays are stored row after row, copies do not share cells
+	var a [2][3]int = [2][3]int{[3]int{1, 2, 3}, [3]int{4, 5, 6}}
+	var b [2][3]int = a
+	b[0][1] = 20
+	printInts(a[0][1], b[0][1])
+
+	// A row read out is a copy, a row stored in is copied into the grid
+	var r [3]int = a[1]
+	a[1][0] = 40
+	printInts(r[0], a[1][0])
+	a[0] = r
+	r[2] = 0
+	printInts(a[0][0], a[0][2])
+
+	// Rows swap without aliasing each other
+	a[0], a[1] = a[1], a[0]
+	printInts(a[0][0], a[1][0])
+
+	// A pointer to a cell writes into the grid
+	var p *int = &a[1][1]
+	*p = 50
+	printInts(a[1][1], sum(a[1]))
+
+	// A grid in a struct is copied with it
+	var board Board
+	board.cells[2][3] = 7
+	var other Board = board
+	other.cells[2][3] = 8
+	printInts(board.cells[2][3], other.cells[2][3])
+}
+
+type Board struct {
+	cells [3][4]int
+}
+
+func sum(r [3]int) int {
+	r[0] = 100
+	return r[0] + r[1] + r[2]
+}
+
+func printInts(x int, y int) {
+	printInt(x)
+	printString(" ")
+	printInt(y)
+	printString("\n")
+}
@@ -0,0 +1,25 @@
+func main() {
+	// Parameters and fields declared together share their type
+	var add = func(x int) int {
+		return x + 1
+	}
+	printInts(sum(3, 4), add(5))
+
+	var p Point = Point{x: 1, y: 2}
+	printInts(p.x, p.y)
+}
+
+type Point struct {
+	x, y int
+}
+
+func sum(x, y int) int {
+	return x + y
+}
+
+func printInts(x, y int) {
+	printInt(x)
+	printString(" ")
+	printInt(y)
+	printString("\n")
+}
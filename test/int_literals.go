@@ -0,0 +1,13 @@
+func main() {
+	var m int = 3000000000
+	printInt(m)
+	printInt(m * 2)
+
+	var big int64 = 0x7fffffffffffffff
+	printInt(int(big))
+	var mask uint64 = 1 << 40
+	printInt(int(mask + 0x_ffff_ffff))
+
+	var counts [3]int = [3]int{4294967296, 0b1_0000_0000_0000_0000_0000_0000_0000_0000, 0o40000000000}
+	printInt(counts[0] - counts[1] + counts[2])
+}
@@ -0,0 +1,21 @@
+type Point struct {
+	x int
+	y int
+}
+
+func main() {
+	// A missing key reads the zero value of the element type
+	var points map[string]Point = map[string]Point{}
+	points["a"] = Point{x: 1, y: 2}
+	printInt(points["a"].y + points["b"].x)
+
+	// Writing to a copy of the zero value leaves the map's alone
+	var p Point = points["c"]
+	p.x = 5
+	printInt(p.x + points["c"].x)
+
+	var rows map[int][2]int = map[int][2]int{}
+	var r [2]int = rows[3]
+	r[1] = 4
+	printInt(r[1] + rows[3][1])
+}
@@ -0,0 +1,59 @@
+type node struct {
+	val         int
+	left, right *node
+}
+
+func lookup(x int, p *node) bool {
+	for p != nil {
+		if p.val == x {
+			return true
+		} else if p.val < x {
+			p = p.right
+		} else {
+			p = p.left
+		}
+	}
+	return false
+}
+
+func insert(x int, p *node) {
+	for {
+		if p.val == x {
+			return
+		} else if p.val < x {
+			if p.right == nil {
+				p.right = &node{val: x, left: nil, right: nil}
+				return
+			} else {
+				p = p.right
+			}
+		} else {
+			if p.left == nil {
+				p.left = &node{val: x, left: nil, right: nil}
+				return
+			} else {
+				p = p.left
+			}
+		}
+	}
+}
+
+func main() {
+	var t *node = &node{val: 0, left: nil, right: nil}
+	insert(-4, t)
+	insert(5, t)
+	insert(100, t)
+	insert(60, t)
+	insert(-77, t)
+	insert(-1, t)
+	if lookup(-2, t) {
+		printInt(1)
+	} else {
+		printInt(0)
+	}
+	if lookup(60, t) {
+		printInt(1)
+	} else {
+		printInt(0)
+	}
+}
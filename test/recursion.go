@@ -0,0 +1,19 @@
+func main() {
+	printInt(count(1000000, 0))
+	printInt(sum(10000))
+}
+
+// Tail call, runs in constant native stack
+func count(n int, acc int) int {
+	if n == 0 {
+		return acc
+	}
+	return count(n-1, acc+1)
+}
+
+func sum(n int) int {
+	if n == 0 {
+		return 0
+	}
+	return n + sum(n-1)
+}
@@ -0,0 +1,54 @@
+func main() {
+	// Assigning or passing an array copies it
+	var a [4]int = [4]int{1, 2, 3, 4}
+	var b [4]int = a
+	b[0] = 42
+	printInts(a[0], b[0])
+	printInts(cleared(a), a[0])
+
+	// Writes to one row copy that row, not the others
+	var board [2][2]int = [2][2]int{[2]int{0, 0}, [2]int{0, 0}}
+	var next [2][2]int = board
+	next[1][1] = 1
+	printInts(board[1][1], next[1][1])
+
+	// Structs too, fields holding structs included
+	var l Line = Line{from: Point{x: 1, y: 2}, to: Point{x: 3, y: 4}}
+	var m Line = l
+	m.to.y = 99
+	printInts(l.to.y, m.to.y)
+	printInts(moved(l.from).x, l.from.x)
+
+	// A pointer into an array writes to that array only
+	var p *int = &a[1]
+	var c [4]int = a
+	*p = 55
+	printInts(a[1], c[1])
+}
+
+type Point struct {
+	x int
+	y int
+}
+
+type Line struct {
+	from Point
+	to Point
+}
+
+func cleared(a [4]int) int {
+	a[0] = 0
+	return a[0]
+}
+
+func moved(p Point) Point {
+	p.x = p.x + 10
+	return p
+}
+
+func printInts(x int, y int) {
+	printInt(x)
+	printString(" ")
+	printInt(y)
+	printString("\n")
+}